@@ -81,6 +81,62 @@ public:
      */
     void SetPollerMgr(LLBC_PollerMgr *mgr);
 
+    /**
+     * Set poller use integrated event loop or not, if poller not support, will ignore this option.
+     * @param[in] integrated - the integrated event loop flag.
+     */
+    void SetIntegratedLoop(bool integrated);
+
+    /**
+     * Get the session send buffer high water mark.
+     * @return size_t - the high water mark, in bytes, 0 means unlimited.
+     */
+    size_t GetSendBufHighWaterMark() const;
+
+    /**
+     * Set the session send buffer high water mark.
+     * @param[in] mark - the high water mark, in bytes, 0 means unlimited.
+     */
+    void SetSendBufHighWaterMark(size_t mark);
+
+    /**
+     * Check poller use send coalescing or not.
+     * @return bool - the send coalescing flag.
+     */
+    bool IsSendCoalescing() const;
+
+    /**
+     * Get the send coalescing max bytes per session.
+     * @return size_t - the max bytes.
+     */
+    size_t GetSendCoalesceMaxBytes() const;
+
+    /**
+     * Set poller use send coalescing or not, if poller not support, will ignore this option.
+     * @param[in] coalescing - the send coalescing flag.
+     * @param[in] maxDelay   - the max delay, in milli-seconds.
+     * @param[in] maxBytes   - the max coalesced bytes per session.
+     */
+    void SetSendCoalescing(bool coalescing, int maxDelay, size_t maxBytes);
+
+    /**
+     * Get the sent packets count, only count the packets which completely written to socket.
+     * @return uint64 - the sent packets count.
+     */
+    uint64 GetSentPacketCount() const;
+
+    /**
+     * Get the send syscalls count.
+     * @return uint64 - the send syscalls count.
+     */
+    uint64 GetSendSyscallCount() const;
+
+    /**
+     * Get the poller receive blocks pool, only can use in poller thread.
+     * @return LLBC_MessageBlockPool & - the receive blocks pool.
+     */
+    LLBC_MessageBlockPool &GetRecvBlockPool();
+
 public:
     /**
      * Startup poller to work.
@@ -115,6 +171,24 @@ protected:
      */
     LLBC_Session *CreateSession(LLBC_Socket *socket, int sessionId = 0);
 
+    /**
+     * Mark session send dirty, dirty session will be flushed at the end of queued events batch.
+     * @param[in] sessionId - the session Id.
+     */
+    void MarkSendDirty(int sessionId);
+
+    /**
+     * Flush all send dirty sessions.
+     */
+    void FlushDirtySessions();
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Sample poller message queue size, and report poller metrics to service per second.
+     */
+    void UpdateMetrics();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 protected:
     /**
      * Add session to poller.
@@ -149,6 +223,9 @@ private:
      * Access method list:
      *      AddSession(LLBC_Session *)
      *      RemoveSession(LLBC_Session *)
+     *      MarkSendDirty(int)
+     *      _sentPacketCount/_sendSyscallCount
+     *      _recvPacketCount/_recvBytes/_sentBytes
      */
     friend class LLBC_Session;
 
@@ -160,6 +237,27 @@ protected:
     int _brotherCount;
     LLBC_IService *_svc;
     LLBC_PollerMgr *_pollerMgr;
+    bool _integratedLoop;
+    size_t _sendBufHighWaterMark;
+    LLBC_MessageBlockPool _recvBlockPool;
+
+    bool _sendCoalescing;
+    int _sendCoalesceMaxDelay;
+    size_t _sendCoalesceMaxBytes;
+    std::vector<int> _dirtySessions;
+    sint64 _firstDirtyTime;
+
+    volatile uint64 _sentPacketCount;
+    volatile uint64 _sendSyscallCount;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    sint64 _nextMetricsTime;
+    uint64 _recvPacketCount;
+    uint64 _recvBytes;
+    uint64 _reportedSentPacketCount;
+    uint64 _sentBytes;
+    size_t _maxQueueSize;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
     
     typedef std::map<LLBC_SocketHandle, LLBC_Session *> _Sockets;
     _Sockets _sockets;
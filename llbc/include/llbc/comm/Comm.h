@@ -16,11 +16,15 @@
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/Session.h"
 #include "llbc/comm/Packet.h"
+#include "llbc/comm/PacketPool.h"
 #include "llbc/comm/ICoder.h"
+#include "llbc/comm/ICompressor.h"
+#include "llbc/comm/ZlibCompressor.h"
 #include "llbc/comm/IFacade.h"
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/BasePoller.h"
 #include "llbc/comm/IService.h"
+#include "llbc/comm/ServiceMetrics.h"
 #include "llbc/comm/ServiceMgr.h"
 #include "llbc/comm/PacketHeaderParts.h"
 #include "llbc/comm/LibPacketHeaderDescFactory.h"
@@ -29,6 +33,7 @@
 #include "llbc/comm/protocol/IProtocol.h"
 #include "llbc/comm/protocol/IProtocolFilter.h"
 #include "llbc/comm/headerdesc/PacketHeaderDesc.h"
+#include "llbc/comm/headerdesc/PacketHeaderLayout.h"
 
 __LLBC_NS_BEGIN
 
@@ -0,0 +1,88 @@
+/**
+ * @file    DispatchTable.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The service packet dispatch table define.
+ */
+#ifndef __LLBC_COMM_DISPATCH_TABLE_H__
+#define __LLBC_COMM_DISPATCH_TABLE_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The flat dispatch table class encapsulation.
+ *        Table build from ordered map once(normally in service Start()), after that,
+ *        it is read only. If keys are dense enough, use direct-indexed array, otherwise
+ *        use open-addressing(linear probing) hash table.
+ *        Note: table not hold values ownership.
+ */
+template <typename _Key, typename _Value>
+class LLBC_DispatchTable
+{
+public:
+    LLBC_DispatchTable();
+    ~LLBC_DispatchTable();
+
+public:
+    /**
+     * Build dispatch table, all old datas will be clear.
+     * @param[in] src - the source map.
+     */
+    void Build(const std::map<_Key, _Value *> &src);
+
+    /**
+     * Clear dispatch table.
+     */
+    void Clear();
+
+public:
+    /**
+     * Find value by key.
+     * @param[in] key - the key.
+     * @return _Value * - the value, if not found, return NULL.
+     */
+    _Value *Find(_Key key) const;
+
+    /**
+     * Get the key-value pairs count.
+     * @return size_t - the pairs count.
+     */
+    size_t GetSize() const;
+
+    /**
+     * Check this table is direct-indexed or not.
+     * @return bool - direct-indexed flag.
+     */
+    bool IsDirectIndexed() const;
+
+private:
+    /**
+     * Hash the key.
+     * @param[in] key - the key.
+     * @return size_t - the slot index.
+     */
+    size_t Hash(_Key key) const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_DispatchTable);
+
+private:
+    bool _direct;
+    _Key _minKey;
+
+    size_t _size;
+    size_t _capacity;
+
+    _Key *_keys;
+    _Value **_values;
+};
+
+__LLBC_NS_END
+
+#include "llbc/comm/DispatchTableImpl.h"
+
+#endif // !__LLBC_COMM_DISPATCH_TABLE_H__
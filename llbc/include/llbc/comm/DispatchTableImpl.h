@@ -0,0 +1,142 @@
+/**
+ * @file    DispatchTableImpl.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifdef __LLBC_COMM_DISPATCH_TABLE_H__
+
+__LLBC_NS_BEGIN
+
+template <typename _Key, typename _Value>
+inline LLBC_DispatchTable<_Key, _Value>::LLBC_DispatchTable()
+: _direct(true)
+, _minKey(0)
+
+, _size(0)
+, _capacity(0)
+
+, _keys(NULL)
+, _values(NULL)
+{
+}
+
+template <typename _Key, typename _Value>
+inline LLBC_DispatchTable<_Key, _Value>::~LLBC_DispatchTable()
+{
+    this->Clear();
+}
+
+template <typename _Key, typename _Value>
+void LLBC_DispatchTable<_Key, _Value>::Build(const std::map<_Key, _Value *> &src)
+{
+    typedef typename std::map<_Key, _Value *>::const_iterator _Iter;
+
+    this->Clear();
+    if (src.empty())
+        return;
+
+    // Use direct-indexed array if keys range small and dense enough.
+    _minKey = src.begin()->first;
+    const uint64 range = static_cast<uint64>(src.rbegin()->first) - static_cast<uint64>(_minKey) + 1;
+    if (range <= LLBC_CFG_COMM_DISPATCH_TABLE_MAX_DIRECT_RANGE &&
+        range <= src.size() * LLBC_CFG_COMM_DISPATCH_TABLE_DIRECT_SPARSE_FACTOR)
+    {
+        _direct = true;
+        _capacity = static_cast<size_t>(range);
+        _values = LLBC_Calloc(_Value *, sizeof(_Value *) * _capacity);
+        for (_Iter it = src.begin(); it != src.end(); it++)
+            _values[static_cast<uint64>(it->first) - static_cast<uint64>(_minKey)] = it->second;
+    }
+    else
+    {
+        // Keep load factor <= 0.5.
+        _direct = false;
+        _capacity = 16;
+        while (_capacity < src.size() * 2)
+            _capacity <<= 1;
+
+        _keys = LLBC_Calloc(_Key, sizeof(_Key) * _capacity);
+        _values = LLBC_Calloc(_Value *, sizeof(_Value *) * _capacity);
+        for (_Iter it = src.begin(); it != src.end(); it++)
+        {
+            size_t slot = this->Hash(it->first);
+            while (_values[slot])
+                slot = (slot + 1) & (_capacity - 1);
+
+            _keys[slot] = it->first;
+            _values[slot] = it->second;
+        }
+    }
+
+    _size = src.size();
+}
+
+template <typename _Key, typename _Value>
+void LLBC_DispatchTable<_Key, _Value>::Clear()
+{
+    if (_keys)
+    {
+        LLBC_Free(_keys);
+        _keys = NULL;
+    }
+
+    if (_values)
+    {
+        LLBC_Free(_values);
+        _values = NULL;
+    }
+
+    _direct = true;
+    _minKey = 0;
+
+    _size = 0;
+    _capacity = 0;
+}
+
+template <typename _Key, typename _Value>
+inline _Value *LLBC_DispatchTable<_Key, _Value>::Find(_Key key) const
+{
+    if (_direct)
+    {
+        const uint64 idx = static_cast<uint64>(key) - static_cast<uint64>(_minKey);
+        return idx < _capacity ? _values[idx] : NULL;
+    }
+
+    for (size_t slot = this->Hash(key); _values[slot]; slot = (slot + 1) & (_capacity - 1))
+    {
+        if (_keys[slot] == key)
+            return _values[slot];
+    }
+
+    return NULL;
+}
+
+template <typename _Key, typename _Value>
+inline size_t LLBC_DispatchTable<_Key, _Value>::GetSize() const
+{
+    return _size;
+}
+
+template <typename _Key, typename _Value>
+inline bool LLBC_DispatchTable<_Key, _Value>::IsDirectIndexed() const
+{
+    return _direct;
+}
+
+template <typename _Key, typename _Value>
+inline size_t LLBC_DispatchTable<_Key, _Value>::Hash(_Key key) const
+{
+    // Fold key to 32 bits, then fibonacci hashing, mix high bits into low bits.
+    const uint64 key64 = static_cast<uint64>(key);
+    uint32 hash = static_cast<uint32>(key64) ^ static_cast<uint32>(key64 >> 32);
+    hash *= 2654435761U;
+
+    return static_cast<size_t>(hash ^ (hash >> 16)) & (_capacity - 1);
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_COMM_DISPATCH_TABLE_H__
@@ -44,6 +44,13 @@ public:
      */
     virtual int Start();
 
+    /**
+     * Push message block to poller, if poller use integrated event loop, will wakeup poller.
+     * @param[in] block - message block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Push(LLBC_MessageBlock *block);
+
     /**
      * Task startup method.
      */
@@ -91,6 +98,17 @@ private:
      */
     void MonitorSvc();
 
+    /**
+     * Startup/Stop integrated event loop wakeup eventfd.
+     */
+    int StartupWakeupFd();
+    void StopWakeupFd();
+
+    /**
+     * Handle io events.
+     */
+    void HandleIoEvents(const LLBC_EpollEvent *evs, int count);
+
     /**
      * Handle connecting sockets.
      */
@@ -105,7 +123,15 @@ private:
     LLBC_Handle _epoll;
     LLBC_PollerMonitor *_monitor;
 
+    LLBC_Handle _wakeupFd;
+    volatile int _wakeupPending;
+
     LLBC_EpollEvent _events[LLBC_CFG_COMM_MAX_EVENT_COUNT];
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    typedef std::map<LLBC_Handle, LLBC_Session *> _ShmDoorbells;
+    _ShmDoorbells _shmDoorbells;
+#endif // LLBC_TARGET_PLATFORM_LINUX
 };
 
 __LLBC_NS_END
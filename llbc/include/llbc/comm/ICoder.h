@@ -42,6 +42,19 @@ public:
      * Decode pure virtual function, implement it to use decode packet data.
      */
     virtual void Decode(LLBC_Packet &packet) = 0;
+
+    /**
+     * Decode packet data and report the decode result, library always decode packet by this method,
+     * default implementation call Decode() and never fail.
+     * Override it if coder can detect broken packet data, decode failed packet will not dispatch,
+     * and the session will be removed.
+     * @return bool - return true if decode success, otherwise return false.
+     */
+    virtual bool TryDecode(LLBC_Packet &packet)
+    {
+        this->Decode(packet);
+        return true;
+    }
 };
 
 /**
@@ -0,0 +1,66 @@
+/**
+ * @file    ICompressor.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The packet payload compressor interface define.
+ */
+#ifndef __LLBC_COMM_ICOMPRESSOR_H__
+#define __LLBC_COMM_ICOMPRESSOR_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The packet payload compressor interface class encapsulation.
+ *        Compressor object only use in one session, so it can hold and reuse
+ *        any compress/decompress context.
+ */
+class LLBC_ICompressor
+{
+public:
+    virtual ~LLBC_ICompressor() {  }
+
+public:
+    /**
+     * Compress data, compressed data will append to out block.
+     * @param[in] data - the will compress data.
+     * @param[in] len  - the will compress data length.
+     * @param[out] out - the out block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Compress(const void *data, size_t len, LLBC_MessageBlock &out) = 0;
+
+    /**
+     * Decompress data, decompressed data will append to out block.
+     * @param[in] data - the will decompress data.
+     * @param[in] len  - the will decompress data length.
+     * @param[out] out - the out block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Decompress(const void *data, size_t len, LLBC_MessageBlock &out) = 0;
+};
+
+/**
+ * \brief The packet payload compressor factory interface class encapsulation.
+ */
+class LLBC_ICompressorFactory
+{
+public:
+    virtual ~LLBC_ICompressorFactory() {  }
+
+public:
+    /**
+     * Create compressor.
+     * @return LLBC_ICompressor * - compressor.
+     */
+    virtual LLBC_ICompressor *Create() const = 0;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_ICOMPRESSOR_H__
@@ -23,6 +23,7 @@ class LLBC_Packet;
 class LLBC_IFacade;
 class LLBC_Session;
 class LLBC_ICoderFactory;
+class LLBC_ICompressorFactory;
 class LLBC_ProtocolStack;
 class LLBC_IProtocolFilter;
 class LLBC_PacketHeaderDesc;
@@ -114,6 +115,131 @@ public:
      */
     virtual int SetDriveMode(DriveMode mode) = 0;
 
+    /**
+     * Check the service pollers use integrated event loop or not.
+     * @return bool - return true if use integrated event loop, otherwise return false.
+     */
+    virtual bool IsPollerIntegratedLoop() const = 0;
+
+    /**
+     * Set the service pollers use integrated event loop or not, must call before service start.
+     * In integrated event loop mode, poller thread waits io events by itself and use eventfd
+     * to wakeup, no standalone monitor thread(Only available in EpollPoller).
+     * @param[in] integrated - the integrated event loop flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerIntegratedLoop(bool integrated) = 0;
+
+    /**
+     * Check the service use reuse port listen or not.
+     * @return bool - return true if use reuse port listen, otherwise return false.
+     */
+    virtual bool IsReusePortListen() const = 0;
+
+    /**
+     * Set the service use reuse port listen or not, must call before service start.
+     * In reuse port listen mode, every poller owns its own SO_REUSEPORT listen socket on the
+     * same address, kernel spreads accepts between pollers and each accepted session stays on
+     * the poller that accepted it(Only available in the platforms which support SO_REUSEPORT).
+     * Note: Listen() return the first listen session Id, every poller's listen session will
+     *       trigger OnSessionCreate() event, RemoveSession() with the first listen session Id
+     *       will close all pollers' listen sessions. Listen() on port 0 is not allowed in
+     *       this mode(every socket would bind to different port).
+     * @param[in] reusePort - the reuse port listen flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetReusePortListen(bool reusePort) = 0;
+
+    /**
+     * Check the service use event-driven wakeup or not.
+     * @return bool - return true if use event-driven wakeup, otherwise return false.
+     */
+    virtual bool IsEventDriven() const = 0;
+
+    /**
+     * Set the service use event-driven wakeup or not, must call before service start.
+     * In event-driven mode, service thread no longer sleep fixed frame interval, it blocks on
+     * service message queue until any event arrival, next timer timeout, or next frame boundary
+     * (if facades need OnUpdate()/OnIdle() ticks), poller pushed events and tasks Post() from
+     * other threads will wakeup it immediately.
+     * @param[in] eventDriven   - the event-driven flag.
+     * @param[in] facadesUpdate - the facades need frame ticks or not, default is true.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetEventDriven(bool eventDriven, bool facadesUpdate = true) = 0;
+
+    /**
+     * Check the service decode packets in poller threads or not.
+     * @return bool - return true if decode in poller threads, otherwise return false.
+     */
+    virtual bool IsPollerDecode() const = 0;
+
+    /**
+     * Set the service decode packets in poller threads or not, must call before service start.
+     * In poller decode mode, registered coder factories are frozen to a read-only coder table
+     * when service start, packets decode(ICoderFactory::Create() & ICoder::TryDecode()) in the
+     * poller thread which received the data, service thread only receive decoded packets.
+     * Note: Coder factories and Codec-Layer protocol filter must be thread-safe in this mode.
+     *       If coder override ICoder::TryDecode() and report decode failure, the session will be removed.
+     *       If use full stack(LLBC_CFG_COMM_USE_FULL_STACK), packets always decode in poller threads.
+     * @param[in] pollerDecode - the poller decode flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerDecode(bool pollerDecode) = 0;
+
+    /**
+     * Get the session send buffer high water mark.
+     * @return size_t - the high water mark, in bytes, 0 means unlimited.
+     */
+    virtual size_t GetSendBufHighWaterMark() const = 0;
+
+    /**
+     * Set the session send buffer high water mark, must call before service start.
+     * If session's not send data size reach high water mark, new send data will be
+     * discard and the session will be closed(slow consumer protection).
+     * @param[in] mark - the high water mark, in bytes, 0 means unlimited.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendBufHighWaterMark(size_t mark) = 0;
+
+    /**
+     * Check the service sessions use send coalescing or not.
+     * @return bool - return true if use send coalescing, otherwise return false.
+     */
+    virtual bool IsSendCoalescing() const = 0;
+
+    /**
+     * Set the service sessions use send coalescing or not, must call before service start(Only available in EpollPoller).
+     * In send coalescing mode, poller only mark session dirty when data queued, and flush each dirty session
+     * once at the end of current queued events batch, multi packets will be sent in one send syscall.
+     * @param[in] coalescing - the send coalescing flag.
+     * @param[in] maxDelay   - the max delay, in milli-seconds, bound the added latency.
+     * @param[in] maxBytes   - the max coalesced bytes per session, reach will flush immediately.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendCoalescing(bool coalescing,
+                                  int maxDelay = LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_DELAY,
+                                  size_t maxBytes = LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES) = 0;
+
+    /**
+     * Get the service send statistics, packets per syscall = sentPackets / sendSyscalls.
+     * @param[out] sentPackets  - the sent packets count.
+     * @param[out] sendSyscalls - the send syscalls count.
+     */
+    virtual void GetSendStats(uint64 &sentPackets, uint64 &sendSyscalls) const = 0;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Get the service metrics sampler group, sampler names and types see LLBC_SvcMetrics.
+     * Note: Metrics sampled in service thread(pollers report per second) without any lock, the sampler
+     *       group is NOT thread-safe, only can access in service thread(facades, packet handlers or
+     *       Post() tasks), or after service stopped, access it in any other thread is a data race.
+     *       If need metrics in other thread, Post() a task to copy the needed values out.
+     * @return const LLBC_SamplerGroup & - the metrics sampler group.
+     */
+    virtual const LLBC_SamplerGroup &GetMetrics() const = 0;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 public:
     /**
      * Startup service, default will startup one poller to work.
@@ -179,12 +305,70 @@ public:
      */
     virtual int AsyncConn(const char *ip, uint16 port) = 0;
 
+    /**
+     * Create a unix domain socket session and listening, Non-WIN32 platform specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address(LINUX/ANDROID).
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ListenUnix(const char *path) = 0;
+
+    /**
+     * Establishes a unix domain socket connection to a specified path, Non-WIN32 platform specific.
+     * Note: Connect never blocking, if the peer listen backlog full, return failed and last error
+     *       set to LLBC_ERROR_WBLOCK, can retry later.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address(LINUX/ANDROID).
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectUnix(const char *path) = 0;
+
+    /**
+     * Create a shared-memory channel listen session, LINUX platform and EpollPoller specific,
+     * the listen session is a unix domain socket session, the accepted sessions transfer data
+     * by shared-memory rings.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ListenShm(const char *path) = 0;
+
+    /**
+     * Establishes a shared-memory channel to a specified shared-memory channel listen path,
+     * LINUX platform and EpollPoller specific, blocking until channel handshake finished:
+     *  - Every channel use a POSIX shared-memory segment, contain two lock-free single-producer/
+     *    single-consumer rings(one per direction), the rings carry the same packet bytes as socket.
+     *  - Eventfd doorbells wakeup the peer poller, only when the peer waiting, busy channel
+     *    not need any syscall.
+     *  - The unix domain control socket keep connected, peer death(include process crashed)
+     *    will be detected by it and the session will be removed, as normal socket session.
+     *  - Send/Multicast/Broadcast/Subscribe semantics same as socket sessions.
+     * @param[in] path     - the socket path, if begin with '@', means abstract namespace address.
+     * @param[in] ringSize - the ring size, in bytes, per direction, will round up to power of 2.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectShm(const char *path, size_t ringSize = LLBC_CFG_COMM_DFT_SHM_RING_SIZE) = 0;
+
+    /**
+     * Establishes a local channel to a same process service, local channel not use socket:
+     *  - Send packet to local channel session will hand over the packet object to peer service
+     *    directly, not encode, not pass the protocol stack, not copy to kernel.
+     *  - The packet's encoder will be used as peer service's decoder only if both services registered
+     *    same coder factory class for the opcode, otherwise the encoder will encode the packet before
+     *    deliver, peer service read packet payload(or decode it by peer service's coder).
+     *  - Both services will receive session create event, RemoveSession() on any side will
+     *    remove both sides' sessions, service stop will remove all its local channels.
+     *  - Send/Multicast/Broadcast/Subscribe semantics same as socket sessions.
+     * @param[in] svcId - the peer service Id, the peer service must started and managed by service manager.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectLocal(int svcId) = 0;
+
     /**
      * Send packet.
      * Note: 
      *      no matter this method success or not, packet will be managed by this call,
      *      it means no matter this call success or not, delete packet operation will
      *      execute by llbc framework.
+     *      Send methods not hold service lock, packet encode(ICoder::Encode()) and Codec-Layer
+     *      protocol filter run in caller thread, if send in multi threads, they must be thread-safe.
      * @param[in] packet - the packet.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -421,12 +605,25 @@ public:
 
     /**
      * Set protocol filter to service's specified protocol layer.
+     * Note: Codec-Layer filter's send filter run in Send() caller threads, see Send().
      * @param[in] filter  - the protocol filter.
      * @param[in] toLayer - which layer will add to.
      * @return int - return 0 if success, otherwise return -1.
      */
     virtual int SetProtocolFilter(LLBC_IProtocolFilter *filter, int toLayer) = 0;
 
+    /**
+     * Set packet payload compressor to service, only available in Normal type service.
+     * Note: Service will take over the compressor factory, and peer must use the same compressor.
+     *       Compressed packet marked by the highest bit of header flags part, this bit is reserved
+     *       by library only after compressor set, see LLBC_Packet::GetFlags().
+     * @param[in] factory   - the compressor factory.
+     * @param[in] threshold - the compress threshold, payload length less than it will not compress.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetCompressor(LLBC_ICompressorFactory *factory,
+                              size_t threshold = LLBC_CFG_COMM_DFT_COMPRESS_THRESHOLD) = 0;
+
 public:
     /**
      * Enable/Disable timer scheduler.
@@ -34,7 +34,7 @@ inline int LLBC_IService::Send2(int sessionId, int opcode, const T &data, int st
 template <typename T>
 inline int LLBC_IService::Send2(int svcId, int sessionId, int opcode, const T &data, int status, LLBC_PacketHeaderParts *parts)
 {
-    LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+    LLBC_Packet *packet = LLBC_PacketPool::Acquire();
     packet->SetHeader(svcId, sessionId, opcode, status);
     if (parts)
     {
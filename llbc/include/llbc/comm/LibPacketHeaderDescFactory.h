@@ -28,6 +28,7 @@ __LLBC_NS_BEGIN
  *   | ServiceId |    8   |   4  |
  *   |   Flags   |   12   |   2  |
  *Header total length: 14 bytes.
+ *The compile-time layout of this header is LLBC_LibPacketHeaderLayout, if modify the format, must sync modify it.
  */
 class LLBC_EXPORT LLBC_LibPacketHeaderDescFactory : public LLBC_IPacketHeaderDescFactory
 {
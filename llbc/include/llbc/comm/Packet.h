@@ -13,12 +13,15 @@
 #include "llbc/core/Core.h"
 #include "llbc/objbase/ObjBase.h"
 
+#include "llbc/comm/PacketPool.h"
+
 /**
  * Pre-declare some classes.
  */
 __LLBC_NS_BEGIN
 class LLBC_ICoder;
 class LLBC_Session;
+class LLBC_PacketPool;
 class LLBC_PacketHeaderDesc;
 __LLBC_NS_END
 
@@ -90,6 +93,8 @@ public:
 
     /**
      * Get packet flags.
+     * Note: If service set compressor, the highest bit of header flags part is used to mark
+     *       payload compressed(see IsPayloadCompressed()), user flags can't use it in this service.
      * @return int - the packet flags.
      */
     int GetFlags() const;
@@ -118,6 +123,19 @@ public:
      */
     void RemoveFlags(int flags);
 
+    /**
+     * Check packet payload is compressed or not, the compressed mark is the highest bit of
+     * header flags part, only meaningful in the service which set compressor.
+     * @return bool - return true if payload compressed, otherwise return false.
+     */
+    bool IsPayloadCompressed() const;
+
+    /**
+     * Set packet payload compressed mark, only use by Compress-Layer protocol.
+     * @param[in] compressed - the compressed flag.
+     */
+    void SetPayloadCompressed(bool compressed);
+
 public:
     /**
      * Get special header part value APIs.
@@ -334,6 +352,30 @@ public:
      */
     size_t GetPayloadLength() const;
 
+    /**
+     * Replace payload data, header keep unchanged, and read position will reset to payload begin.
+     * @param[in] buf - the new payload data.
+     * @param[in] len - the new payload length.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetPayload(const void *buf, size_t len);
+
+    /**
+     * Replace payload data to shared payload block(zero copy), the packet will hold a shared
+     * view of the payload block, the payload block's buffer freed when last view deleted.
+     * Normally use to send same payload to multi sessions, packet can't write more payload data
+     * after shared payload set.
+     * @param[in] payload - the payload block, must not empty.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetSharedPayload(LLBC_MessageBlock *payload);
+
+    /**
+     * Check this packet payload is shared or not.
+     * @return bool - shared flag.
+     */
+    bool IsPayloadShared() const;
+
 public:
     /**
      * Get encoder.
@@ -376,7 +418,8 @@ public:
 
 public:
     /**
-     * Giveup the message block.
+     * Giveup the message block, if payload is shared, will return header block and shared
+     * payload block chain(linked by next pointer).
      * @return LLBC_MessageBlock * - message block.
      */
     LLBC_MessageBlock *GiveUp();
@@ -406,6 +449,13 @@ public:
     void Decode();
 
 private:
+    /**
+     * Get the compressed flag mask, the highest bit of flags part and all upper bits
+     * (sign extended when get the part value).
+     * @return int - the compressed flag mask, if header has no flags part, return 0.
+     */
+    int GetCompressedFlagMask() const;
+
     /**
      * Raw get header part value from packet.
      * @param[in] serialNo - the serial number.
@@ -469,10 +519,45 @@ private:
      */
     void CleanupPreHandleResult();
 
+    /**
+     * Reset packet to empty state when release to packet pool, header block keep, shared
+     * payload, coders, status desc and pre-handle result will be freed.
+     */
+    void Reset();
+
+    /**
+     * Reset packet header block when acquire from packet pool, if block given up or freed,
+     * create new block.
+     * @param[in] minSize - the min block size(include header).
+     */
+    void ResetBlock(size_t minSize);
+
+    /**
+     * Prepare packet to deliver to same process service by local channel, packet will not
+     * be given up: copy the shared payload into header block and fill the length part.
+     */
+    void PrepareLocalDeliver();
+
+    /**
+     * Update the length part by header block data, use for local channel delivery, packet
+     * payload maybe changed after length part filled(eg: encode by receiver service).
+     */
+    void UpdateLengthPart();
+
+    /**
+     * Hand over encoder to decoder, use for local channel delivery, the encoder already
+     * hold the data, so receiver service can use it as decoder directly.
+     */
+    void HandOverEncoder();
+
+    friend class LLBC_PacketPool;
+    friend class LLBC_Service;
+
 private:
     const LLBC_PacketHeaderDesc *_headerDesc;
     const size_t _lenSize;
     const size_t _lenOffset;
+    const bool _staticLayout;
 
 private:
     int _sessionId;
@@ -489,6 +574,10 @@ private:
     LLBC_IDelegate1<void *> *_resultClearDeleg;
 
     LLBC_MessageBlock *_block;
+    LLBC_MessageBlock *_sharedPayload;
+
+    LLBC_PacketPool *_pool;
+    LLBC_Packet *_poolNext;
 };
 
 __LLBC_NS_END
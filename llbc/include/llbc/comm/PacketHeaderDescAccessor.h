@@ -44,6 +44,12 @@ public:
      */
     static int SetPacketDesc(LLBC_PacketHeaderDesc *headerDesc);
 
+    /**
+     * Check the packet header describe is match the compile-time header layout(LLBC_LibPacketHeaderLayout) or not.
+     * @return bool - return true if match, otherwise return false.
+     */
+    static bool IsStaticLayout();
+
 public:
     /**
      * Cleanup the packet header describe.
@@ -52,6 +58,7 @@ public:
 
 private:
     static LLBC_PacketHeaderDesc *_headerDesc;
+    static bool _staticLayout;
 };
 
 __LLBC_NS_END
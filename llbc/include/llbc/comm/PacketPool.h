@@ -0,0 +1,203 @@
+/**
+ * @file    PacketPool.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The per-thread packet pool.
+ */
+#ifndef __LLBC_COMM_PACKET_POOL_H__
+#define __LLBC_COMM_PACKET_POOL_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+/**
+ * Pre-declare some classes.
+ */
+__LLBC_NS_BEGIN
+class LLBC_Packet;
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The per-thread packet pool class encapsulation.
+ *        Service and poller threads attach a pool to thread when startup, idle packets(with
+ *        their header/payload block) linked by packet's pool next pointer, reuse without
+ *        construct/destruct, only reset packet header and the pre-handle result, coders, etc.
+ *        Packet always return to the pool which create it(owner pool):
+ *          - Release in owner thread: link to owner pool idle list directly.
+ *          - Release in other thread: reset packet, hold in releasing thread's pending return
+ *            batch, when batch full(LLBC_CFG_COMM_PACKET_POOL_RETURN_BATCH_SIZE), return whole
+ *            batch to owner pool with one lock, owner pool reclaim returned packets when its idle
+ *            list empty.
+ *          - Release in no pool attached thread: return to owner pool immediately.
+ *        Non-pooled packets(eg: user LLBC_New(LLBC_Packet) packets) will be adopted by releasing
+ *        thread's pool, if releasing thread no pool attached, delete it.
+ *        Owner thread detached pool will be deleted after all its packets deleted.
+ *        If no pool attached, Acquire() just allocate new packet.
+ */
+class LLBC_EXPORT LLBC_PacketPool
+{
+public:
+    /**
+     * Attach packet pool to current thread, support nested attach, if current thread already
+     * attached, just add the attach count.
+     * @return LLBC_PacketPool * - the current thread packet pool.
+     */
+    static LLBC_PacketPool *Attach();
+
+    /**
+     * Detach packet pool from current thread, when attach count reach 0, all idle packets
+     * and pending return batches will be freed/returned.
+     */
+    static void Detach();
+
+    /**
+     * Get current thread attached packet pool.
+     * @return LLBC_PacketPool * - the packet pool, if not attach, return NULL.
+     */
+    static LLBC_PacketPool *GetThreadPool();
+
+public:
+    /**
+     * Acquire an empty packet, if current thread attached pool, acquire from pool.
+     * @return LLBC_Packet * - the empty packet.
+     */
+    static LLBC_Packet *Acquire();
+
+    /**
+     * Release packet, packet will return to its owner pool.
+     * @param[in] packet - the packet, allow NULL.
+     */
+    static void Release(LLBC_Packet *packet);
+
+    /**
+     * Return current thread all pending return batches to its owner pools, normally call
+     * this method at every frame/loop end.
+     */
+    static void FlushReturns();
+
+public:
+    /**
+     * Get the idle packets count.
+     * @return size_t - the idle packets count(not include the returned but not reclaimed packets).
+     */
+    size_t GetIdleCount() const;
+
+    /**
+     * Get the acquire count.
+     * @return uint64 - the acquire count.
+     */
+    uint64 GetAcquireCount() const;
+
+    /**
+     * Get the hit count(acquire packet from idle list or returned packets).
+     * @return uint64 - the hit count.
+     */
+    uint64 GetHitCount() const;
+
+    /**
+     * Get the hit rate.
+     * @return double - the hit rate, in [0.0, 1.0], if never acquire, return 0.0.
+     */
+    double GetHitRate() const;
+
+    /**
+     * Get the release count(include other pool created packets).
+     * @return uint64 - the release count.
+     */
+    uint64 GetReleaseCount() const;
+
+    /**
+     * Get the other pool created packets release count.
+     * @return uint64 - the foreign release count.
+     */
+    uint64 GetForeignReleaseCount() const;
+
+    /**
+     * Get the returned batches count(return foreign packets to their owner pools).
+     * @return uint64 - the return batches count.
+     */
+    uint64 GetReturnBatchCount() const;
+
+    /**
+     * Get the freed packets count(pool full while releasing/reclaiming).
+     * @return uint64 - the freed packets count.
+     */
+    uint64 GetFreeCount() const;
+
+private:
+    /**
+     * The pending return batch, packets linked by packet's pool next pointer.
+     */
+    struct _Batch
+    {
+        LLBC_PacketPool *owner;
+        LLBC_Packet *head;
+        LLBC_Packet *tail;
+        size_t count;
+    };
+
+    LLBC_PacketPool();
+    ~LLBC_PacketPool();
+
+    /**
+     * Acquire/Release packet in owner thread.
+     */
+    LLBC_Packet *AcquireIdle();
+    void ReleaseIdle(LLBC_Packet *packet);
+
+    /**
+     * Reclaim all returned packets to idle list.
+     */
+    void Reclaim();
+
+    /**
+     * Hold other pool created packet to pending return batch.
+     */
+    void HoldForeign(LLBC_Packet *packet);
+
+    /**
+     * Return pending batch to its owner pool, and clear the batch.
+     */
+    static void ReturnBatch(_Batch &batch);
+
+    /**
+     * Add/Remove pool reference, the references held by owner thread and all its created packets,
+     * packet destructor will unref its owner pool.
+     */
+    void AddRef();
+    void Unref();
+
+    friend class LLBC_Packet;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_PacketPool);
+
+private:
+    int _attachCount;
+    volatile sint32 _refCount;
+
+    LLBC_Packet *_idle;
+    size_t _idleCount;
+
+    LLBC_SpinLock _returnedLock;
+    bool _detached;
+    LLBC_Packet *_returned;
+    volatile size_t _returnedCount;
+
+    _Batch _batches[LLBC_CFG_COMM_PACKET_POOL_MAX_RETURN_BATCHES];
+
+    uint64 _acquireCount;
+    uint64 _hitCount;
+    uint64 _releaseCount;
+    uint64 _foreignReleaseCount;
+    uint64 _returnBatchCount;
+    uint64 _freeCount;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_PACKET_POOL_H__
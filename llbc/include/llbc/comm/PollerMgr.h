@@ -22,6 +22,7 @@ class LLBC_Packet;
 class LLBC_Socket;
 class LLBC_IService;
 class LLBC_BasePoller;
+class LLBC_Service;
 
 __LLBC_NS_END
 
@@ -49,6 +50,63 @@ public:
      */
     void SetService(LLBC_IService *svc);
 
+    /**
+     * Check pollers use integrated event loop or not.
+     * @return bool - the integrated event loop flag.
+     */
+    bool IsIntegratedLoop() const;
+
+    /**
+     * Set pollers use integrated event loop or not, must call before poller manager start.
+     * @param[in] integrated - the integrated event loop flag.
+     */
+    void SetIntegratedLoop(bool integrated);
+
+    /**
+     * Check pollers use reuse port listen or not.
+     * @return bool - the reuse port listen flag.
+     */
+    bool IsReusePortListen() const;
+
+    /**
+     * Set pollers use reuse port listen or not, must call before poller manager start.
+     * @param[in] reusePort - the reuse port listen flag.
+     */
+    void SetReusePortListen(bool reusePort);
+
+    /**
+     * Get the session send buffer high water mark.
+     * @return size_t - the high water mark, in bytes, 0 means unlimited.
+     */
+    size_t GetSendBufHighWaterMark() const;
+
+    /**
+     * Set the session send buffer high water mark, must call before poller manager start.
+     * @param[in] mark - the high water mark, in bytes, 0 means unlimited.
+     */
+    void SetSendBufHighWaterMark(size_t mark);
+
+    /**
+     * Check pollers use send coalescing or not.
+     * @return bool - the send coalescing flag.
+     */
+    bool IsSendCoalescing() const;
+
+    /**
+     * Set pollers use send coalescing or not, must call before poller manager start.
+     * @param[in] coalescing - the send coalescing flag.
+     * @param[in] maxDelay   - the max delay, in milli-seconds.
+     * @param[in] maxBytes   - the max coalesced bytes per session.
+     */
+    void SetSendCoalescing(bool coalescing, int maxDelay, size_t maxBytes);
+
+    /**
+     * Get all pollers send statistics.
+     * @param[out] sentPackets  - the sent packets count.
+     * @param[out] sendSyscalls - the send syscalls count.
+     */
+    void GetSendStats(uint64 &sentPackets, uint64 &sendSyscalls) const;
+
 public:
     /**
      * Startup poller manager.
@@ -91,6 +149,47 @@ public:
      */
     int AsyncConn(const char *ip, uint16 port);
 
+    /**
+     * Listen in specified unix domain socket path(call by service), Non-WIN32 platform specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - the new session Id, if return 0, means listen failed.
+     *               BE CAREFUL: the return value is a SESSION ID, not error indicator value!!!!!!!!
+     */
+    int ListenUnix(const char *path);
+
+    /**
+     * Connect to unix domain socket path(call by service), Non-WIN32 platform specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - the new session Id, if return 0, means connect failed.
+     *               BE CAREFUL: the return value is a SESSION ID, not error indicator value!!!!!!!!
+     */
+    int ConnectUnix(const char *path);
+
+    /**
+     * Listen in specified shared-memory channel path(call by service), LINUX platform and EpollPoller specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - the new session Id, if return 0, means listen failed.
+     *               BE CAREFUL: the return value is a SESSION ID, not error indicator value!!!!!!!!
+     */
+    int ListenShm(const char *path);
+
+    /**
+     * Connect to shared-memory channel path(call by service), LINUX platform and EpollPoller specific,
+     * blocking until channel handshake finished, not access any poller manager state, so service
+     * can call it without lock, then call AddConnectedSocket() to add the socket to poller.
+     * @param[in] path     - the socket path, if begin with '@', means abstract namespace address.
+     * @param[in] ringSize - the ring size, in bytes, per direction.
+     * @return LLBC_Socket * - the connected socket, if return NULL, means connect failed.
+     */
+    LLBC_Socket *ConnectShm(const char *path, size_t ringSize);
+
+    /**
+     * Add connected socket to poller(call by service).
+     * @param[in] sock - the connected socket, poller manager take over it.
+     * @return int - the new session Id.
+     */
+    int AddConnectedSocket(LLBC_Socket *sock);
+
     /**
      * Send packet.
      * @param[in] packet - the packet.
@@ -99,18 +198,33 @@ public:
     int Send(LLBC_Packet *packet);
 
     /**
-     * Close session.
+     * Close session, if session is reuse port listen session(Listen() returned), all other
+     * pollers' sibling listen sessions will be closed too.
      * @param[in] sessionId - the session Id.
      */
     void Close(int sessionId);
 
 private:
     /**
-     * Allocate new session Id, call by self or Poller.
+     * Allocate new session Id, call by self, Poller or Service(local channel sessions).
      * @return int - the new session Id.
      */
     int AllocSessionId();
 
+    /**
+     * Allocate new session Id which dispatch to specific poller, call by Poller.
+     * @param[in] pollerId - the poller Id.
+     * @return int - the new session Id.
+     */
+    int AllocSessionId(int pollerId);
+
+    /**
+     * Create reuse port listen sockets for all pollers except the given listen session's poller.
+     * @param[in] sessionId - the first listen session Id.
+     * @param[in] local     - the listen address.
+     */
+    void ListenOnOtherPollers(int sessionId, const LLBC_SockAddr_IN &local);
+
     /**
      * Push specific message to poller, call by Poller.
      * @param[in] id    - the poller Id.
@@ -136,10 +250,17 @@ private:
      * Friend classes.
      */
     friend class LLBC_BasePoller;
+    friend class LLBC_Service;
 
 private:
     int _type;
     LLBC_IService *_svc;
+    bool _integratedLoop;
+    bool _reusePortListen;
+    size_t _sendBufHighWaterMark;
+    bool _sendCoalescing;
+    int _sendCoalesceMaxDelay;
+    size_t _sendCoalesceMaxBytes;
 
     int _pollerCount;
     LLBC_BasePoller **_pollers;
@@ -152,6 +273,12 @@ private:
 
     typedef std::map<int, LLBC_SockAddr_IN> _PendingAsyncConns;
     _PendingAsyncConns _pendingAsyncConns;
+
+    typedef std::map<int, LLBC_SockAddr_IN> _PendingReusePortListens;
+    _PendingReusePortListens _pendingReusePortListens;
+
+    typedef std::map<int, std::vector<int> > _ReusePortSiblings;
+    _ReusePortSiblings _reusePortSiblings;
 };
 
 __LLBC_NS_END
@@ -15,7 +15,9 @@
 
 #include "llbc/comm/IService.h"
 #include "llbc/comm/ServiceEvent.h"
+#include "llbc/comm/ServiceMetrics.h"
 #include "llbc/comm/PollerMgr.h"
+#include "llbc/comm/DispatchTable.h"
 #if !LLBC_CFG_COMM_USE_FULL_STACK
 #include "llbc/comm/protocol/ProtocolStack.h"
 #endif
@@ -75,6 +77,105 @@ public:
      */
     virtual int SetDriveMode(DriveMode mode);
 
+    /**
+     * Check the service pollers use integrated event loop or not.
+     * @return bool - return true if use integrated event loop, otherwise return false.
+     */
+    virtual bool IsPollerIntegratedLoop() const;
+
+    /**
+     * Set the service pollers use integrated event loop or not, must call before service start.
+     * @param[in] integrated - the integrated event loop flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerIntegratedLoop(bool integrated);
+
+    /**
+     * Check the service use reuse port listen or not.
+     * @return bool - return true if use reuse port listen, otherwise return false.
+     */
+    virtual bool IsReusePortListen() const;
+
+    /**
+     * Set the service use reuse port listen or not, must call before service start.
+     * @param[in] reusePort - the reuse port listen flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetReusePortListen(bool reusePort);
+
+    /**
+     * Check the service use event-driven wakeup or not.
+     * @return bool - return true if use event-driven wakeup, otherwise return false.
+     */
+    virtual bool IsEventDriven() const;
+
+    /**
+     * Set the service use event-driven wakeup or not, must call before service start.
+     * @param[in] eventDriven   - the event-driven flag.
+     * @param[in] facadesUpdate - the facades need frame ticks or not, default is true.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetEventDriven(bool eventDriven, bool facadesUpdate = true);
+
+    /**
+     * Check the service decode packets in poller threads or not.
+     * @return bool - return true if decode in poller threads, otherwise return false.
+     */
+    virtual bool IsPollerDecode() const;
+
+    /**
+     * Set the service decode packets in poller threads or not, must call before service start.
+     * @param[in] pollerDecode - the poller decode flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetPollerDecode(bool pollerDecode);
+
+    /**
+     * Get the session send buffer high water mark.
+     * @return size_t - the high water mark, in bytes, 0 means unlimited.
+     */
+    virtual size_t GetSendBufHighWaterMark() const;
+
+    /**
+     * Set the session send buffer high water mark, must call before service start.
+     * @param[in] mark - the high water mark, in bytes, 0 means unlimited.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendBufHighWaterMark(size_t mark);
+
+    /**
+     * Check the service sessions use send coalescing or not.
+     * @return bool - return true if use send coalescing, otherwise return false.
+     */
+    virtual bool IsSendCoalescing() const;
+
+    /**
+     * Set the service sessions use send coalescing or not, must call before service start.
+     * @param[in] coalescing - the send coalescing flag.
+     * @param[in] maxDelay   - the max delay, in milli-seconds.
+     * @param[in] maxBytes   - the max coalesced bytes per session.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetSendCoalescing(bool coalescing,
+                                  int maxDelay = LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_DELAY,
+                                  size_t maxBytes = LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES);
+
+    /**
+     * Get the service send statistics.
+     * @param[out] sentPackets  - the sent packets count.
+     * @param[out] sendSyscalls - the send syscalls count.
+     */
+    virtual void GetSendStats(uint64 &sentPackets, uint64 &sendSyscalls) const;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Get the service metrics sampler group, not thread-safe, only can access in service thread
+     * or after service stopped, see IService::GetMetrics().
+     * @return const LLBC_SamplerGroup & - the metrics sampler group.
+     */
+    virtual const LLBC_SamplerGroup &GetMetrics() const;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 public:
     /**
      * Startup service, default will startup one poller to work.
@@ -149,12 +250,53 @@ public:
      */
     virtual int AsyncConn(const char *ip, uint16 port);
 
+    /**
+     * Create a unix domain socket session and listening, Non-WIN32 platform specific.
+     * Note:
+     *      Unix domain socket sessions use same poller, session and protocol stack as
+     *      tcp sessions, but session local/peer address always be 0.0.0.0:0.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address(LINUX/ANDROID).
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ListenUnix(const char *path);
+
+    /**
+     * Establishes a unix domain socket connection to a specified path, Non-WIN32 platform specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address(LINUX/ANDROID).
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectUnix(const char *path);
+
+    /**
+     * Create a shared-memory channel listen session, LINUX platform and EpollPoller specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ListenShm(const char *path);
+
+    /**
+     * Establishes a shared-memory channel to a specified path, LINUX platform and EpollPoller specific.
+     * @param[in] path     - the socket path, if begin with '@', means abstract namespace address.
+     * @param[in] ringSize - the ring size, in bytes, per direction.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectShm(const char *path, size_t ringSize = LLBC_CFG_COMM_DFT_SHM_RING_SIZE);
+
+    /**
+     * Establishes a local channel to a same process service.
+     * @param[in] svcId - the peer service Id, the peer service must started and managed by service manager.
+     * @return int - the new session Id, if return 0, means failed, see LLBC_GetLastError().
+     */
+    virtual int ConnectLocal(int svcId);
+
     /**
      * Send packet.
      * Note: 
      *      no matter this method success or not, packet will be managed by this call,
      *      it means no matter this call success or not, delete packet operation will
      *      execute by llbc framework.
+     *      all send methods are lock free(except connected session Id shard lock), can
+     *      call in multi threads concurrently, packets encode in the caller thread.
      * @param[in] packet - the packet.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -320,6 +462,16 @@ public:
      */
     virtual int SetProtocolFilter(LLBC_IProtocolFilter *filter, int toLayer);
 
+    /**
+     * Set packet payload compressor to service, only available in Normal type service.
+     * Note: Service will take over the compressor factory, and peer must use the same compressor.
+     * @param[in] factory   - the compressor factory.
+     * @param[in] threshold - the compress threshold, payload length less than it will not compress.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int SetCompressor(LLBC_ICompressorFactory *factory,
+                              size_t threshold = LLBC_CFG_COMM_DFT_COMPRESS_THRESHOLD);
+
 public:
     /**
      * Enable/Disable timer scheduler.
@@ -392,6 +544,7 @@ private:
     void AddServiceToTls();
     void RemoveServiceFromTls();
     bool IsCanContinueDriveService();
+    bool IsInDriveThread() const;
 
     /**
      * Frame tasks operation methods.
@@ -404,11 +557,16 @@ private:
      * Queued event operation methods.
      */
     void HandleQueuedEvents();
+    void HandleEvent(LLBC_MessageBlock *block);
+    void WaitEvents();
+    void WakeupEvents();
     void HandleEv_SessionCreate(LLBC_ServiceEvent &ev);
     void HandleEv_SessionDestroy(LLBC_ServiceEvent &ev);
     void HandleEv_AsyncConnResult(LLBC_ServiceEvent &ev);
     void HandleEv_DataArrival(LLBC_ServiceEvent &ev);
+    bool DispatchPacket(LLBC_Packet *packet, bool local);
     void HandleEv_ProtoReport(LLBC_ServiceEvent &ev);
+    void HandleEv_PollerMetrics(LLBC_ServiceEvent &ev);
     void HandleEv_SubscribeEv(LLBC_ServiceEvent &ev);
     void HandleEv_UnsubscribeEv(LLBC_ServiceEvent &ev);
     void HandleEv_FireEv(LLBC_ServiceEvent &ev);
@@ -438,13 +596,27 @@ private:
      */
     void ProcessIdle();
 
+    /**
+     * Build the packet dispatch tables from registered handlers, call before service started.
+     */
+    void BuildDispatchTables();
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    /**
+     * Metrics operation methods.
+     */
+    int InitMetrics(int pollerCount);
+    LLBC_ISampler *AddMetricsSampler(int type, const LLBC_String &name);
+    void UpdateMetrics(sint64 frameBegTime);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 private:
     /**
      * Internal helper methods.
      */
     int LockableSend(LLBC_Packet *packet,
-                     bool lock = true,
                      bool validCheck = true);
+    void FinishSending();
     int LockableSend(int svcId,
                      int sessionId,
                      int opcode,
@@ -452,8 +624,32 @@ private:
                      size_t len,
                      int status,
                      const LLBC_PacketHeaderParts *parts = NULL,
-                     bool lock = true,
                      bool validCheck = true);
+    int LockableSend(int svcId,
+                     int sessionId,
+                     int opcode,
+                     LLBC_MessageBlock *payload,
+                     int status,
+                     const LLBC_PacketHeaderParts *parts = NULL,
+                     bool validCheck = true);
+
+    /**
+     * Connected session Ids sharded set operation methods, all methods are thread-safe.
+     */
+    void AddConnectedSessionId(int sessionId);
+    bool RemoveConnectedSessionId(int sessionId);
+    bool IsSessionConnected(int sessionId);
+    void GetConnectedSessionIds(LLBC_SessionIdList &sessionIds);
+    void ClearConnectedSessionIds();
+
+    /**
+     * Local channel operation methods, all local channels guard by one static lock,
+     * peer service pointer only use when hold the lock or hold peer's delivering count.
+     */
+    bool LocalSend(LLBC_Packet *packet, int &ret);
+    int LocalRecvCodec(LLBC_Packet *packet);
+    bool RemoveLocalChannel(int sessionId);
+    void CloseLocalChannels();
 
     template <typename SessionIds>
     int MulticastSendCoder(int svcId,
@@ -469,8 +665,11 @@ private:
     volatile int _id;
     DriveMode _driveMode;
 
-    volatile bool _started;
+    volatile sint32 _started;
     volatile bool _stopping;
+    volatile sint32 _sendingCount;
+    LLBC_SimpleLock _sendingLock;
+    LLBC_ConditionVariable _sendingCond;
 
     LLBC_RecursiveLock _lock;
 
@@ -481,11 +680,31 @@ private:
     volatile bool _sinkIntoLoop;
     volatile bool _afterStop;
 
+    bool _eventDriven;
+    bool _facadesUpdate;
+    sint64 _nextFrameTime;
+    bool _pollerDecode;
+
 private:
     LLBC_PollerMgr _pollerMgr;
     
-    LLBC_SessionIdSet _connectedSessionIds;
-    LLBC_SpinLock _connectedSessionIdsLock;
+    struct _ConnectedSessionIds
+    {
+        LLBC_SpinLock lock;
+        LLBC_SessionIdSet sessionIds;
+    };
+    _ConnectedSessionIds _connectedSessionIds[LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS];
+
+    struct _LocalChannel
+    {
+        LLBC_Service *peer;
+        int peerSessionId;
+    };
+    typedef std::map<int, _LocalChannel> _LocalChannels;
+    _LocalChannels _localChannels;
+    volatile sint32 _localChannelCount;
+    volatile sint32 _localDeliveringCount;
+    static LLBC_SpinLock _localChannelsLock;
 
 #if !LLBC_CFG_COMM_USE_FULL_STACK
     LLBC_ProtocolStack _stack;
@@ -495,10 +714,13 @@ private:
     _Facades _facades;
     typedef std::map<int, LLBC_ICoderFactory *> _Coders;
     _Coders _coders;
+    LLBC_DispatchTable<int, LLBC_ICoderFactory> _coderTable;
     typedef std::map<int, LLBC_IDelegate1<LLBC_Packet &> *> _Handlers;
     _Handlers _handlers;
+    LLBC_DispatchTable<int, LLBC_IDelegate1<LLBC_Packet &> > _handlerTable;
     typedef std::map<int, LLBC_IDelegateEx<LLBC_Packet &> *> _PreHandlers;
     _PreHandlers _preHandlers;
+    LLBC_DispatchTable<int, LLBC_IDelegateEx<LLBC_Packet &> > _preHandlerTable;
 #if LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
     LLBC_IDelegateEx<LLBC_Packet &> *_unifyPreHandler;
 #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
@@ -506,14 +728,19 @@ private:
     typedef std::map<int, LLBC_IDelegate1<LLBC_Packet &> *> _StatusHandlers;
     typedef std::map<int, _StatusHandlers *> _OpStatusHandlers;
     _OpStatusHandlers _statusHandlers;
+    LLBC_DispatchTable<sint64, LLBC_IDelegate1<LLBC_Packet &> > _statusHandlerTable;
 #endif // LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
 #if LLBC_CFG_COMM_ENABLE_STATUS_DESC
     typedef std::map<int, LLBC_String> _StatusDescs;
     _StatusDescs _statusDescs;
+    LLBC_DispatchTable<int, LLBC_String> _statusDescTable;
 #endif // LLBC_CFG_COMM_ENABLE_STATUS_DESC
 
     LLBC_IProtocolFilter *_filters[LLBC_ProtocolLayer::End];
 
+    LLBC_ICompressorFactory *_compressorFactory;
+    size_t _compressThreshold;
+
 private:
     _FrameTasks _beforeFrameTasks;
     _FrameTasks _afterFrameTasks;
@@ -531,6 +758,15 @@ private:
 private:
     LLBC_EventManager _evManager;
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+private:
+    LLBC_SamplerGroup _metrics;
+    time_t _metricsUpdateTime;
+    LLBC_ISampler *_svcSamplers[LLBC_SvcMetrics::End];
+    std::vector<LLBC_ISampler *> _pollerSamplers;
+    LLBC_DispatchTable<int, LLBC_ISampler> _handlerSamplerTable;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 private:
     LLBC_ServiceMgr &_svcMgr;
 
@@ -40,6 +40,7 @@ public:
         AsyncConnResult,
         DataArrival,
         ProtoReport,
+        PollerMetrics,
 
         SubscribeEv,
         UnsubscribeEv,
@@ -103,10 +104,14 @@ struct LLBC_HIDDEN LLBC_SvcEv_AsyncConn : public LLBC_ServiceEvent
 
 /**
  * \brief The data-arrival event structure enapsulation.
+ *        One event carry all packets decoded from one session recv.
+ *        Local channel event's packets come from same process service directly,
+ *        not pass the protocol stack.
  */
 struct LLBC_HIDDEN LLBC_SvcEv_DataArrival : public LLBC_ServiceEvent
 {
-    LLBC_Packet *packet;
+    std::vector<LLBC_Packet *> packets;
+    bool local;
 
     LLBC_SvcEv_DataArrival();
     virtual ~LLBC_SvcEv_DataArrival();
@@ -127,6 +132,28 @@ struct LLBC_HIDDEN LLBC_SvcEv_ProtoReport : public LLBC_ServiceEvent
     virtual ~LLBC_SvcEv_ProtoReport();
 };
 
+/**
+ * \brief The poller-metrics event structure encapsulation.
+ *        Poller report per second, all counts are increments since last report.
+ */
+struct LLBC_HIDDEN LLBC_SvcEv_PollerMetrics : public LLBC_ServiceEvent
+{
+    int pollerId;
+
+    uint64 recvPackets;
+    uint64 recvBytes;
+    uint64 sentPackets;
+    uint64 sentBytes;
+
+    size_t maxQueueSize;
+    size_t sendBacklog;
+    size_t maxSessionSendBacklog;
+    int maxSendBacklogSessionId;
+
+    LLBC_SvcEv_PollerMetrics();
+    virtual ~LLBC_SvcEv_PollerMetrics();
+};
+
 /**
  * \brief The subscribe-event event structure encapsulation.
  */
@@ -196,6 +223,17 @@ public:
      */
     static LLBC_MessageBlock *BuildDataArrivalEv(LLBC_Packet *packet);
 
+    /**
+     * Build batched Data-Arrival event, event will take over all packets,
+     * after build, the packets vector will be empty.
+     */
+    static LLBC_MessageBlock *BuildDataArrivalEv(std::vector<LLBC_Packet *> &packets);
+
+    /**
+     * Build local channel Data-Arrival event.
+     */
+    static LLBC_MessageBlock *BuildLocalDataArrivalEv(LLBC_Packet *packet);
+
     /**
      * Build subscribe-event event.
      */
@@ -211,6 +249,19 @@ public:
                                                  int level,
                                                  const LLBC_String &report);
 
+    /**
+     * Build poller-metrics event.
+     */
+    static LLBC_MessageBlock *BuildPollerMetricsEv(int pollerId,
+                                                   uint64 recvPackets,
+                                                   uint64 recvBytes,
+                                                   uint64 sentPackets,
+                                                   uint64 sentBytes,
+                                                   size_t maxQueueSize,
+                                                   size_t sendBacklog,
+                                                   size_t maxSessionSendBacklog,
+                                                   int maxSendBacklogSessionId);
+
     /**
      * Build unsubscribe-event event.
      */
@@ -0,0 +1,81 @@
+/**
+ * @file    ServiceMetrics.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The service metrics(samplers) names define.
+ */
+#ifndef __LLBC_COMM_SERVICE_METRICS_H__
+#define __LLBC_COMM_SERVICE_METRICS_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The service metrics enumeration.
+ *        All metrics samplers held in service's sampler group, sampled in service thread,
+ *        pollers report their metrics to service per second.
+ *        Sampler names:
+ *          service scope: "<Metric>",                 eg: "RecvPackets".
+ *          poller scope:  "Poller<PollerId>.<Metric>", eg: "Poller0.SentBytes".
+ *          handler scope: "HandlerTime.<Opcode>",      eg: "HandlerTime.1001".
+ */
+class LLBC_EXPORT LLBC_SvcMetrics
+{
+public:
+    enum
+    {
+        Begin,
+
+        RecvPackets = Begin,   // IntervalSampler, service/poller scope, received packets.
+        RecvBytes,             // IntervalSampler, service/poller scope, received bytes.
+        SentPackets,           // IntervalSampler, service/poller scope, sent packets.
+        SentBytes,             // IntervalSampler, service/poller scope, sent bytes.
+        QueueSize,             // LimitSampler, service/poller scope, message queue size.
+        FrameTime,             // LimitSampler, service scope, OnSvc() used time(exclude wait time), in micro-seconds.
+        SendBacklog,           // LimitSampler, poller scope, all sessions not send data size, in bytes.
+        MaxSessionSendBacklog, // LimitSampler, poller scope, max session not send data size, last sampling
+                               //               append data is the session Id(cast to void *).
+        HandlerTime,           // LimitSampler, handler scope, opcode handler used time, in micro-seconds.
+
+        End
+    };
+
+public:
+    /**
+     * Check given metric is validate or not.
+     * @param[in] metric - the metric, see above enumeration.
+     * @return bool - return true if validate, otherwise return false.
+     */
+    static bool IsValid(int metric);
+
+    /**
+     * Get metric string representation.
+     * @param[in] metric - the metric, see above enumeration.
+     * @return const LLBC_String & - the metric string representation.
+     */
+    static const LLBC_String &Type2Str(int metric);
+
+    /**
+     * Get service/poller scope metric sampler name.
+     * @param[in] metric   - the metric.
+     * @param[in] pollerId - the poller Id, -1 means service scope.
+     * @return LLBC_String - the sampler name.
+     */
+    static LLBC_String GetSamplerName(int metric, int pollerId = -1);
+
+    /**
+     * Get handler scope metric sampler name.
+     * @param[in] opcode - the opcode.
+     * @return LLBC_String - the sampler name.
+     */
+    static LLBC_String GetHandlerSamplerName(int opcode);
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_SERVICE_METRICS_H__
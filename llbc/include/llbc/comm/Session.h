@@ -113,7 +113,7 @@ public:
 
     /**
      * Send message block.
-     * @param[in] block - the message block.
+     * @param[in] block - the message block(chain), one packet's encoded data.
      * @return int - return 0 if success, otherwise return -1.
      */
     int Send(LLBC_MessageBlock *block);
@@ -149,16 +149,23 @@ public:
     void OnClose();
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+    /**
+     * Flush coalesced send data, call by poller when poller flush dirty sessions.
+     * Note: This method maybe close(delete) session, don't touch session after call.
+     */
+    void FlushSend();
+
 public:
     /**
      * Sent event handler method, call by socket, when has data sent, will call this method.
-     * @param[in] len - data length, in bytes.
+     * @param[in] len       - data length, in bytes.
+     * @param[in] sendCalls - the send syscalls count.
      */
-    void OnSent(size_t len);
+    void OnSent(size_t len, int sendCalls);
 
     /**
      * Received event handler method, call by socket, when data received, will call this metho.
-     * @param[in] block - the data block.
+     * @param[in] block - the data blocks chain(linked by next pointer), only borrowed, caller will recycle it.
      * @return bool - return false if success, otherwise return false(if failed, this method will perform OnClose() op).
      */
     bool OnRecved(LLBC_MessageBlock *block);
@@ -174,6 +181,12 @@ private:
     LLBC_ProtocolStack *_protoStack;
 
     int _pollerType;
+    bool _pollerDecode;
+    bool _sendDirty;
+
+    uint64 _sendQueuedBytes;
+    uint64 _sendSentBytes;
+    std::deque<uint64> _sendPacketEnds;
 };
 
 __LLBC_NS_END
@@ -0,0 +1,188 @@
+/**
+ * @file    ShmChannel.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The shared-memory channel, LINUX platform specific.
+ */
+#ifndef __LLBC_COMM_SHM_CHANNEL_H__
+#define __LLBC_COMM_SHM_CHANNEL_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+#if LLBC_TARGET_PLATFORM_LINUX
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The shared-memory channel class encapsulation.
+ *
+ *        A channel own a POSIX shared-memory segment, the segment contain two lock-free single-producer/
+ *        single-consumer byte rings, one per direction, the rings carry the same bytes stream as socket,
+ *        so the packets still framed/unframed by protocol stack.
+ *        Every channel side own an eventfd doorbell, the peer ring the doorbell only when this side
+ *        waiting data(or waiting ring space), busy channel not need any syscall.
+ *
+ *        The channel segment and the doorbells are exchanged by the unix domain control socket(SCM_RIGHTS),
+ *        the segment will unlink immediately after created, so it never leak, even if process crashed.
+ *        The control socket keep connected during channel lifetime, peer death will be detected by it.
+ */
+class LLBC_EXPORT LLBC_ShmChannel
+{
+public:
+    LLBC_ShmChannel();
+    ~LLBC_ShmChannel();
+
+public:
+    /**
+     * Connector side channel establish, create shared-memory segment and doorbell, and then
+     * handshake with acceptor by control socket, will blocking until handshake finished or timeout.
+     * @param[in] ctrl     - the connected unix domain control socket, must in blocking mode.
+     * @param[in] ringSize - the ring size, in bytes, will round up to power of 2.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Connect(LLBC_SocketHandle ctrl, size_t ringSize);
+
+    /**
+     * Acceptor side channel prepare, create the doorbell, call after control socket accepted.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int PrepareAccept();
+
+    /**
+     * Acceptor side channel establish, receive connector's handshake and reply, not blocking.
+     * @param[in] ctrl - the accepted unix domain control socket.
+     * @return int - return 0 if success, otherwise return -1, if LLBC_GetLastError() is
+     *               LLBC_ERROR_WBLOCK or LLBC_ERROR_AGAIN, means handshake not arrived yet.
+     */
+    int Accept(LLBC_SocketHandle ctrl);
+
+    /**
+     * Check channel is established or not.
+     * @return bool - established flag.
+     */
+    bool IsEstablished() const;
+
+    /**
+     * Check channel is broken or not, the ring positions in shared-memory are out of range
+     * (peer corrupted the segment), caller must close the session.
+     * @return bool - broken flag.
+     */
+    bool IsBroken() const;
+
+    /**
+     * Get the ring size.
+     * @return size_t - the ring size, if channel not established, return 0.
+     */
+    size_t GetRingSize() const;
+
+    /**
+     * Get self doorbell(eventfd), poller will listen it's readable event.
+     * @return LLBC_Handle - the doorbell.
+     */
+    LLBC_Handle GetDoorbell() const;
+
+public:
+    /**
+     * Write data to send ring, as many as possible.
+     * @param[in] data - the data.
+     * @param[in] len  - the data length.
+     * @return size_t - the written bytes, if ring full or channel broken, return 0.
+     */
+    size_t Write(const void *data, size_t len);
+
+    /**
+     * Read data from receive ring, as many as possible.
+     * @param[in] buf - the buffer.
+     * @param[in] len - the buffer length.
+     * @return size_t - the read bytes, if ring empty or channel broken, return 0.
+     */
+    size_t Read(void *buf, size_t len);
+
+    /**
+     * Mark self waiting receive ring readable, and recheck the ring.
+     * @return bool - return true if ring still empty(peer will ring the doorbell when write data),
+     *                otherwise return false, caller must continue read.
+     */
+    bool WaitReadable();
+
+    /**
+     * Mark self waiting send ring writable, and recheck the ring.
+     * @return bool - return true if ring still full(peer will ring the doorbell when read data),
+     *                otherwise return false, caller can continue write.
+     */
+    bool WaitWritable();
+
+    /**
+     * Notify peer data written, only ring peer's doorbell when peer waiting readable.
+     * @return bool - return true if rang the doorbell, otherwise return false.
+     */
+    bool NotifyReader();
+
+    /**
+     * Notify peer data read, only ring peer's doorbell when peer waiting writable.
+     * @return bool - return true if rang the doorbell, otherwise return false.
+     */
+    bool NotifyWriter();
+
+    /**
+     * Ring self doorbell, use to continue process in next poller loop.
+     */
+    void RingSelf();
+
+    /**
+     * Reset self doorbell.
+     */
+    void ResetDoorbell();
+
+private:
+    /**
+     * Map the shared-memory segment and setup rings.
+     * @param[in] shmFd     - the shared-memory fd.
+     * @param[in] ringSize  - the ring size.
+     * @param[in] connector - connector side flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int MapSegment(int shmFd, size_t ringSize, bool connector);
+
+    /**
+     * Create shared-memory segment, the segment already unlinked.
+     * @param[in] segSize - the segment size.
+     * @return int - the shared-memory fd, if failed, return -1.
+     */
+    static int CreateSegment(size_t segSize);
+
+    /**
+     * Get segment size by ring size.
+     */
+    static size_t GetSegmentSize(size_t ringSize);
+
+private:
+    struct _Ring;
+
+    LLBC_Handle _doorbell;
+    LLBC_Handle _peerDoorbell;
+
+    void *_seg;
+    size_t _segSize;
+    size_t _ringSize;
+
+    _Ring *_sendRing;
+    char *_sendData;
+    sint64 _sendCachedReadPos;
+
+    _Ring *_recvRing;
+    char *_recvData;
+    sint64 _recvCachedWritePos;
+
+    bool _broken;
+};
+
+__LLBC_NS_END
+
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+#endif // !__LLBC_COMM_SHM_CHANNEL_H__
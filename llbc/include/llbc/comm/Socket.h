@@ -19,6 +19,7 @@ __LLBC_NS_BEGIN
  * Previous declare some classes.
  */
 class LLBC_Session;
+class LLBC_ShmChannel;
 
 __LLBC_NS_END
 
@@ -118,6 +119,12 @@ public:
      */
     int DisableAddressReusable();
 
+    /**
+     * Enable port reusable option(SO_REUSEPORT).
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int EnablePortReusable();
+
     /**
      * Check the socket blocking flag.
      * @return bool - return true if is non-blocking, 
@@ -177,6 +184,16 @@ public:
     int BindTo(const char *ip, uint16 port);
     int BindTo(const LLBC_SockAddr_IN &addr);
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    /**
+     * Bind unix domain socket to specified path, socket must create by LLBC_CreateUnixSocket(),
+     * Non-WIN32 platform specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int BindToUnix(const char *path);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
     /**
      * places the socket a state where it is listening for an incoming connection.
      * @param[in] backlog - maximum length of the queue of pending connections.
@@ -212,6 +229,57 @@ public:
      */
     int Connect(const LLBC_SockAddr_IN &addr);
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    /**
+     * Establishes a connection to specified unix domain socket path, socket must create by
+     * LLBC_CreateUnixSocket(), Non-WIN32 platform specific.
+     * @param[in] path - the socket path, if begin with '@', means abstract namespace address.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int ConnectToUnix(const char *path);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    /**
+     * Determine this socket is unix domain socket or not, unix domain socket has no ip address,
+     * local/peer address always be 0.0.0.0:0.
+     * @return bool - return true if is unix domain socket, otherwise return false.
+     */
+    bool IsUnix() const;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    /**
+     * Bind unix domain socket to specified path and mark it as shared-memory channel socket,
+     * the accepted sockets will transfer data by shared-memory rings, LINUX platform specific.
+     * @param[in] path - the socket path, see BindToUnix().
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int BindToShm(const char *path);
+
+    /**
+     * Establishes a shared-memory channel to specified shared-memory channel listen path,
+     * socket must create by LLBC_CreateUnixSocket() and in blocking mode, will blocking until
+     * channel handshake finished, LINUX platform specific.
+     * @param[in] path     - the socket path, see ConnectToUnix().
+     * @param[in] ringSize - the channel ring size, in bytes, per direction.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int ConnectToShm(const char *path, size_t ringSize = LLBC_CFG_COMM_DFT_SHM_RING_SIZE);
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+    /**
+     * Determine this socket is shared-memory channel socket or not, shared-memory channel socket
+     * only use to handshake and detect peer death, the data transfer by shared-memory channel.
+     * @return bool - return true if is shared-memory channel socket, otherwise return false.
+     */
+    bool IsShm() const;
+
+    /**
+     * Get the shared-memory channel.
+     * @return LLBC_ShmChannel * - the shared-memory channel, if not shared-memory channel socket
+     *                             or is listen socket, return NULL.
+     */
+    LLBC_ShmChannel *GetShmChannel();
+
 #if LLBC_TARGET_PLATFORM_WIN32
     /**
      * WIN32 specific socket method, connect to peer(asynchronous).
@@ -262,6 +330,30 @@ public:
      */
     bool IsExistNoSendData() const;
 
+    /**
+     * Get the not send data size.
+     * @return size_t - the not send data size, in bytes.
+     */
+    size_t GetNoSendDataSize() const;
+
+    /**
+     * Get the send syscalls count, all OnSend() calls issued send syscalls will be counted.
+     * @return uint64 - the send syscalls count.
+     */
+    uint64 GetSendSyscallCount() const;
+
+    /**
+     * Get the fully sent message blocks count.
+     * @return uint64 - the sent blocks count.
+     */
+    uint64 GetSentBlockCount() const;
+
+    /**
+     * Get the saved send syscalls count by gather send, equal to sent blocks count - send syscalls count.
+     * @return uint64 - the saved send syscalls count.
+     */
+    uint64 GetSavedSendSyscallCount() const;
+
     /**
      * Receive data from a connected socket.
      * @param[in] buf - buffer for the incoming data.
@@ -341,6 +433,14 @@ public:
     void OnRecv();
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+#if LLBC_TARGET_PLATFORM_LINUX
+    /**
+     * Event handle function, shared-memory channel socket specific, when channel doorbell readable,
+     * must call this function to recv data from channel and continue send not send data.
+     */
+    void OnShmWakeup();
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
     /**
      * Event handle function, if socket in event trigger mode, must call this function close socket.
      * @param[in] ol - overlapped, available in WIN32 platform and IOCP poller model.
@@ -390,6 +490,19 @@ private:
     int PostZeroWSARecv();
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+#if LLBC_TARGET_PLATFORM_LINUX
+    /**
+     * Shared-memory channel socket specific, control socket readable event handle method,
+     * finish acceptor side channel handshake, or detect peer closed.
+     */
+    void OnShmCtrlRecv();
+
+    /**
+     * Shared-memory channel socket specific, write not send data to channel.
+     */
+    void OnShmSend();
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
 private:
 
 private:
@@ -399,10 +512,15 @@ private:
     int _pollerType;
 
     bool _listenSocket;
+    bool _unixSocket;
+    bool _shmSocket;
+    LLBC_ShmChannel *_shmChannel;
     LLBC_SockAddr_IN _peerAddr;
     LLBC_SockAddr_IN _localAddr;
 
     LLBC_MessageBuffer _willSend;
+    uint64 _sendSyscallCount;
+    uint64 _sentBlockCount;
 
 #if LLBC_TARGET_PLATFORM_WIN32
     bool _nonBlocking;
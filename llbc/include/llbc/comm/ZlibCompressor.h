@@ -0,0 +1,83 @@
+/**
+ * @file    ZlibCompressor.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The zlib packet payload compressor implement.
+ */
+#ifndef __LLBC_COMM_ZLIB_COMPRESSOR_H__
+#define __LLBC_COMM_ZLIB_COMPRESSOR_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+#include "llbc/comm/ICompressor.h"
+
+/**
+ * Pre-declare zlib stream structure, avoid include zlib header file.
+ */
+struct z_stream_s;
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The zlib compressor class encapsulation.
+ *        Compressed data format: [raw length(4 bytes, net order)][zlib stream].
+ *        The deflate/inflate streams created once and reset before each call.
+ */
+class LLBC_EXPORT LLBC_ZlibCompressor : public LLBC_ICompressor
+{
+public:
+    explicit LLBC_ZlibCompressor(int level = LLBC_CFG_COMM_DFT_ZLIB_COMPRESS_LEVEL);
+    virtual ~LLBC_ZlibCompressor();
+
+public:
+    /**
+     * Compress data, compressed data will append to out block.
+     * @param[in] data - the will compress data.
+     * @param[in] len  - the will compress data length.
+     * @param[out] out - the out block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Compress(const void *data, size_t len, LLBC_MessageBlock &out);
+
+    /**
+     * Decompress data, decompressed data will append to out block.
+     * @param[in] data - the will decompress data.
+     * @param[in] len  - the will decompress data length.
+     * @param[out] out - the out block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Decompress(const void *data, size_t len, LLBC_MessageBlock &out);
+
+private:
+    int _level;
+
+    struct z_stream_s *_deflateStream;
+    struct z_stream_s *_inflateStream;
+};
+
+/**
+ * \brief The zlib compressor factory class encapsulation.
+ */
+class LLBC_EXPORT LLBC_ZlibCompressorFactory : public LLBC_ICompressorFactory
+{
+public:
+    explicit LLBC_ZlibCompressorFactory(int level = LLBC_CFG_COMM_DFT_ZLIB_COMPRESS_LEVEL);
+
+public:
+    /**
+     * Create zlib compressor.
+     * @return LLBC_ICompressor * - compressor.
+     */
+    virtual LLBC_ICompressor *Create() const;
+
+private:
+    int _level;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_COMM_ZLIB_COMPRESSOR_H__
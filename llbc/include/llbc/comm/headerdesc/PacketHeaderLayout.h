@@ -0,0 +1,145 @@
+/**
+ * @file    PacketHeaderLayout.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The compile-time packet header layout describe.
+ */
+#ifndef __LLBC_COMM_PACKET_HEADER_LAYOUT_H__
+#define __LLBC_COMM_PACKET_HEADER_LAYOUT_H__
+
+#include "llbc/common/Common.h"
+#include "llbc/core/Core.h"
+#include "llbc/objbase/ObjBase.h"
+
+#include "llbc/comm/headerdesc/PacketHeaderDesc.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The fixed length header part value codec, only support 0(part not exist), 1, 2, 4, 8 bytes length,
+ *        other lengths will cause compile error.
+ *        2/4 bytes parts use ntohs/ntohl(htons/htonl) to convert byte order, it compile to bswap instruction,
+ *        not depend on runtime machine endian check.
+ */
+template <size_t _Len>
+struct LLBC_PacketHeaderPartCodec;
+
+template <>
+struct LLBC_PacketHeaderPartCodec<0>
+{
+    static int Get(const char *buf);
+    static void Set(char *buf, int val);
+};
+
+template <>
+struct LLBC_PacketHeaderPartCodec<1>
+{
+    static int Get(const char *buf);
+    static void Set(char *buf, int val);
+};
+
+template <>
+struct LLBC_PacketHeaderPartCodec<2>
+{
+    static int Get(const char *buf);
+    static void Set(char *buf, int val);
+};
+
+template <>
+struct LLBC_PacketHeaderPartCodec<4>
+{
+    static int Get(const char *buf);
+    static void Set(char *buf, int val);
+};
+
+template <>
+struct LLBC_PacketHeaderPartCodec<8>
+{
+    static int Get(const char *buf);
+    static void Set(char *buf, int val);
+};
+
+/**
+ * \brief The compile-time packet header part describe, offset and length are constants,
+ *        so part access compiles to fixed offset load/store(and byte order convert).
+ */
+template <size_t _Offset, size_t _Len>
+struct LLBC_PacketHeaderPart
+{
+    enum
+    {
+        Offset = _Offset,
+        Len = _Len,
+        IsExist = (_Len > 0)
+    };
+
+    /**
+     * Get/Set part value from/to header buffer.
+     * @param[in] header - the header buffer begin.
+     * @param[in] val    - the part value.
+     * @return int - the part value, if part not exist, return 0.
+     */
+    static int Get(const void *header);
+    static void Set(void *header, int val);
+
+    /**
+     * Check the runtime header part describe is match this part or not.
+     * @param[in] exist  - the runtime part exist or not.
+     * @param[in] offset - the runtime part offset.
+     * @param[in] len    - the runtime part length.
+     * @return bool - return true if match, otherwise return false.
+     */
+    static bool IsMatch(bool exist, size_t offset, size_t len);
+};
+
+/**
+ * \brief The compile-time packet header layout describe, parts length 0 means part not exist,
+ *        the length part must exist.
+ *        It only used to accelerate LLBC_Packet header parts access, the runtime header describe
+ *        still is the header format standard: if runtime describe not match the layout, packet
+ *        will fallback to use runtime describe to access header parts.
+ */
+template <size_t _LenOffset, size_t _LenLen,
+          size_t _OpcodeOffset, size_t _OpcodeLen,
+          size_t _StatusOffset, size_t _StatusLen,
+          size_t _ServiceIdOffset, size_t _ServiceIdLen,
+          size_t _FlagsOffset, size_t _FlagsLen,
+          size_t _HeaderLen>
+struct LLBC_PacketHeaderLayout
+{
+    typedef LLBC_PacketHeaderPart<_LenOffset, _LenLen> LenPart;
+    typedef LLBC_PacketHeaderPart<_OpcodeOffset, _OpcodeLen> OpcodePart;
+    typedef LLBC_PacketHeaderPart<_StatusOffset, _StatusLen> StatusPart;
+    typedef LLBC_PacketHeaderPart<_ServiceIdOffset, _ServiceIdLen> ServiceIdPart;
+    typedef LLBC_PacketHeaderPart<_FlagsOffset, _FlagsLen> FlagsPart;
+
+    enum
+    {
+        HeaderLen = _HeaderLen
+    };
+
+    /**
+     * Check the runtime header describe is match this layout or not.
+     * @param[in] desc - the runtime header describe.
+     * @return bool - return true if match, otherwise return false.
+     */
+    static bool IsMatch(const LLBC_PacketHeaderDesc *desc);
+};
+
+/**
+ * The llbc library default packet header layout, same as LLBC_LibPacketHeaderDescFactory created header describe.
+ */
+typedef LLBC_PacketHeaderLayout<0, 4,   // Length.
+                                4, 2,   // Opcode.
+                                6, 2,   // Status.
+                                8, 4,   // ServiceId.
+                                12, 2,  // Flags.
+                                14> LLBC_LibPacketHeaderLayout;
+
+__LLBC_NS_END
+
+#include "llbc/comm/headerdesc/PacketHeaderLayoutImpl.h"
+
+#endif // !__LLBC_COMM_PACKET_HEADER_LAYOUT_H__
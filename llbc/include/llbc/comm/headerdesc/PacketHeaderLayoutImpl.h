@@ -0,0 +1,160 @@
+/**
+ * @file    PacketHeaderLayoutImpl.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifdef __LLBC_COMM_PACKET_HEADER_LAYOUT_H__
+
+__LLBC_NS_BEGIN
+
+inline int LLBC_PacketHeaderPartCodec<0>::Get(const char *buf)
+{
+    return 0;
+}
+
+inline void LLBC_PacketHeaderPartCodec<0>::Set(char *buf, int val)
+{
+}
+
+inline int LLBC_PacketHeaderPartCodec<1>::Get(const char *buf)
+{
+    return static_cast<int>(*buf);
+}
+
+inline void LLBC_PacketHeaderPartCodec<1>::Set(char *buf, int val)
+{
+    *buf = static_cast<sint8>(val);
+}
+
+inline int LLBC_PacketHeaderPartCodec<2>::Get(const char *buf)
+{
+    uint16 val;
+    ::memcpy(&val, buf, sizeof(val));
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    val = ntohs(val);
+#endif // LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+
+    return static_cast<int>(static_cast<sint16>(val));
+}
+
+inline void LLBC_PacketHeaderPartCodec<2>::Set(char *buf, int val)
+{
+    uint16 convertedVal = static_cast<uint16>(val);
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    convertedVal = htons(convertedVal);
+#endif // LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    ::memcpy(buf, &convertedVal, sizeof(convertedVal));
+}
+
+inline int LLBC_PacketHeaderPartCodec<4>::Get(const char *buf)
+{
+    uint32 val;
+    ::memcpy(&val, buf, sizeof(val));
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    val = ntohl(val);
+#endif // LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+
+    return static_cast<int>(static_cast<sint32>(val));
+}
+
+inline void LLBC_PacketHeaderPartCodec<4>::Set(char *buf, int val)
+{
+    uint32 convertedVal = static_cast<uint32>(val);
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    convertedVal = htonl(convertedVal);
+#endif // LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    ::memcpy(buf, &convertedVal, sizeof(convertedVal));
+}
+
+inline int LLBC_PacketHeaderPartCodec<8>::Get(const char *buf)
+{
+    sint64 val;
+    ::memcpy(&val, buf, sizeof(val));
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    LLBC_Net2Host(val);
+#endif // LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+
+    return static_cast<int>(val);
+}
+
+inline void LLBC_PacketHeaderPartCodec<8>::Set(char *buf, int val)
+{
+    sint64 convertedVal = static_cast<sint64>(val);
+#if LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    LLBC_Host2Net(convertedVal);
+#endif // LLBC_CFG_COMM_ORDER_IS_NET_ORDER
+    ::memcpy(buf, &convertedVal, sizeof(convertedVal));
+}
+
+template <size_t _Offset, size_t _Len>
+inline int LLBC_PacketHeaderPart<_Offset, _Len>::Get(const void *header)
+{
+    return LLBC_PacketHeaderPartCodec<_Len>::Get(
+        reinterpret_cast<const char *>(header) + _Offset);
+}
+
+template <size_t _Offset, size_t _Len>
+inline void LLBC_PacketHeaderPart<_Offset, _Len>::Set(void *header, int val)
+{
+    LLBC_PacketHeaderPartCodec<_Len>::Set(
+        reinterpret_cast<char *>(header) + _Offset, val);
+}
+
+template <size_t _Offset, size_t _Len>
+inline bool LLBC_PacketHeaderPart<_Offset, _Len>::IsMatch(bool exist, size_t offset, size_t len)
+{
+    if (!exist)
+        return _Len == 0;
+
+    return offset == _Offset && len == _Len;
+}
+
+template <size_t _LenOffset, size_t _LenLen,
+          size_t _OpcodeOffset, size_t _OpcodeLen,
+          size_t _StatusOffset, size_t _StatusLen,
+          size_t _ServiceIdOffset, size_t _ServiceIdLen,
+          size_t _FlagsOffset, size_t _FlagsLen,
+          size_t _HeaderLen>
+inline bool LLBC_PacketHeaderLayout<_LenOffset, _LenLen,
+                                    _OpcodeOffset, _OpcodeLen,
+                                    _StatusOffset, _StatusLen,
+                                    _ServiceIdOffset, _ServiceIdLen,
+                                    _FlagsOffset, _FlagsLen,
+                                    _HeaderLen>::IsMatch(const LLBC_PacketHeaderDesc *desc)
+{
+    if (!desc || desc->GetHeaderLen() != _HeaderLen)
+        return false;
+
+    if (_LenLen == 0 || !desc->GetLenPart() ||
+        !LenPart::IsMatch(true, desc->GetLenPartOffset(), desc->GetLenPartLen()))
+        return false;
+
+    if (!OpcodePart::IsMatch(desc->IsHasOpcodePart(),
+                             desc->IsHasOpcodePart() ? desc->GetOpcodePartOffset() : 0,
+                             desc->IsHasOpcodePart() ? desc->GetOpcodePartLen() : 0))
+        return false;
+
+    if (!StatusPart::IsMatch(desc->IsHasStatusPart(),
+                             desc->IsHasStatusPart() ? desc->GetStatusPartOffset() : 0,
+                             desc->IsHasStatusPart() ? desc->GetStatusPartLen() : 0))
+        return false;
+
+    if (!ServiceIdPart::IsMatch(desc->IsHasServiceIdPart(),
+                                desc->IsHasServiceIdPart() ? desc->GetServiceIdPartOffset() : 0,
+                                desc->IsHasServiceIdPart() ? desc->GetServiceIdPartLen() : 0))
+        return false;
+
+    if (!FlagsPart::IsMatch(desc->IsHasFlagsPart(),
+                            desc->IsHasFlagsPart() ? desc->GetFlagsPartOffset() : 0,
+                            desc->IsHasFlagsPart() ? desc->GetFlagsPartLen() : 0))
+        return false;
+
+    return true;
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_COMM_PACKET_HEADER_LAYOUT_H__
@@ -13,6 +13,7 @@
 #include "llbc/core/Core.h"
 #include "llbc/objbase/ObjBase.h"
 
+#include "llbc/comm/DispatchTable.h"
 #include "llbc/comm/protocol/IProtocol.h"
 
 __LLBC_NS_BEGIN
@@ -68,9 +69,18 @@ public:
      */
     virtual int AddCoder(int opcode, LLBC_ICoderFactory *coder);
 
+    /**
+     * Set the shared read-only coder table, if set, coder factories will lookup from this table
+     * instead of self coders, all sessions' protocol stacks can share one coder table.
+     * @param[in] coderTable - the coder table, protocol will not hold its ownership.
+     */
+    void SetCoderTable(const LLBC_DispatchTable<int, LLBC_ICoderFactory> *coderTable);
+
 private:
     typedef std::map<int, LLBC_ICoderFactory *> _Coders;
     _Coders _coders;
+
+    const LLBC_DispatchTable<int, LLBC_ICoderFactory> *_coderTable;
 };
 
 __LLBC_NS_END
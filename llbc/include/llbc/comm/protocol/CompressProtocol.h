@@ -17,8 +17,21 @@
 
 __LLBC_NS_BEGIN
 
+/**
+ * Previous declare some classes.
+ */
+class LLBC_ICompressor;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
 /**
  * \brief The Compress-Layer protocol implement.
+ *        If not set compressor, all packets(include flags) will pass through.
+ *        Otherwise, the packet payload length >= threshold will compress and mark
+ *        compressed by the highest bit of header flags part(see LLBC_Packet::IsPayloadCompressed()),
+ *        this bit always rewritten when send, peer must use the same compressor.
  */
 class LLBC_EXPORT LLBC_CompressProtocol : public LLBC_IProtocol
 {
@@ -67,6 +80,21 @@ public:
      * @return int - return 0 if success, otherwise return -1.
      */
     virtual int AddCoder(int opcode, LLBC_ICoderFactory *coder);
+
+public:
+    /**
+     * Set compressor to protocol, must call before any packet send/recv.
+     * Note: If packet header not has flags part, compressor will be ignored.
+     * @param[in] compressor - the compressor, protocol will take over it.
+     * @param[in] threshold  - the compress threshold, payload length less than it will not compress.
+     */
+    void SetCompressor(LLBC_ICompressor *compressor, size_t threshold);
+
+private:
+    LLBC_ICompressor *_compressor;
+    size_t _threshold;
+
+    LLBC_MessageBlock *_buf;
 };
 
 __LLBC_NS_END
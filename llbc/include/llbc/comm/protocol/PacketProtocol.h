@@ -61,10 +61,14 @@ public:
     /**
      * When data received, will call this method.
      * @param[in]  in  - the in data.
-     *                  in this protocol, in data type: LLBC_MessageBlock.
+     *                  in this protocol, in data type: LLBC_MessageBlock *, the blocks chain(linked by
+     *                  next pointer), only borrowed, protocol will not delete it.
      * @param[out] out - the out data.
      *                  in this protocol, out data type: LLBC_MessageBlock *, NULL if not packet constructed.
      *                  in LLBC_MessageBlock, store the LLBC_Packet * list.
+     * Note: The empty payload packet(header only) is constructed as soon as it's header received,
+     *       even the header exactly end at the received data end(before, this packet will be held
+     *       until next data received, so the last empty payload packet of a burst never delivered).
      * @return int - return 0 if success, otherwise return -1.
      */
     virtual int Recv(void *in, void *&out);
@@ -79,6 +83,15 @@ public:
      */
     virtual int AddCoder(int opcode, LLBC_ICoderFactory *coder);
 
+private:
+    /**
+     * Construct packets from one message block.
+     * @param[in] block - the message block.
+     * @param[out] out  - the packets list block.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int RecvBlock(LLBC_MessageBlock *block, void *&out);
+
 private:
     LLBC_PacketHeaderAssembler _headerAssembler;
 
@@ -127,7 +127,7 @@ public:
 
     /**
      * When message receive, will use this protocol stack method to convert message-block to undecoded.
-     * @param[in] block   - the message block.
+     * @param[in] block   - the message blocks chain(linked by next pointer), only borrowed, caller will recycle it.
      * @param[in] packets - the packets.
      * @return int - return 0 if success, otherwise return -1.
      */
@@ -143,7 +143,7 @@ public:
 
     /**
      * When packet recv, will use this protocol stack method to convert message-block type to packets.
-     * @param[in] block   - the message block.
+     * @param[in] block   - the message blocks chain(linked by next pointer), only borrowed, caller will recycle it.
      * @param[in] packets - the converted packet list.
      */
     int Recv(LLBC_MessageBlock *block, std::vector<LLBC_Packet *> &packets);
@@ -54,6 +54,7 @@ public:
 
     /**
      * When data received, will call this method.
+     * Note: the in data is a borrowed message block chain, protocol will not delete it.
      * @param[in] in  - the in data.
      * @param[out out - the out data.
      * @param[in] int - return 0 if success, otherwise return -1.
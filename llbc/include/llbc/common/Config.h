@@ -43,6 +43,12 @@
 // The interval sampler sampling hours value, default is 1.
 #define LLBC_CFG_CORE_SAMPLER_INTERVAL_SAMPLING_HOURS       1
 
+/**
+ * \brief Core/Timer about config options define.
+ */
+// The timer scheduler default use timing wheel backend or not, if not, use binary heap backend.
+#define LLBC_CFG_CORE_TIMER_DFT_USE_TIMING_WHEEL            0
+
 /**
  * \brief Core/Thread about config options define.
  */
@@ -57,6 +63,8 @@
 #define LLBC_CFG_THREAD_MINIMUM_STACK_SIZE                  (1 * 1024 * 1024)
 // Message block default size.
 #define LLBC_CFG_THREAD_MSG_BLOCK_DFT_SIZE                  (1024)
+// Task default use lock-free message queue or not(only single consumer thread task can use it).
+#define LLBC_CFG_THREAD_DFT_LOCK_FREE_MSG_QUEUE             0
 
 /**
  * \brief Core/Log about config options define.
@@ -85,14 +93,39 @@
 #define LLBC_CFG_LOG_DEFAULT_MAX_FILE_SIZE                  (LONG_MAX)
 // Default max backup file index.
 #define LLBC_CFG_LOG_DEFAULT_MAX_BACKUP_INDEX               10000
+// Default synchronous logger file log flush interval, in milli-seconds, 0 means flush after every log,
+// make sure no log lost when process crashed, if configured, flush in next log output after interval reached,
+// and log runnable thread flush it every interval when logger idle.
+#define LLBC_CFG_LOG_DEFAULT_SYNC_FILE_FLUSH_INTERVAL       0
+// Default asynchronous logger file log flush interval, in milli-seconds(Fatal log always flush),
+// asynchronous logger also flush when all log records output(idle).
+#define LLBC_CFG_LOG_DEFAULT_ASYNC_FILE_FLUSH_INTERVAL      200
+// Default file log buffer size, when buffer full, will write to file.
+#define LLBC_CFG_LOG_DEFAULT_FILE_BUFFER_SIZE               65536
 // Default log using mode.
 #define LLBC_CFG_LOG_USING_WITH_STREAM                      1
+// Asynchronous log record size(include record header), too long message will allocate from heap.
+#define LLBC_CFG_LOG_RING_RECORD_SIZE                       512
+// Asynchronous log per-thread record ring buffer capacity(must be power of 2).
+#define LLBC_CFG_LOG_RING_RECORD_COUNT                      1024
+// Per-thread max record ring buffers count(one ring per asynchronous logger), exceed will fallback to message queue.
+#define LLBC_CFG_LOG_PER_THREAD_MAX_RING_COUNT              8
+// Asynchronous log runnable max drain records count per ring per batch.
+#define LLBC_CFG_LOG_RING_DRAIN_BATCH_SIZE                  256
+// Asynchronous log record ring full, producer thread yield times before sleep wait log runnable drain.
+#define LLBC_CFG_LOG_RING_FULL_YIELD_TIMES                  16
+// Asynchronous log runnable idle wait time, in milli-seconds, flush appenders then wait new log records.
+#define LLBC_CFG_LOG_RUNNABLE_IDLE_WAIT_TIME                20
 
 /**
  * \brief ObjBase about configs.
  */
 // Dictionary default bucket size.
 #define LLBC_CFG_OBJBASE_DICT_DFT_BUCKET_SIZE               100
+// Dictionary default max load factor(elements count / bucket size), if exceed, will expand bucket.
+#define LLBC_CFG_OBJBASE_DICT_DFT_MAX_LOAD_FACTOR           1.0
+// Dictionary incremental rehash step, how many old buckets will migrate per insert/erase operation.
+#define LLBC_CFG_OBJBASE_DICT_REHASH_STEP                   2
 // Dictionary string key hash algorithm(case insensitive).
 // Supports: SDBM, RS, JS, PJW, ELF, BKDR, DJB, AP
 // Default: BKDR
@@ -103,16 +136,40 @@
  */
 // The network data order define, default is non-net order.
 #define LLBC_CFG_COMM_ORDER_IS_NET_ORDER                    1
+// Determine enable the compile-time packet header layout(LLBC_LibPacketHeaderLayout) or not, if enabled and
+// the runtime packet header describe match the layout, packet header parts will access by fixed offset.
+#define LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT           1
 // Default connect timeout time.
 #define LLBC_CFG_COMM_DFT_CONN_TIMEOUT                      10
 // The network concurrent listen sockets count.
 #define LLBC_CFG_COMM_MAX_EVENT_COUNT                       100
 // The epool max listen socket fd size(LINUX platform specific, only available before 2.6.8 version kernel before).
 #define LLBC_CFG_EPOLL_MAX_LISTEN_FD_SIZE                   10000
+// Default poller integrated event loop option(EpollPoller only), if enabled, poller thread
+// will wait io events by itself and use eventfd to wakeup, no standalone monitor thread.
+#define LLBC_CFG_COMM_DFT_POLLER_INTEGRATED_LOOP            0
 // Default socket send buffer size.
 #define LLBC_CFG_COMM_DFT_SEND_BUF_SIZE                     65536
 // Default socket recv buffer size.
 #define LLBC_CFG_COMM_DFT_RECV_BUF_SIZE                     65536
+// The max message blocks count per gather send(writev) call(Non-WIN32 platform), will limited by IOV_MAX.
+#define LLBC_CFG_COMM_MAX_GATHER_SEND_BLOCKS                1024
+// Default session send buffer high water mark, in bytes, if session's not send data size reach 
+// this value, new send data will be discard and session will be closed, 0 means unlimited.
+#define LLBC_CFG_COMM_DFT_SEND_BUF_HIGH_WATER_MARK          0
+// Default send coalescing max delay, in milli-seconds, dirty sessions will be flushed when
+// reach this delay, even if poller queued events not drained.
+#define LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_DELAY           2
+// Default send coalescing max bytes, if session's not send data size reach this value, flush immediately.
+#define LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES           65536
+// The poller receive block size, socket will receive data into these fixed-size pooled blocks.
+#define LLBC_CFG_COMM_POLLER_RECV_BLOCK_SIZE                16384
+// The poller max idle receive blocks count.
+#define LLBC_CFG_COMM_POLLER_MAX_IDLE_RECV_BLOCKS           64
+// Default shared-memory channel ring size(LINUX platform specific), in bytes, per direction, must be power of 2.
+#define LLBC_CFG_COMM_DFT_SHM_RING_SIZE                     1048576
+// The shared-memory channel handshake timeout(LINUX platform specific), in milli-seconds.
+#define LLBC_CFG_COMM_SHM_HANDSHAKE_TIMEOUT                 5000
 // Default service FPS value.
 #define LLBC_CFG_COMM_DFT_SERVICE_FPS                       60
 // Min service FPS value.
@@ -131,6 +188,34 @@
 #define LLBC_CFG_COMM_ENABLE_STATUS_DESC                    1
 // Determine enable the unify pre-subscribe handler support or not.
 #define LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE             1
+// Max keys range of direct-indexed service dispatch table, exceed will use hash table.
+#define LLBC_CFG_COMM_DISPATCH_TABLE_MAX_DIRECT_RANGE       65536
+// Max keys range/keys count ratio of direct-indexed service dispatch table, exceed will use hash table.
+#define LLBC_CFG_COMM_DISPATCH_TABLE_DIRECT_SPARSE_FACTOR   8
+// Default compress threshold, payload length less than this value will not compress.
+#define LLBC_CFG_COMM_DFT_COMPRESS_THRESHOLD                512
+// Default zlib compress level(1: best speed, 9: best compression).
+#define LLBC_CFG_COMM_DFT_ZLIB_COMPRESS_LEVEL               1
+// Max decompressed payload size, use to reject malformed compressed packet.
+#define LLBC_CFG_COMM_MAX_DECOMPRESSED_SIZE                 (16 * 1024 * 1024)
+// Connected session Ids set shard count, multi threads send packets only lock the session's shard.
+#define LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS           16
+// Event-driven service max wait time, in milli-seconds, bound the stop latency(foreign threads posted tasks will wakeup service immediately).
+#define LLBC_CFG_COMM_EVENT_DRIVEN_MAX_WAIT_TIME            100
+// Poller use lock-free message queue or not(poller always has single consumer thread).
+#define LLBC_CFG_COMM_POLLER_LOCK_FREE_MSG_QUEUE            1
+// Packet pool option, if enabled, service and poller threads will reuse packets through per-thread packet pool.
+#define LLBC_CFG_COMM_ENABLE_PACKET_POOL                    1
+// The per-thread packet pool max idle packets count.
+#define LLBC_CFG_COMM_PACKET_POOL_MAX_IDLE                  4096
+// The pooled packet min block size(include header), pooled packet will pre-size its block to this size.
+#define LLBC_CFG_COMM_PACKET_POOL_BLOCK_SIZE                256
+// The pooled packet max block size, larger block will be freed when packet release to pool.
+#define LLBC_CFG_COMM_PACKET_POOL_MAX_BLOCK_SIZE            16384
+// The packet pool cross-thread return batch size, packets released in non-owner thread will return to owner pool in batch.
+#define LLBC_CFG_COMM_PACKET_POOL_RETURN_BATCH_SIZE         64
+// The per-thread packet pool max pending return batches count(one batch per owner pool).
+#define LLBC_CFG_COMM_PACKET_POOL_MAX_RETURN_BATCHES        8
 
 // The poller model config(Platform specific).
 //  Alloc set to fllow datas(string format, case insensitive).
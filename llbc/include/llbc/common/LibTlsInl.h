@@ -49,6 +49,15 @@ struct __LLBC_LibTls
 
         /* Timer scheduler. */
         void *timerScheduler;
+
+        /* Asynchronous log record rings, and the ring owner(log runnable) Ids. */
+        void *logRings[LLBC_CFG_LOG_PER_THREAD_MAX_RING_COUNT];
+        uint32 logRingOwners[LLBC_CFG_LOG_PER_THREAD_MAX_RING_COUNT];
+
+        /* Log time token formatted time cache(second part), shared by all time tokens in thread. */
+        sint64 logCachedTime;
+        char logCachedTimeStr[32];
+        size_t logCachedTimeLen;
     } coreTls;
 
     /* ObjBase-Module TLS valus. */
@@ -63,6 +72,9 @@ struct __LLBC_LibTls
     {
         /* Services pointer. */
         void *services[LLBC_CFG_COMM_PER_THREAD_DRIVE_MAX_SVC_COUNT + 1];
+
+        /* Packet pool. */
+        void *packetPool;
     } commTls;
 
     __LLBC_LibTls();
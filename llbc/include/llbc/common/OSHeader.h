@@ -41,6 +41,8 @@
  #include <libgen.h>
  #include <sys/time.h>
  #include <sys/socket.h>
+ #include <sys/uio.h>
+ #include <sys/un.h>
  #include <netdb.h>
  #include <dirent.h>
  #include <semaphore.h>
@@ -49,6 +51,10 @@
 
  #if LLBC_TARGET_PLATFORM_LINUX
   #include <sys/epoll.h>
+  #include <sys/eventfd.h>
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <linux/futex.h>
  #endif
 
  #if LLBC_TARGET_PLATFORM_MAC || LLBC_TARGET_PLATFORM_IPHONE
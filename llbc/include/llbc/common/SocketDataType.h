@@ -73,6 +73,18 @@ __LLBC_NS_BEGIN
  typedef WSABUF LLBC_SockBuf;
 #endif
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+ typedef struct iovec LLBC_IoVec;
+ #ifdef IOV_MAX
+  #define LLBC_IOV_MAX IOV_MAX
+ #else
+  #define LLBC_IOV_MAX 1024
+ #endif
+
+ // The max file descriptors count per LLBC_SendWithFds()/LLBC_RecvWithFds() call.
+ #define LLBC_MAX_PASS_FDS 8
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 /**
  * \brief The internal socket address structure encapsulation.
  */
@@ -37,6 +37,11 @@ public:
      */
     virtual void Finalize();
 
+    /**
+     * Flush all buffered log data, default nothing to do.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Flush();
 
 protected:
     /**
@@ -55,8 +55,10 @@ struct LLBC_LogAppenderInitInfo
 
     LLBC_String file;               // file name, used File type appender.
     bool dailyRolling;              // daily rolling mode flag, used in File type appender.
-    int maxFileSize;                // max log file size, int bytes, used in File type appender.
+    long maxFileSize;               // max log file size, int bytes, used in File type appender.
     int maxBackupIndex;             // max backup index, used in File type appender.
+    int flushInterval;              // flush interval, in milli-seconds, used in File type appender.
+    int bufferSize;                 // file buffer size, used in File type appender.
 
     LLBC_String ip;                 // Ip address, used in Network type appender.
     uint16 port;                    // port, used in Network type appender.
@@ -97,6 +99,12 @@ public:
      */
     virtual int Output(const LLBC_LogData &data) = 0;
 
+    /**
+     * Flush all buffered log data.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Flush() = 0;
+
 protected:
     /**
      * Get current appender's token chain.
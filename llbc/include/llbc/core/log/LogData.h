@@ -18,19 +18,19 @@ __LLBC_NS_BEGIN
  */
 struct LLBC_EXPORT LLBC_LogData
 {
-    char *msg;                            // Log message(allocate from heap).
+    const char *msg;                      // Log message(held by log record).
     uint32 msgLen;                        // message length.
 
     int level;                            // Log level.
     const char *loggerName;               // Logger name.
 
-    char *others;                         // Others data(allocate from heap).
-    uint32 tagBeg;                        // Tag begin.
+    const char *tag;                      // Tag(held by log record).
     uint32 tagLen;                        // Tag length.
 
     time_t logTime;                       // Log time.
+    uint32 logTimeUs;                     // Log time micro-seconds part.
 
-    uint32 fileBeg;                       // Log source file name begin.
+    const char *file;                     // Log source file name(held by log record).
     uint32 fileLen;                       // Log source file name length.
     long line;                            // Log source file line number.
 
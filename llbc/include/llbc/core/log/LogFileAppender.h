@@ -11,6 +11,8 @@
 
 #include "llbc/common/Common.h"
 
+#include "llbc/core/thread/SimpleLock.h"
+
 #include "llbc/core/log/BaseLogAppender.h"
 
 __LLBC_NS_BEGIN
@@ -62,12 +64,32 @@ public:
      */
     virtual int Output(const LLBC_LogData &data);
 
+    /**
+     * Flush all buffered log data to file.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    virtual int Flush();
+
 private:
     /**
-     * Get log file.
-     * @return LLBC_String - log file name.
+     * Flush all buffered log data to file, caller must hold the file lock.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int DoFlush();
+
+    /**
+     * Open log file, and setup file buffer mode and file size.
+     * @param[in] file - the file object.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int OpenLogFile(LLBC_File &file);
+
+    /**
+     * Open log file, if file size exceed limit, backup it.
+     * @param[in] file - the file object.
+     * @return int - return 0 if success, otherwise return -1.
      */
-    int OpenLogFile(LLBC_File &file) const;
+    int DoOpenLogFile(LLBC_File &file) const;
 
 private:
     bool _isDailyRolling;
@@ -77,7 +99,15 @@ private:
 
     LLBC_String _fileName;
 
+    LLBC_SimpleLock _fileLock;
     LLBC_File *_file;
+    size_t _fileSize;
+
+    int _flushInterval;
+    int _bufferSize;
+    sint64 _lastFlushTime;
+
+    LLBC_String _formattedData;
 };
 
 __LLBC_NS_END
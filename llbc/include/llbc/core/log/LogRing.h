@@ -0,0 +1,113 @@
+/**
+ * @file    LogRing.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The asynchronous log record ring buffer.
+ */
+#ifndef __LLBC_CORE_LOG_LOG_RING_H__
+#define __LLBC_CORE_LOG_LOG_RING_H__
+
+#include "llbc/common/Common.h"
+
+#include "llbc/core/log/LogData.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The fixed size log record, tag, file name and message formatted into record buffer,
+ *        only too long tag/file name or message will allocate from heap.
+ */
+struct LLBC_HIDDEN LLBC_LogRecord
+{
+    LLBC_LogData data;                    // Log data, tag/file/msg point to buf, heapOthers or heapMsg.
+    char *heapOthers;                     // Too long tag and file name(allocate from heap), NULL if in buf.
+    char *heapMsg;                        // Too long message(allocate from heap), NULL if message in buf.
+
+    char buf[LLBC_CFG_LOG_RING_RECORD_SIZE - sizeof(LLBC_LogData) - sizeof(char *) * 2];
+
+    /**
+     * Free the heap allocated tag/file name and message.
+     */
+    void FreeHeapData()
+    {
+        LLBC_XFree(heapOthers);
+        LLBC_XFree(heapMsg);
+    }
+};
+
+/**
+ * \brief The single producer single consumer log record ring buffer encapsulation.
+ *        Producer is the logging thread, consumer is the log runnable.
+ *        Ring held by both producer and consumer when created, the last released side delete it.
+ */
+class LLBC_HIDDEN LLBC_LogRing
+{
+public:
+    /**
+     * Constructor.
+     * @param[in] capacity - the ring capacity, must be power of 2.
+     */
+    explicit LLBC_LogRing(uint32 capacity);
+
+public:
+    /**
+     * Producer: get next writable record, after fill record, call EndWrite() to publish it.
+     * @return LLBC_LogRecord * - the writable record, NULL if ring full.
+     */
+    LLBC_LogRecord *BeginWrite();
+
+    /**
+     * Producer: publish the record which return by BeginWrite().
+     */
+    void EndWrite();
+
+    /**
+     * Consumer: get next readable record, after process record, call EndRead() to release it.
+     * @return LLBC_LogRecord * - the readable record, NULL if ring empty.
+     */
+    LLBC_LogRecord *BeginRead();
+
+    /**
+     * Consumer: release the record which return by BeginRead().
+     */
+    void EndRead();
+
+public:
+    /**
+     * Producer/Consumer: release the ring, after released, must not access the ring any more.
+     * If the other side already released, the ring will be deleted.
+     */
+    void Release();
+
+    /**
+     * Producer/Consumer: check the other side released the ring or not.
+     * @return bool - return true if the other side released.
+     */
+    bool IsPeerReleased() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_LogRing);
+
+private:
+    /**
+     * Ring only can delete by Release().
+     */
+    ~LLBC_LogRing();
+
+private:
+    LLBC_LogRecord *_records;
+    const uint32 _mask;
+
+    volatile sint32 _writePos;
+    sint32 _cachedReadPos;
+
+    volatile sint32 _readPos;
+    sint32 _cachedWritePos;
+
+    volatile sint32 _refCount;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_LOG_LOG_RING_H__
@@ -11,6 +11,8 @@
 
 #include "llbc/common/Common.h"
 
+#include "llbc/core/thread/SimpleLock.h"
+#include "llbc/core/thread/Semaphore.h"
 #include "llbc/core/thread/Task.h"
 
 __LLBC_NS_BEGIN
@@ -19,6 +21,8 @@ __LLBC_NS_BEGIN
  * Pre-declare some classes.
  */
 struct LLBC_LogData;
+struct LLBC_LogRecord;
+class LLBC_LogRing;
 class LLBC_ILogAppender;
 
 __LLBC_NS_END
@@ -58,21 +62,74 @@ public:
      */
     int Output(LLBC_LogData *data);
 
+    /**
+     * Set runnable idle wait time, when no log records to output, runnable flush all appenders
+     * then wait new log records at most idle wait time.
+     * @param[in] idleWaitTime - the idle wait time, in milli-seconds.
+     */
+    void SetIdleWaitTime(int idleWaitTime);
+
     /**
      * Stop log runnable, it just send stop signal to task, must call Wait() to real stop runnable.
+     * Before runnable stopped, all pushed log records will be output.
      */
     void Stop();
 
 public:
     /**
-     * Free log data.
-     * @param[in] data - the log data.
+     * Get current thread's log record ring, if not exist, create it.
+     * @return LLBC_LogRing * - the log record ring, NULL if current thread alive runnables' rings count reach
+     *                          LLBC_CFG_LOG_PER_THREAD_MAX_RING_COUNT limit.
+     */
+    LLBC_LogRing *GetThreadRing();
+
+    /**
+     * Release current thread's all log record rings, call before thread exit.
+     * Runnable will drain the remaining log records, then delete the rings.
+     */
+    static void ReleaseThreadRings();
+
+    /**
+     * Wakeup runnable if it is idle, call after log record pushed.
+     */
+    void Wakeup();
+
+    /**
+     * Free the log record which allocate from heap(only used when thread ring unavailable).
+     * @param[in] record - the log record.
      */
-    static void FreeLogData(LLBC_LogData *data);
+    static void FreeLogRecord(LLBC_LogRecord *record);
+
+private:
+    /**
+     * Drain all threads' record rings and message queue, output all records.
+     * @param[in] batchSize - max drain records count per ring.
+     * @return size_t - the output records count.
+     */
+    size_t Drain(size_t batchSize);
+
+    /**
+     * Flush all appenders buffered log data.
+     */
+    void FlushAppenders();
+
+    /**
+     * Release all threads' rings which held by this runnable.
+     */
+    void ReleaseRings();
 
 private:
     volatile bool _stoped;
     LLBC_ILogAppender *_head;
+
+    uint32 _id;
+    LLBC_SimpleLock _ringsLock;
+    std::vector<LLBC_LogRing *> _rings;
+    std::vector<LLBC_LogRing *> _drainingRings;
+
+    volatile sint32 _idle;
+    int _idleWaitTime;
+    LLBC_Semaphore _wakeupSem;
 };
 
 __LLBC_NS_END
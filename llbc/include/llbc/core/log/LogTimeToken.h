@@ -15,6 +15,8 @@ __LLBC_NS_BEGIN
 
 /**
  * \brief The time log token class encapsulation.
+ *        Support sub-second precision option: %T{ms} - milli-seconds, %T{us} - micro-seconds.
+ *        The second part formatted string will be cached, only re-format when second changed.
  */
 class LLBC_LogTimeToken : public LLBC_BaseLogToken
 {
@@ -43,6 +45,9 @@ public:
      * @param[out] formattedData - store location for formatted log string.
      */
     virtual void Format(const LLBC_LogData &data, LLBC_String &formattedData) const;
+
+private:
+    int _precision;
 };
 
 __LLBC_NS_END
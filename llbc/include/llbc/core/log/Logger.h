@@ -18,7 +18,7 @@ __LLBC_NS_BEGIN
 /**
  * Pre-declare some classes.
  */
-struct LLBC_LogData;
+struct LLBC_LogRecord;
 class LLBC_LogRunnable;
 class LLBC_LoggerConfigInfo;
 
@@ -106,24 +106,28 @@ public:
 private:
     /**
      * Direct output message using given level.
+     * Synchronous mode: format to stack record and output.
+     * Asynchronous mode: format to current thread's record ring, no heap allocation.
      */
-    int DirectOutput(int level, const char *tag, const char *file, int line, char *message, int len);
+    int DirectOutput(int level, const char *tag, const char *file, int line, const char *message, va_list ap);
+
     /**
-     * Build log data.
+     * Fill log record, tag and message will be formatted into record buffer.
+     * @param[in] record  - the log record.
      * @param[in] level   - log level.
      * @param[in] tag     - log tag.
-     * @param[in] file    - log file name.
+     * @param[in] file    - log file name, must be static string, like __FILE__.
      * @param[in] line    - log file line.
      * @param[in] message - log format control string.
-     * @param[in] len     - the message length, not include tailing character.
-     * @return LLBC_LogData * - the log data.
+     * @param[in] ap      - the format arguments.
      */
-    LLBC_LogData *BuildLogData(int level,
-                               const char *tag,
-                               const char *file,
-                               int line,
-                               char *message,
-                               int len);
+    void FillLogRecord(LLBC_LogRecord *record,
+                       int level,
+                       const char *tag,
+                       const char *file,
+                       int line,
+                       const char *message,
+                       va_list ap);
 
 private:
     LLBC_RecursiveLock _mutex;
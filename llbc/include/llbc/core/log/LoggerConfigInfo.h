@@ -108,6 +108,19 @@ public:
      */
     int GetMaxBackupIndex() const;
 
+    /**
+     * Get file log flush interval, synchronous logger default flush after every log,
+     * asynchronous logger default flush every LLBC_CFG_LOG_DEFAULT_ASYNC_FILE_FLUSH_INTERVAL milli-seconds.
+     * @return int - the flush interval, in milli-seconds, 0 means flush after every log.
+     */
+    int GetFileFlushInterval() const;
+
+    /**
+     * Get file log buffer size.
+     * @return int - the file log buffer size.
+     */
+    int GetFileBufferSize() const;
+
     /**
      * Disable assignment.
      */
@@ -127,6 +140,8 @@ private:
     bool _dailyMode;
     long _maxFileSize;
     int _maxBackupIndex;
+    int _fileFlushInterval;
+    int _fileBufferSize;
 };
 
 __LLBC_NS_END
@@ -313,6 +313,37 @@ inline sint64 LLBC_AtomicCompareAndExchange(volatile sint64 *ptr, sint64 exchang
 #endif
 }
 
+/**
+ * Atomic exchange pointer operation.
+ * @param[in/out] ptr - specifies the address of the destination pointer.
+ * @param[in] value   - the exchange pointer value.
+ * @return void * - returns the initial value of the ptr.
+ */
+inline void *LLBC_AtomicExchangePointer(void * volatile *ptr, void *value)
+{
+#if LLBC_TARGET_PLATFORM_WIN32
+    return ::InterlockedExchangePointer(ptr, value);
+#else // Non-WIN32
+    return __sync_lock_test_and_set(ptr, value);
+#endif
+}
+
+/**
+ * Atomic compare and exchange pointer operation.
+ * @param[in/out] ptr   - specifies the address of the destination pointer.
+ * @param[in] exchange  - specifies the exchange pointer value.
+ * @param[in] comparand - specifies the pointer value compare to destination.
+ * @return void * - returns the initial value of the ptr.
+ */
+inline void *LLBC_AtomicCompareAndExchangePointer(void * volatile *ptr, void *exchange, void *comparand)
+{
+#if LLBC_TARGET_PLATFORM_WIN32
+    return ::InterlockedCompareExchangePointer(ptr, exchange, comparand);
+#else // Non-WIN32
+    return __sync_val_compare_and_swap(ptr, comparand, exchange);
+#endif
+}
+
 __LLBC_NS_END
 
 #endif // !__LLBC_CORE_OS_OS_ATOMIC_H__
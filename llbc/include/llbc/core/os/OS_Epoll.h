@@ -67,6 +67,33 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_EpollWait(LLBC_Handle epfd, LLBC_EpollEvent *ev
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_EpollClose(LLBC_Handle epfd);
 
+/**
+ * Create a non-blocking eventfd, use to wakeup the thread which waiting on epoll.
+ * @return LLBC_Handle - the eventfd handle, if error occurred, return LLBC_INVALID_HANDLE.
+ */
+LLBC_EXTERN LLBC_EXPORT LLBC_Handle LLBC_CreateEventFd();
+
+/**
+ * Signal the eventfd, the eventfd will become readable.
+ * @param[in] efd - the eventfd handle.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SignalEventFd(LLBC_Handle efd);
+
+/**
+ * Reset the eventfd counter, the eventfd will become unreadable.
+ * @param[in] efd - the eventfd handle.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_ResetEventFd(LLBC_Handle efd);
+
+/**
+ * Close the eventfd.
+ * @param[in] efd - the eventfd handle.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_CloseEventFd(LLBC_Handle efd);
+
 #endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
 
 __LLBC_NS_END
@@ -37,6 +37,14 @@ LLBC_EXTERN LLBC_EXPORT LLBC_SocketHandle LLBC_CreateTcpSocket();
  */
 LLBC_EXTERN LLBC_EXPORT LLBC_SocketHandle LLBC_CreateTcpSocketEx();
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+/**
+ * Create unix domain stream socket(AF_UNIX), Non-WIN32 platform specific.
+ * @return LLBC_SocketHandle - socket handle, if failed, return LLBC_INVALID_SOCKET_HANDLE.
+ */
+LLBC_EXTERN LLBC_EXPORT LLBC_SocketHandle LLBC_CreateUnixSocket();
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 /**
  * Shutdown socket input.
  * @param[in] handle - socket handle.
@@ -68,6 +76,17 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_ShutdownSocketInputOutput(LLBC_SocketHandle han
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_Send(LLBC_SocketHandle handle, const void *buf, int len, int flags);
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+/**
+ * Gather sends data on a connected socket(Non-WIN32 specific).
+ * @param[in] handle  - socket handle.
+ * @param[in] iovs    - the io vectors array.
+ * @param[in] iovCount - the io vectors count, must less than or equal to LLBC_IOV_MAX.
+ * @return int - if no error occurs, return the total number bytes sent, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SendV(LLBC_SocketHandle handle, const LLBC_IoVec *iovs, int iovCount);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 /**
  * Send data on a connected socket(WIN32 specific).
  * @param[in]  handle         - socket handle.
@@ -115,6 +134,39 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_RecvEx(LLBC_SocketHandle handle,
                                         ulong_ptr flags,
                                         LLBC_POverlapped ol);
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+/**
+ * Send data and file descriptors(SCM_RIGHTS) on a connected unix domain socket, Non-WIN32 platform specific.
+ * @param[in] handle  - socket handle.
+ * @param[in] buf     - the data buffer, at least 1 byte, descriptors always attach to the data.
+ * @param[in] len     - the data length.
+ * @param[in] fds     - the file descriptors, the receiver will get duplicated descriptors.
+ * @param[in] fdCount - the file descriptors count, can't greater than LLBC_MAX_PASS_FDS.
+ * @return int - if no error occurs, return the number bytes sent, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_SendWithFds(LLBC_SocketHandle handle,
+                                             const void *buf,
+                                             int len,
+                                             const int *fds,
+                                             int fdCount);
+
+/**
+ * Receive data and file descriptors(SCM_RIGHTS) from a connected unix domain socket, Non-WIN32 platform specific.
+ * @param[in]     handle  - socket handle.
+ * @param[in]     buf     - buffer for incoming data.
+ * @param[in]     len     - length of buf.
+ * @param[out]    fds     - the received file descriptors, caller take ownership.
+ * @param[in/out] fdCount - in: the fds array capacity, out: the received file descriptors count.
+ * @return int - if no error occurs, return the number bytes received, if the connection has been closed,
+ *               return zero, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_RecvWithFds(LLBC_SocketHandle handle,
+                                             void *buf,
+                                             int len,
+                                             int *fds,
+                                             int &fdCount);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 /**
  * Close socket.
  * @param[in] handle - socket handle.
@@ -154,6 +206,16 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_EnableAddressReusable(LLBC_SocketHandle handle)
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_DisableAddressReusable(LLBC_SocketHandle handle);
 
+/**
+ * Enable socket port reusable(SO_REUSEPORT), multi sockets can bind to same address,
+ * kernel will balance incoming connections between them.
+ * Note: Only available in the platforms which support SO_REUSEPORT, otherwise
+ *       return -1 and LLBC_Errno equal LLBC_ERROR_NOT_IMPL.
+ * @param[in] handle - socket handle.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_EnablePortReusable(LLBC_SocketHandle handle);
+
 /**
  * Set socket send buffer size, in bytes.
  * @param[in] handle - socket.
@@ -203,6 +265,20 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_BindToAddress(LLBC_SocketHandle handle, const L
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_BindToAddress(LLBC_SocketHandle handle, const char *ip, uint16 port);
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+/**
+ * Bind unix domain socket to specify path, Non-WIN32 platform specific.
+ * Note: If path begin with '@', will bind to abstract namespace address(LINUX/ANDROID platform specific),
+ *       otherwise bind to filesystem path, if the path already exist and it is a socket file left by
+ *       previous process(connect to it refused), will remove it before bind, if it still listening by
+ *       other socket, bind failed and errno set to EADDRINUSE(the listener will accept a closed probe connection).
+ * @param[in] handle - socket handle.
+ * @param[in] path   - the socket path.
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_BindToUnixAddress(LLBC_SocketHandle handle, const char *path);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 /**
  * Listen fo wait client connection.
  * @param[in] handle  - socket handle.
@@ -260,6 +336,16 @@ LLBC_EXTERN LLBC_EXPORT int LLBC_GetAcceptExSocketAddrs(const void *outBuf,
  */
 LLBC_EXTERN LLBC_EXPORT int LLBC_ConnectToPeer(LLBC_SocketHandle handle, const LLBC_SockAddr_IN &addr);
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+/**
+ * Establish a connection to a specified unix domain socket path, Non-WIN32 platform specific.
+ * @param[in] handle - socket handle.
+ * @param[in] path   - the socket path, see LLBC_BindToUnixAddress().
+ * @return int - return 0 if success, otherwise return -1.
+ */
+LLBC_EXTERN LLBC_EXPORT int LLBC_ConnectToUnixPeer(LLBC_SocketHandle handle, const char *path);
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 /**
  * Establishes a connection to a specified socket, and optionally sends data once the connection is established.
  * @param[in]  handle     - socket handle.
@@ -11,16 +11,17 @@
 
 #include "llbc/common/Common.h"
 
-#include "llbc/core/sampler/BaseSampler.h"
+#include "llbc/core/sampler/CountSampler.h"
 
 __LLBC_NS_BEGIN
 
 /**
  * \brief The limit type sampler class encapsulation.
+ *        Record min/max sampling value, also hold count sampler's total/average statistics.
  */
-class LLBC_EXPORT LLBC_LimitSampler : public LLBC_BaseSampler
+class LLBC_EXPORT LLBC_LimitSampler : public LLBC_CountSampler
 {
-    typedef LLBC_BaseSampler _Base;
+    typedef LLBC_CountSampler _Base;
 
 public:
     LLBC_LimitSampler();
@@ -22,7 +22,9 @@
 #include "llbc/core/thread/Tls.h"
 #include "llbc/core/thread/MessageBlock.h"
 #include "llbc/core/thread/MessageBuffer.h"
+#include "llbc/core/thread/MessageBlockPool.h"
 #include "llbc/core/thread/MessageQueue.h"
+#include "llbc/core/thread/LockFreeMessageQueue.h"
 #include "llbc/core/thread/ThreadManager.h"
 #include "llbc/core/thread/Task.h"
 
@@ -0,0 +1,127 @@
+/**
+ * @file    LockFreeMessageQueue.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_THREAD_LOCK_FREE_MESSAGE_QUEUE_H__
+#define __LLBC_CORE_THREAD_LOCK_FREE_MESSAGE_QUEUE_H__
+
+#include "llbc/common/Common.h"
+
+#if !LLBC_TARGET_PLATFORM_LINUX
+#include "llbc/core/thread/SimpleLock.h"
+#include "llbc/core/thread/ConditionVariable.h"
+#endif // !LLBC_TARGET_PLATFORM_LINUX
+
+__LLBC_NS_BEGIN
+class LLBC_MessageBlock;
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The lock-free multi-producer/single-consumer thread message queue class encapsulation.
+ *        Producers push message blocks to an intrusive stack(linked by message block's next
+ *        pointer) with CAS, consumer exchange whole stack once and reverse it to FIFO order.
+ *        Only consumer will block(futex wait in linux platform) when queue is empty.
+ *        Note: Pop methods must be called by one thread at a time.
+ */
+class LLBC_EXPORT LLBC_LockFreeMessageQueue
+{
+public:
+    LLBC_LockFreeMessageQueue();
+    ~LLBC_LockFreeMessageQueue();
+
+public:
+    /**
+     * Insert new message block at the end of the controlled sequence, any thread can call it.
+     * @param[in] block - message block.
+     */
+    void PushBack(LLBC_MessageBlock *block);
+
+    /**
+     * Fetch and remove the first message block of the controlled sequence.
+     * @param[out] block - message block.
+     */
+    void PopFront(LLBC_MessageBlock *&block);
+
+    /**
+     * Try fetch and remove the first message block.
+     * @param[out] block - message block.
+     * @return bool - return true if success, otherwise return false.
+     */
+    bool TryPopFront(LLBC_MessageBlock *&block);
+
+    /**
+     * Timed fetch and remove the first message block.
+     * @param[out] block   - message block.
+     * @param[in] interval - interval, in milliseconds.
+     * @return bool - return true if success, otherwise return false.
+     */
+    bool TimedPopFront(LLBC_MessageBlock *&block, int interval);
+
+public:
+    /**
+     * Get the message block current size.
+     * @return ulong - current size.
+     */
+    ulong GetSize() const;
+
+    /**
+     * Cleanup the message queue, must not be called when producers pushing.
+     */
+    void Cleanup();
+
+private:
+    /**
+     * Pop the first message block of the controlled sequence.
+     * @param[out] block    - message block.
+     * @param[in]  interval - interval value, in milliseconds.
+     * @return bool - return true if success, otherwise return false.
+     */
+    bool Pop(LLBC_MessageBlock *&block, int interval);
+
+    /**
+     * Pop the first message block of the controlled sequence, non wait.
+     * @param[out] block - message block.
+     * @return bool - return true if success, otherwise return false.
+     */
+    bool PopNonWait(LLBC_MessageBlock *&block);
+
+    /**
+     * Consumer wait until producer pushed message block or timeout.
+     * @param[in] interval - interval value, in milliseconds.
+     */
+    void Wait(int interval);
+
+    /**
+     * Wakeup the waiting consumer, if has.
+     */
+    void Wakeup();
+
+    /**
+     * Disable assignment.
+     */
+    LLBC_DISABLE_ASSIGNMENT(LLBC_LockFreeMessageQueue);
+
+private:
+    LLBC_MessageBlock * volatile _pushHead;
+    LLBC_MessageBlock *_popHead;
+
+    volatile sint32 _size;
+    volatile sint32 _waiting;
+
+#if !LLBC_TARGET_PLATFORM_LINUX
+    LLBC_SimpleLock _lock;
+    LLBC_ConditionVariable _cond;
+#endif // !LLBC_TARGET_PLATFORM_LINUX
+};
+
+__LLBC_NS_END
+
+#include "llbc/core/thread/LockFreeMessageQueueImpl.h"
+
+#endif // !__LLBC_CORE_THREAD_LOCK_FREE_MESSAGE_QUEUE_H__
@@ -0,0 +1,31 @@
+/**
+ * @file    LockFreeMessageQueueImpl.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#ifdef __LLBC_CORE_THREAD_LOCK_FREE_MESSAGE_QUEUE_H__
+
+__LLBC_NS_BEGIN
+
+inline void LLBC_LockFreeMessageQueue::PopFront(LLBC_MessageBlock *&block)
+{
+    this->Pop(block, LLBC_INFINITE);
+}
+
+inline bool LLBC_LockFreeMessageQueue::TryPopFront(LLBC_MessageBlock *&block)
+{
+    return this->Pop(block, 0);
+}
+
+inline bool LLBC_LockFreeMessageQueue::TimedPopFront(LLBC_MessageBlock *&block, int interval)
+{
+    return this->Pop(block, interval);
+}
+
+__LLBC_NS_END
+
+#endif // __LLBC_CORE_THREAD_LOCK_FREE_MESSAGE_QUEUE_H__
@@ -77,6 +77,12 @@ public:
      */
     bool IsAttach() const;
 
+    /**
+     * Check the message block's buffer is shared or not.
+     * @return bool - shared attribute.
+     */
+    bool IsShared() const;
+
     /**
      * Get message block current buffer.
      * @return void * - buffer pointer.
@@ -167,6 +173,16 @@ public:
      */
     LLBC_MessageBlock *Clone() const;
 
+    /**
+     * Create a new message block which share this block's buffer(zero copy), the
+     * buffer is reference counted, will be freed when the last sharing block deleted.
+     * Once shared, all sharing blocks are read only(Write()/Allocate() will fail), and
+     * can be deleted in different threads.
+     * Note: The first Share() call must not concurrent with other Share() calls.
+     * @return LLBC_MessageBlock * - new message block, read/write position same as this block.
+     */
+    LLBC_MessageBlock *Share();
+
     /**
      * Get previous message block.
      * @return LLBC_MessageBlock * - previous message block.
@@ -198,10 +214,16 @@ private:
      */
     void Resize(size_t newSize);
 
+    /**
+     * Decrease the shared buffer reference count, free the buffer if reach zero.
+     */
+    void ReleaseShared();
+
     LLBC_DISABLE_ASSIGNMENT(LLBC_MessageBlock);
 
 private:
     bool _attach;
+    volatile sint32 *_sharedRefs;
 
     char *_buf;
     size_t _size;
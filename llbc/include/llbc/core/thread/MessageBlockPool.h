@@ -0,0 +1,107 @@
+/**
+ * @file    MessageBlockPool.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+#ifndef __LLBC_CORE_THREAD_MESSAGE_BLOCK_POOL_H__
+#define __LLBC_CORE_THREAD_MESSAGE_BLOCK_POOL_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+/**
+ * Previous declare some classes.
+ */
+class LLBC_MessageBlock;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The fixed-size message block pool class encapsulation.
+ *        Idle blocks linked by block's next pointer, pool is not thread-safe,
+ *        use it in one thread(eg: one poller).
+ */
+class LLBC_EXPORT LLBC_MessageBlockPool
+{
+public:
+    /**
+     * Construct pool.
+     * @param[in] blockSize - the pool block size.
+     * @param[in] maxIdle   - the max idle blocks count, more released blocks will be deleted.
+     */
+    explicit LLBC_MessageBlockPool(size_t blockSize, size_t maxIdle);
+    ~LLBC_MessageBlockPool();
+
+public:
+    /**
+     * Acquire an empty block from pool, if pool empty, will allocate new block.
+     * @return LLBC_MessageBlock * - the empty block.
+     */
+    LLBC_MessageBlock *Acquire();
+
+    /**
+     * Release block to pool.
+     * @param[in] block - the block.
+     */
+    void Release(LLBC_MessageBlock *block);
+
+    /**
+     * Release blocks chain(linked by block's next pointer) to pool.
+     * @param[in] head - the chain head block.
+     */
+    void ReleaseChain(LLBC_MessageBlock *head);
+
+public:
+    /**
+     * Get the pool block size.
+     * @return size_t - the block size.
+     */
+    size_t GetBlockSize() const;
+
+    /**
+     * Get the pool idle blocks count.
+     * @return size_t - the idle blocks count.
+     */
+    size_t GetIdleCount() const;
+
+    /**
+     * Get the acquire count.
+     * @return uint64 - the acquire count.
+     */
+    uint64 GetAcquireCount() const;
+
+    /**
+     * Get the allocated blocks count(pool empty while acquiring).
+     * @return uint64 - the allocated blocks count.
+     */
+    uint64 GetAllocCount() const;
+
+    /**
+     * Get the freed blocks count(pool full while releasing).
+     * @return uint64 - the freed blocks count.
+     */
+    uint64 GetFreeCount() const;
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_MessageBlockPool);
+
+private:
+    const size_t _blockSize;
+    const size_t _maxIdle;
+
+    LLBC_MessageBlock *_idle;
+    size_t _idleCount;
+
+    uint64 _acquireCount;
+    uint64 _allocCount;
+    uint64 _freeCount;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_THREAD_MESSAGE_BLOCK_POOL_H__
@@ -25,7 +25,7 @@ __LLBC_NS_BEGIN
 /**
  * \brief The message buffer class encapsulation.
  */
-class LLBC_MessageBuffer
+class LLBC_EXPORT LLBC_MessageBuffer
 {
 public:
     LLBC_MessageBuffer();
@@ -55,6 +55,18 @@ public:
      */
     LLBC_MessageBlock *FirstBlock() const;
 
+    /**
+     * Get the buffer readable size(all blocks readable size sum).
+     * @return size_t - the readable size, in bytes.
+     */
+    size_t GetSize() const;
+
+    /**
+     * Get the blocks count.
+     * @return size_t - the blocks count.
+     */
+    size_t GetBlockCount() const;
+
     /**
      * Merge buffers and detach.
      * @return LLBC_MessageBlock * - merged message block.
@@ -80,8 +92,18 @@ public:
      */
     void Cleanup();
 
+private:
+    /**
+     * Remove and delete the head block.
+     */
+    void RemoveHead();
+
 private:
     LLBC_MessageBlock *_head;
+    LLBC_MessageBlock *_tail;
+
+    size_t _size;
+    size_t _blockCount;
 };
 
 __LLBC_NS_END
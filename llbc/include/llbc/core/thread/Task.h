@@ -13,6 +13,7 @@
 
 #include "llbc/core/os/OS_Thread.h"
 #include "llbc/core/thread/MessageQueue.h"
+#include "llbc/core/thread/LockFreeMessageQueue.h"
 
 __LLBC_NS_BEGIN
 
@@ -58,6 +59,27 @@ public:
      */
     int GetThreadCount() const;
 
+    /**
+     * Check task message queue is lock-free or not.
+     * @return bool - lock-free flag.
+     */
+    bool IsMsgQueueLockFree() const;
+
+    /**
+     * Set task message queue use lock-free implement or not, must be called before activate.
+     * The lock-free message queue is multi-producer/single-consumer queue, so if enabled,
+     * task only can activate one thread.
+     * @param[in] lockFree - lock-free flag.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetMsgQueueLockFree(bool lockFree);
+
+    /**
+     * Get task message queue current size.
+     * @return ulong - the message queue size.
+     */
+    ulong GetMsgQueueSize() const;
+
 public:
     /**
      * Wait current task.
@@ -154,7 +176,9 @@ private:
 
     LLBC_SpinLock _lock;
 
+    bool _msgQueueLockFree;
     LLBC_MessageQueue _msgQueue;
+    LLBC_LockFreeMessageQueue _lockFreeMsgQueue;
 };
 
 __LLBC_NS_END
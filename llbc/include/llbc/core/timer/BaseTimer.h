@@ -101,9 +101,10 @@ public:
 
 private:
     /**
-     * Friend class: LLBC_TimerScheduler.
+     * Friend class: LLBC_TimerScheduler, LLBC_TimingWheel.
      */
     friend class LLBC_TimerScheduler;
+    friend class LLBC_TimingWheel;
 
     /**
      * Set scheduling fla, call by timer scheduler.
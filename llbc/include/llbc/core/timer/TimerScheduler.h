@@ -17,6 +17,7 @@ __LLBC_NS_BEGIN
 
 class LLBC_BaseTimer;
 struct LLBC_TimerData;
+class LLBC_TimingWheel;
 
 __LLBC_NS_END
 
@@ -32,6 +33,18 @@ class LLBC_EXPORT LLBC_TimerScheduler
     typedef LLBC_BinaryHeap<LLBC_TimerData *> _Heap;
     typedef std::map<LLBC_TimerId, LLBC_TimerData *> _IdxMap;
 
+public:
+    /**
+     * The timer scheduler backend enumeration.
+     */
+    enum Backend
+    {
+        // Binary heap + timer Id index map, O(log n) schedule.
+        HeapBackend,
+        // Hierarchical timing wheel, milli-second granularity, O(1) schedule and cancel.
+        TimingWheelBackend
+    };
+
 public:
     LLBC_TimerScheduler();
     virtual ~LLBC_TimerScheduler();
@@ -71,6 +84,13 @@ public:
      */
     void Update();
 
+    /**
+     * Get the next timer timeout remaining time, use to decide thread max wait time.
+     * @return sint64 - the remaining time, in milli-seconds, 0 means already timeout,
+     *                  -1 means no timer scheduling(or scheduler disabled).
+     */
+    sint64 GetNextTimeout() const;
+
     /**
      * Check timer scheduler is enabled or not.
      * @return bool - enable flag.
@@ -83,6 +103,20 @@ public:
      */
     void SetEnabled(bool enabled);
 
+    /**
+     * Get the timer scheduler backend.
+     * @return int - the backend, see Backend enumeration.
+     */
+    int GetBackend() const;
+
+    /**
+     * Set the timer scheduler backend, only can set when no timer scheduling.
+     * Normally call GetCurrentThreadScheduler()->SetBackend() to select per thread backend.
+     * @param[in] backend - the backend, see Backend enumeration.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetBackend(int backend);
+
 private:
     /**
      * Set friend class: LLBC_BaseTimer.
@@ -120,6 +154,8 @@ private:
 
     _Heap _heap;
     _IdxMap _idxMap;
+
+    LLBC_TimingWheel *_wheel;
 };
 
 __LLBC_NS_END
@@ -0,0 +1,125 @@
+/**
+ * @file    TimingWheel.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The hierarchical timing wheel timer scheduler backend.
+ */
+#ifndef __LLBC_CORE_TIMER_TIMING_WHEEL_H__
+#define __LLBC_CORE_TIMER_TIMING_WHEEL_H__
+
+#include "llbc/common/Common.h"
+
+__LLBC_NS_BEGIN
+
+class LLBC_BaseTimer;
+
+__LLBC_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The hierarchical timing wheel class encapsulation.
+ *        Milli-second tick, 5 levels wheel(256 + 64 * 4 slots), cover 2^32 ms delay,
+ *        schedule and cancel are O(1), timer records held in slab, linked by index.
+ *        Timer Id encode record index and generation: (generation << 32) | index.
+ */
+class LLBC_HIDDEN LLBC_TimingWheel
+{
+public:
+    LLBC_TimingWheel();
+    ~LLBC_TimingWheel();
+
+public:
+    /**
+     * Drive timing wheel, fire all expired timers.
+     */
+    void Update();
+
+    /**
+     * Get the next timer timeout remaining time.
+     * @return sint64 - the remaining time, in milli-seconds, 0 means already timeout,
+     *                  -1 means no timer scheduling. If nearest timer not in first level
+     *                  wheel, return the next cascade remaining time.
+     */
+    sint64 GetNextTimeout() const;
+
+    /**
+     * Get the scheduling timers count.
+     * @return size_t - the scheduling timers count.
+     */
+    size_t GetSize() const;
+
+public:
+    /**
+     * Schedule timer.
+     * @param[in] timer - timer object.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Schedule(LLBC_BaseTimer *timer);
+
+    /**
+     * Cancel timer.
+     * @param[in] timer - timer object.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int Cancel(LLBC_BaseTimer *timer);
+
+private:
+    /**
+     * The timer record, held in slab.
+     */
+    struct _Entry
+    {
+        uint64 expire;
+        uint64 period;
+        LLBC_BaseTimer *timer;
+
+        uint32 generation;
+        uint32 slot;
+        uint32 prev;
+        uint32 next;
+    };
+
+    /**
+     * Allocate/Release timer record.
+     */
+    uint32 AllocEntry();
+    void ReleaseEntry(uint32 idx);
+
+    /**
+     * Link record to the slot which match its expire time / unlink record from its slot.
+     */
+    void AddEntry(uint32 idx);
+    void LinkEntry(uint32 idx, uint32 slot);
+    void UnlinkEntry(uint32 idx);
+
+    /**
+     * Cascade given level's slot timers to lower levels.
+     * @param[in] level - the wheel level, must >= 1.
+     * @param[in] index - the slot index in this level.
+     * @return uint32 - the slot index.
+     */
+    uint32 Cascade(int level, uint32 index);
+
+    /**
+     * Process current tick, fire all timers in current tick slot.
+     */
+    void Tick();
+
+    LLBC_DISABLE_ASSIGNMENT(LLBC_TimingWheel);
+
+private:
+    uint64 _curTime;
+    size_t _size;
+
+    std::vector<_Entry> _entries;
+    uint32 _freeHead;
+
+    uint32 *_heads;
+};
+
+__LLBC_NS_END
+
+#endif // !__LLBC_CORE_TIMER_TIMING_WHEEL_H__
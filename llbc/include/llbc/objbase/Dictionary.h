@@ -308,6 +308,27 @@ public:
      */
     int SetHashBucketSize(size_type bucketSize);
 
+    /**
+     * Get dictionary max load factor.
+     * @return double - the max load factor.
+     */
+    double GetMaxLoadFactor() const;
+
+    /**
+     * Set dictionary max load factor, when elements count / bucket size exceed
+     * this value, dictionary will double the bucket size and incremental rehash
+     * all elements in the following insert/erase operations.
+     * @param[in] maxLoadFactor - the max load factor, must be greater than 0.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    int SetMaxLoadFactor(double maxLoadFactor);
+
+    /**
+     * Check dictionary is in incremental rehashing or not.
+     * @return bool - return true if rehashing, otherwise return false.
+     */
+    bool IsRehashing() const;
+
 public:
     /**
      * Insert/Replace/Erase support.
@@ -405,6 +426,14 @@ private:
     void AddToDoublyLinkedList(LLBC_DictionaryElem *elem);
     void RemoveFromDoublyLinkedList(LLBC_DictionaryElem *elem);
 
+    LLBC_DictionaryElem *FindElem(int key) const;
+    LLBC_DictionaryElem *FindElem(const LLBC_String &key) const;
+
+    void ExpandIfNeed();
+    void StartRehash(size_type newBucketSize);
+    void RehashStep(size_type step);
+    void FinishRehash();
+
     void SerializeInl(LLBC_Stream &s, bool extended) const;
     bool DeSerializeInl(LLBC_Stream &s, bool extended);
 
@@ -416,6 +445,13 @@ private:
     size_type _bucketSize;
     LLBC_DictionaryElem **_bucket;
 
+    size_type _oldBucketSize;
+    LLBC_DictionaryElem **_oldBucket;
+    size_type _rehashIdx;
+
+    double _maxLoadFactor;
+    const LLBC_KeyHashAlgorithm::HashBase &_hashFun;
+
     LLBC_ObjectFactory *_objFactory;
 };
 
@@ -186,6 +186,7 @@ public:
 private:
     int _intKey;
     LLBC_String *_strKey;
+    uint32 _keyHash;
     uint32 _hash;
 
     LLBC_Object *_obj;
@@ -47,12 +47,35 @@ LLBC_BasePoller::LLBC_BasePoller()
 , _brotherCount(0)
 , _svc(NULL)
 , _pollerMgr(NULL)
+, _integratedLoop(false)
+, _sendBufHighWaterMark(0)
+, _recvBlockPool(LLBC_CFG_COMM_POLLER_RECV_BLOCK_SIZE, LLBC_CFG_COMM_POLLER_MAX_IDLE_RECV_BLOCKS)
+
+, _sendCoalescing(false)
+, _sendCoalesceMaxDelay(LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_DELAY)
+, _sendCoalesceMaxBytes(LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES)
+, _dirtySessions()
+, _firstDirtyTime(0)
+
+, _sentPacketCount(0)
+, _sendSyscallCount(0)
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+, _nextMetricsTime(0)
+, _recvPacketCount(0)
+, _recvBytes(0)
+, _reportedSentPacketCount(0)
+, _sentBytes(0)
+, _maxQueueSize(0)
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 
 , _sockets()
 , _sessions()
 
 , _connecting()
 {
+    // Poller always single consumer thread task, producers are service threads and user send threads.
+    this->SetMsgQueueLockFree(LLBC_CFG_COMM_POLLER_LOCK_FREE_MSG_QUEUE != 0);
 }
 
 LLBC_BasePoller::~LLBC_BasePoller()
@@ -110,6 +133,53 @@ void LLBC_BasePoller::SetPollerMgr(LLBC_PollerMgr *mgr)
     _pollerMgr = mgr;
 }
 
+void LLBC_BasePoller::SetIntegratedLoop(bool integrated)
+{
+    _integratedLoop = integrated;
+}
+
+size_t LLBC_BasePoller::GetSendBufHighWaterMark() const
+{
+    return _sendBufHighWaterMark;
+}
+
+void LLBC_BasePoller::SetSendBufHighWaterMark(size_t mark)
+{
+    _sendBufHighWaterMark = mark;
+}
+
+bool LLBC_BasePoller::IsSendCoalescing() const
+{
+    return _sendCoalescing;
+}
+
+size_t LLBC_BasePoller::GetSendCoalesceMaxBytes() const
+{
+    return _sendCoalesceMaxBytes;
+}
+
+void LLBC_BasePoller::SetSendCoalescing(bool coalescing, int maxDelay, size_t maxBytes)
+{
+    _sendCoalescing = coalescing;
+    _sendCoalesceMaxDelay = maxDelay;
+    _sendCoalesceMaxBytes = maxBytes;
+}
+
+uint64 LLBC_BasePoller::GetSentPacketCount() const
+{
+    return _sentPacketCount;
+}
+
+uint64 LLBC_BasePoller::GetSendSyscallCount() const
+{
+    return _sendSyscallCount;
+}
+
+LLBC_MessageBlockPool &LLBC_BasePoller::GetRecvBlockPool()
+{
+    return _recvBlockPool;
+}
+
 int LLBC_BasePoller::Start()
 {
     ASSERT(false && "Please implement LLBC_BasePoller::Start() method!");
@@ -145,6 +215,10 @@ void LLBC_BasePoller::Cleanup()
         delete block;
     }
 
+    // Flush coalesced sends before delete sessions, otherwise they will be dropped(only try once, not
+    // wait socket writable, the data which can't write to socket send buffer still dropped).
+    this->FlushDirtySessions();
+
     // Delete all sessions.
 #if LLBC_TARGET_PLATFORM_WIN32
     for (_Sessions::iterator it = _sessions.begin();
@@ -154,6 +228,7 @@ void LLBC_BasePoller::Cleanup()
 #endif // LLBC_TARGET_PLATFORM_WIN32
     LLBC_STLHelper::DeleteContainer(_sessions);
     _sockets.clear();
+    _dirtySessions.clear();
 
     // Delete all connecting sockets.
     for (_Connecting::iterator it = _connecting.begin();
@@ -162,21 +237,55 @@ void LLBC_BasePoller::Cleanup()
         LLBC_Delete(it->second.socket);
     _connecting.clear();
 
+    // Detach packet pool, all sessions and events deleted, no more packets will be released in this thread.
+    LLBC_PacketPool::Detach();
+
     _started = false;
 }
 
 void LLBC_BasePoller::HandleQueuedEvents(int waitTime)
 {
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    this->UpdateMetrics();
+    uint32 handledCount = 0;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
     LLBC_MessageBlock *block;
-    while (this->TimedPop(block, waitTime) == LLBC_RTN_OK)
+    while (true)
     {
+        // If has send dirty sessions, don't wait, flush them once queue drained.
+        if (_dirtySessions.empty())
+        {
+            if (this->TimedPop(block, waitTime) != LLBC_RTN_OK)
+                break;
+        }
+        else if (this->TryPop(block) != LLBC_RTN_OK)
+        {
+            this->FlushDirtySessions();
+            continue;
+        }
+
         LLBC_PollerEvent &ev = 
             *reinterpret_cast< LLBC_PollerEvent *>(block->GetData());
 
         (this->*_handlers[ev.type])(ev);
 
         LLBC_Delete(block);
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        // Queue maybe never drained, update metrics every batch of events.
+        if ((++handledCount & 0x3f) == 0)
+            this->UpdateMetrics();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+        // Queue never drained, use max delay to bound the added latency.
+        if (!_dirtySessions.empty() &&
+            LLBC_GetMilliSeconds() - _firstDirtyTime >= _sendCoalesceMaxDelay)
+            this->FlushDirtySessions();
     }
+
+    // Queue drained, return the service created packets(sent packets) to service.
+    LLBC_PacketPool::FlushReturns();
 }
 
 void LLBC_BasePoller::HandleEv_AddSock(LLBC_PollerEvent &ev)
@@ -195,13 +304,13 @@ void LLBC_BasePoller::HandleEv_Send(LLBC_PollerEvent &ev)
         _sessions.find(ev.un.packet->GetSessionId());
     if (it == _sessions.end())
     {
-        LLBC_Delete(ev.un.packet);
+        LLBC_PacketPool::Release(ev.un.packet);
         return;
     }
 
     LLBC_Session *session = it->second;
     if (UNLIKELY(session->IsListen()))
-        LLBC_Delete(ev.un.packet);
+        LLBC_PacketPool::Release(ev.un.packet);
     else if (UNLIKELY(session->Send(ev.un.packet) != LLBC_RTN_OK))
         session->OnClose();
 }
@@ -228,9 +337,11 @@ void LLBC_BasePoller::HandleEv_TakeOverSession(LLBC_PollerEvent &ev)
 
 LLBC_Session *LLBC_BasePoller::CreateSession(LLBC_Socket *socket, int sessionId)
 {
+    // In reuse port listen mode, accepted sessions stay on the poller that accepted them.
     if (sessionId == 0)
     {
-        sessionId = _pollerMgr->AllocSessionId();
+        sessionId = _pollerMgr->IsReusePortListen() ? 
+            _pollerMgr->AllocSessionId(_id) : _pollerMgr->AllocSessionId();
     }
 
     LLBC_Session *session = new LLBC_Session();
@@ -243,6 +354,76 @@ LLBC_Session *LLBC_BasePoller::CreateSession(LLBC_Socket *socket, int sessionId)
     return session;
 }
 
+void LLBC_BasePoller::MarkSendDirty(int sessionId)
+{
+    if (_dirtySessions.empty())
+        _firstDirtyTime = LLBC_GetMilliSeconds();
+
+    _dirtySessions.push_back(sessionId);
+}
+
+void LLBC_BasePoller::FlushDirtySessions()
+{
+    // Session maybe closed in flush, so lookup it by session Id.
+    for (size_t i = 0; i < _dirtySessions.size(); i++)
+    {
+        _Sessions::iterator it = _sessions.find(_dirtySessions[i]);
+        if (it != _sessions.end())
+            it->second->FlushSend();
+    }
+
+    _dirtySessions.clear();
+}
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+void LLBC_BasePoller::UpdateMetrics()
+{
+    const size_t queueSize = static_cast<size_t>(this->GetMsgQueueSize());
+    if (queueSize > _maxQueueSize)
+        _maxQueueSize = queueSize;
+
+    const sint64 now = LLBC_GetMilliSeconds();
+    if (now < _nextMetricsTime)
+        return;
+
+    _nextMetricsTime = now + 1000;
+
+    // Collect sessions send backlog, report the slowest session too.
+    size_t sendBacklog = 0;
+    size_t maxSessionSendBacklog = 0;
+    int maxSendBacklogSessionId = 0;
+    for (_Sessions::iterator it = _sessions.begin();
+         it != _sessions.end();
+         it++)
+    {
+        const size_t sessionSendBacklog = it->second->GetSocket()->GetNoSendDataSize();
+        sendBacklog += sessionSendBacklog;
+        if (sessionSendBacklog > maxSessionSendBacklog)
+        {
+            maxSessionSendBacklog = sessionSendBacklog;
+            maxSendBacklogSessionId = it->first;
+        }
+    }
+
+    const uint64 sentPacketCount = _sentPacketCount;
+    _svc->Push(LLBC_SvcEvUtil::BuildPollerMetricsEv(_id,
+                                                    _recvPacketCount,
+                                                    _recvBytes,
+                                                    sentPacketCount - _reportedSentPacketCount,
+                                                    _sentBytes,
+                                                    _maxQueueSize,
+                                                    sendBacklog,
+                                                    maxSessionSendBacklog,
+                                                    maxSendBacklogSessionId));
+
+    _recvPacketCount = 0;
+    _recvBytes = 0;
+    _reportedSentPacketCount = sentPacketCount;
+    _sentBytes = 0;
+    _maxQueueSize = queueSize;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 void LLBC_BasePoller::AddToPoller(LLBC_Session *session)
 {
     const int hash = session->GetId() % _brotherCount;
@@ -12,6 +12,7 @@
 
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/Session.h"
+#include "llbc/comm/ShmChannel.h"
 #include "llbc/comm/ServiceEvent.h"
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/EpollPoller.h"
@@ -30,6 +31,9 @@ __LLBC_NS_BEGIN
 LLBC_EpollPoller::LLBC_EpollPoller()
 : _epoll(LLBC_INVALID_HANDLE)
 , _monitor(NULL)
+
+, _wakeupFd(LLBC_INVALID_HANDLE)
+, _wakeupPending(0)
 {
 }
 
@@ -50,7 +54,8 @@ int LLBC_EpollPoller::Start()
             LLBC_CFG_EPOLL_MAX_LISTEN_FD_SIZE)) == LLBC_INVALID_HANDLE)
         return LLBC_RTN_FAILED;
 
-    if (this->StartupMonitor() != LLBC_RTN_OK)
+    if ((_integratedLoop ? 
+            this->StartupWakeupFd() : this->StartupMonitor()) != LLBC_RTN_OK)
     {
         LLBC_EpollClose(_epoll);
         _epoll = LLBC_INVALID_HANDLE;
@@ -61,6 +66,7 @@ int LLBC_EpollPoller::Start()
     if (this->Activate(1) != LLBC_RTN_OK)
     {
         this->StopMonitor();
+        this->StopWakeupFd();
         LLBC_EpollClose(_epoll);
         _epoll = LLBC_INVALID_HANDLE;
 
@@ -71,20 +77,52 @@ int LLBC_EpollPoller::Start()
     return LLBC_RTN_OK;
 }
 
+int LLBC_EpollPoller::Push(LLBC_MessageBlock *block)
+{
+    if (Base::Push(block) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    // Only the first pusher after poller reset the pending flag need signal eventfd,
+    // other pushers' events will be handled in the same wakeup.
+    if (_integratedLoop &&
+        LLBC_AtomicCompareAndExchange(&_wakeupPending, 1, 0) == 0)
+        LLBC_SignalEventFd(_wakeupFd);
+
+    return LLBC_RTN_OK;
+}
+
 void LLBC_EpollPoller::Svc()
 {
     while (!_started)
         LLBC_Sleep(20);
 
+    LLBC_PacketPool::Attach();
+
+    if (!_integratedLoop)
+    {
+        while (!_stopping)
+            this->HandleQueuedEvents(20);
+
+        return;
+    }
+
     while (!_stopping)
     {
-        this->HandleQueuedEvents(20);
+        this->HandleQueuedEvents(0);
+
+        const int ret = LLBC_EpollWait(_epoll,
+                                       _events,
+                                       LLBC_CFG_COMM_MAX_EVENT_COUNT,
+                                       50);
+        if (ret > 0)
+            this->HandleIoEvents(_events, ret);
     }
 }
 
 void LLBC_EpollPoller::Cleanup()
 {
     this->StopMonitor();
+    this->StopWakeupFd();
 
     LLBC_EpollClose(_epoll);
     _epoll = LLBC_INVALID_HANDLE;
@@ -150,47 +188,7 @@ void LLBC_EpollPoller::HandleEv_Monitor(LLBC_PollerEvent &ev)
     LLBC_EpollEvent *evs = 
         reinterpret_cast<LLBC_EpollEvent *>(ev.un.monitorEv + sizeof(int));
 
-    for (int i = 0; i < count; i++)
-    {
-        const LLBC_EpollEvent &ev = evs[i];
-        if (this->HandleConnecting(ev.data.fd, ev.events))
-            continue;
-
-        _Sockets::iterator it = _sockets.find(ev.data.fd);
-        if (UNLIKELY(it == _sockets.end()))
-            continue;
-
-        LLBC_Session *session = it->second;
-        if (ev.events & (EPOLLHUP|EPOLLERR))
-        {
-            session->OnClose();
-        }
-        else
-        {
-            if (ev.events & EPOLLIN)
-            {
-                if (session->IsListen())
-                {
-                    this->Accept(session);
-                    continue;
-                }
-                else
-                {
-                    session->OnRecv();
-                }
-            }
-            if (ev.events & EPOLLOUT)
-            {
-                // Maybe in session removed while calling OnRecv() method.
-                if ((ev.events & EPOLLIN) && 
-                        UNLIKELY(_sockets.find(
-                            ev.data.fd) == _sockets.end()))
-                    continue;
-
-                session->OnSend();
-            }
-       }
-    }
+    this->HandleIoEvents(evs, count);
 
     LLBC_Free(ev.un.monitorEv);
 }
@@ -214,6 +212,22 @@ void LLBC_EpollPoller::AddSession(LLBC_Session *session)
         epev.events |= EPOLLOUT;
 
     LLBC_EpollCtl(_epoll, EPOLL_CTL_ADD, handle, &epev);
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Shared-memory channel session, listen channel doorbell too, if doorbell already rang
+    // before add, ET mode still report it once.
+    LLBC_ShmChannel *channel = sock->GetShmChannel();
+    if (channel)
+    {
+        const LLBC_Handle doorbell = channel->GetDoorbell();
+
+        epev.data.fd = doorbell;
+        epev.events = EPOLLIN | EPOLLET;
+        LLBC_EpollCtl(_epoll, EPOLL_CTL_ADD, doorbell, &epev);
+
+        _shmDoorbells.insert(std::make_pair(doorbell, session));
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX
 }
 
 void LLBC_EpollPoller::RemoveSession(LLBC_Session *session)
@@ -224,6 +238,17 @@ void LLBC_EpollPoller::RemoveSession(LLBC_Session *session)
     epev.events = EPOLLIN | EPOLLOUT | EPOLLET | EPOLLHUP | EPOLLERR;
     LLBC_EpollCtl(_epoll, EPOLL_CTL_DEL, session->GetSocketHandle(), &epev);
 
+#if LLBC_TARGET_PLATFORM_LINUX
+    LLBC_ShmChannel *channel = session->GetSocket()->GetShmChannel();
+    if (channel)
+    {
+        const LLBC_Handle doorbell = channel->GetDoorbell();
+
+        LLBC_EpollCtl(_epoll, EPOLL_CTL_DEL, doorbell, &epev);
+        _shmDoorbells.erase(doorbell);
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
     Base::RemoveSession(session);
 }
 
@@ -259,6 +284,101 @@ void LLBC_EpollPoller::MonitorSvc()
     this->Push(LLBC_PollerEvUtil::BuildEpollMonitorEv(_events, ret));
 }
 
+int LLBC_EpollPoller::StartupWakeupFd()
+{
+    if ((_wakeupFd = LLBC_CreateEventFd()) == LLBC_INVALID_HANDLE)
+        return LLBC_RTN_FAILED;
+
+    LLBC_EpollEvent epev;
+    epev.data.fd = _wakeupFd;
+    epev.events = EPOLLIN;
+    if (LLBC_EpollCtl(_epoll, EPOLL_CTL_ADD, _wakeupFd, &epev) != LLBC_RTN_OK)
+    {
+        this->StopWakeupFd();
+        return LLBC_RTN_FAILED;
+    }
+
+    _wakeupPending = 0;
+
+    return LLBC_RTN_OK;
+}
+
+void LLBC_EpollPoller::StopWakeupFd()
+{
+    if (_wakeupFd == LLBC_INVALID_HANDLE)
+        return;
+
+    LLBC_CloseEventFd(_wakeupFd);
+    _wakeupFd = LLBC_INVALID_HANDLE;
+}
+
+void LLBC_EpollPoller::HandleIoEvents(const LLBC_EpollEvent *evs, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const LLBC_EpollEvent &ev = evs[i];
+        if (ev.data.fd == _wakeupFd)
+        {
+            // Reset eventfd first, then reset pending flag, queued events will be
+            // handled in next loop.
+            LLBC_ResetEventFd(_wakeupFd);
+            LLBC_AtomicSet(&_wakeupPending, 0);
+
+            continue;
+        }
+
+#if LLBC_TARGET_PLATFORM_LINUX
+        if (!_shmDoorbells.empty())
+        {
+            _ShmDoorbells::iterator dbIt = _shmDoorbells.find(ev.data.fd);
+            if (dbIt != _shmDoorbells.end())
+            {
+                dbIt->second->GetSocket()->OnShmWakeup();
+                continue;
+            }
+        }
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+        if (this->HandleConnecting(ev.data.fd, ev.events))
+            continue;
+
+        _Sockets::iterator it = _sockets.find(ev.data.fd);
+        if (UNLIKELY(it == _sockets.end()))
+            continue;
+
+        LLBC_Session *session = it->second;
+        if (ev.events & (EPOLLHUP|EPOLLERR))
+        {
+            session->OnClose();
+        }
+        else
+        {
+            if (ev.events & EPOLLIN)
+            {
+                if (session->IsListen())
+                {
+                    this->Accept(session);
+                    continue;
+                }
+                else
+                {
+                    session->OnRecv();
+                }
+            }
+            if (ev.events & EPOLLOUT)
+            {
+                // Maybe in session removed while calling OnRecv() method.
+                if ((ev.events & EPOLLIN) && 
+                        UNLIKELY(_sockets.find(
+                            ev.data.fd) == _sockets.end()))
+                    continue;
+
+                session->OnSend();
+            }
+       }
+    }
+}
+
 bool LLBC_EpollPoller::HandleConnecting(LLBC_SocketHandle handle, int events)
 {
     _Connecting::iterator it = _connecting.find(handle);
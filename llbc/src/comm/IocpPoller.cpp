@@ -83,6 +83,8 @@ void LLBC_IocpPoller::Svc()
     while (!_started)
         LLBC_Sleep(20);
 
+    LLBC_PacketPool::Attach();
+
     while (!_stopping)
         this->HandleQueuedEvents(20);
 }
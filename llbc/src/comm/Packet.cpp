@@ -11,6 +11,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/comm/PacketHeaderDescAccessor.h"
+#include "llbc/comm/headerdesc/PacketHeaderLayout.h"
 
 #include "llbc/comm/ICoder.h"
 #include "llbc/comm/Packet.h"
@@ -18,6 +19,7 @@
 namespace
 {
     typedef LLBC_NS LLBC_PacketHeaderDescAccessor _HDAccessor;
+    typedef LLBC_NS LLBC_LibPacketHeaderLayout _StaticLayout;
 }
 
 __LLBC_INTERNAL_NS_BEGIN
@@ -32,6 +34,7 @@ LLBC_Packet::LLBC_Packet()
 : _headerDesc(_HDAccessor::GetHeaderDesc())
 , _lenSize(_HDAccessor::GetHeaderDesc()->GetLenPartLen())
 , _lenOffset(_HDAccessor::GetHeaderDesc()->GetLenPartOffset())
+, _staticLayout(_HDAccessor::IsStaticLayout())
 
 , _sessionId(0)
 
@@ -43,6 +46,11 @@ LLBC_Packet::LLBC_Packet()
 
 , _preHandleResult(NULL)
 , _resultClearDeleg(NULL)
+
+, _sharedPayload(NULL)
+
+, _pool(NULL)
+, _poolNext(NULL)
 {
     const size_t headerLen = _headerDesc->GetHeaderLen();
     _block = new LLBC_MessageBlock(headerLen);
@@ -63,10 +71,19 @@ LLBC_Packet::~LLBC_Packet()
 #endif // LLBC_CFG_COMM_ENABLE_STATUS_DESC
 
     LLBC_XDelete(_block);
+    LLBC_XDelete(_sharedPayload);
+
+    if (_pool)
+        _pool->Unref();
 }
 
 int LLBC_Packet::GetLength() const
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+        return _StaticLayout::LenPart::Get(_block->GetData());
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     const char *lenBeg =
         reinterpret_cast<const char *>(_block->GetData()) + _lenOffset;
 
@@ -78,6 +95,11 @@ int LLBC_Packet::GetLength() const
 
 int LLBC_Packet::GetOpcode() const
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+        return _StaticLayout::OpcodePart::Get(_block->GetData());
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasOpcodePart())
         return 0;
 
@@ -95,6 +117,14 @@ int LLBC_Packet::GetOpcode() const
 
 void LLBC_Packet::SetOpcode(int opcode)
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+    {
+        _StaticLayout::OpcodePart::Set(_block->GetData(), opcode);
+        return;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasOpcodePart())
         return;
 
@@ -109,6 +139,11 @@ void LLBC_Packet::SetOpcode(int opcode)
 
 int LLBC_Packet::GetStatus() const
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+        return _StaticLayout::StatusPart::Get(_block->GetData());
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasStatusPart())
         return 0;
 
@@ -126,6 +161,14 @@ int LLBC_Packet::GetStatus() const
 
 void LLBC_Packet::SetStatus(int status)
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+    {
+        _StaticLayout::StatusPart::Set(_block->GetData(), status);
+        return;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasStatusPart())
         return;
 
@@ -155,6 +198,11 @@ void LLBC_Packet::SetStatusDesc(const LLBC_String &desc)
 
 int LLBC_Packet::GetServiceId() const
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+        return _StaticLayout::ServiceIdPart::Get(_block->GetData());
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasServiceIdPart())
         return 0;
 
@@ -172,6 +220,14 @@ int LLBC_Packet::GetServiceId() const
 
 void LLBC_Packet::SetServiceId(int serviceId)
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+    {
+        _StaticLayout::ServiceIdPart::Set(_block->GetData(), serviceId);
+        return;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasServiceIdPart())
         return;
 
@@ -186,6 +242,11 @@ void LLBC_Packet::SetServiceId(int serviceId)
 
 int LLBC_Packet::GetFlags() const
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+        return _StaticLayout::FlagsPart::Get(_block->GetData());
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasFlagsPart())
         return 0;
 
@@ -203,6 +264,14 @@ int LLBC_Packet::GetFlags() const
 
 void LLBC_Packet::SetFlags(int flags)
 {
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    if (LIKELY(_staticLayout))
+    {
+        _StaticLayout::FlagsPart::Set(_block->GetData(), flags);
+        return;
+    }
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+
     if (!_headerDesc->IsHasFlagsPart())
         return;
 
@@ -233,6 +302,27 @@ void LLBC_Packet::RemoveFlags(int flags)
     this->SetFlags(oldFlags & (~flags));
 }
 
+bool LLBC_Packet::IsPayloadCompressed() const
+{
+    return (this->GetFlags() & this->GetCompressedFlagMask()) != 0;
+}
+
+void LLBC_Packet::SetPayloadCompressed(bool compressed)
+{
+    const int compressedMask = this->GetCompressedFlagMask();
+    this->SetFlags((this->GetFlags() & ~compressedMask) | (compressed ? compressedMask : 0));
+}
+
+int LLBC_Packet::GetCompressedFlagMask() const
+{
+    const size_t flagsLen = _headerDesc->IsHasFlagsPart() ? _headerDesc->GetFlagsPartLen() : 0;
+
+    if (flagsLen == 0 || flagsLen > sizeof(int))
+        return 0;
+
+    return static_cast<int>(~((1u << (flagsLen * 8 - 1)) - 1));
+}
+
 sint8 LLBC_Packet::GetHeaderPartAsSInt8(int serialNo) const
 {
     sint8 val;
@@ -558,15 +648,55 @@ int LLBC_Packet::WriteHeader(const void *buf)
 
 void *LLBC_Packet::GetPayload() const
 {
+    if (_sharedPayload)
+        return _sharedPayload->GetDataStartWithReadPos();
+
     return const_cast<char *>(reinterpret_cast<
         const char *>(_block->GetData()) + _headerDesc->GetHeaderLen());
 }
 
 size_t LLBC_Packet::GetPayloadLength() const
 {
+    if (_sharedPayload)
+        return _sharedPayload->GetReadableSize();
+
     return _block->GetWritePos() - _headerDesc->GetHeaderLen();
 }
 
+int LLBC_Packet::SetPayload(const void *buf, size_t len)
+{
+    const size_t headerLen = _headerDesc->GetHeaderLen();
+    _block->SetReadPos(headerLen);
+    _block->SetWritePos(headerLen);
+
+    LLBC_XDelete(_sharedPayload);
+
+    return _block->Write(buf, len);
+}
+
+int LLBC_Packet::SetSharedPayload(LLBC_MessageBlock *payload)
+{
+    if (UNLIKELY(!payload || payload->GetReadableSize() == 0))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+    }
+
+    const size_t headerLen = _headerDesc->GetHeaderLen();
+    _block->SetReadPos(headerLen);
+    _block->SetWritePos(headerLen);
+
+    LLBC_XDelete(_sharedPayload);
+    _sharedPayload = payload->Share();
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_Packet::IsPayloadShared() const
+{
+    return _sharedPayload != NULL;
+}
+
 LLBC_ICoder *LLBC_Packet::GetEncoder() const
 {
     return _encoder;
@@ -601,6 +731,15 @@ LLBC_MessageBlock *LLBC_Packet::GiveUp()
     size_t length = block->GetWritePos();
     length -= _headerDesc->GetLenPartNotIncludedLen();
 
+    // Link the shared payload after header block.
+    if (_sharedPayload)
+    {
+        length += _sharedPayload->GetReadableSize();
+
+        block->SetNext(_sharedPayload);
+        _sharedPayload = NULL;
+    }
+
     char *lenBeg = reinterpret_cast<
         char *>(block->GetData()) + _lenOffset;
 
@@ -643,6 +782,74 @@ void LLBC_Packet::CleanupPreHandleResult()
     }
 }
 
+void LLBC_Packet::Reset()
+{
+    this->CleanupPreHandleResult();
+
+    _sessionId = 0;
+
+    LLBC_XDelete(_encoder);
+    LLBC_XDelete(_decoder);
+#if LLBC_CFG_COMM_ENABLE_STATUS_DESC
+    LLBC_XDelete(_statusDesc);
+#endif // LLBC_CFG_COMM_ENABLE_STATUS_DESC
+
+    LLBC_XDelete(_sharedPayload);
+
+    // Don't pool shared or too large block.
+    if (_block &&
+        (_block->IsShared() ||
+         _block->IsAttach() ||
+         _block->GetSize() > LLBC_CFG_COMM_PACKET_POOL_MAX_BLOCK_SIZE))
+        LLBC_XDelete(_block);
+}
+
+void LLBC_Packet::ResetBlock(size_t minSize)
+{
+    const size_t headerLen = _headerDesc->GetHeaderLen();
+    if (!_block)
+        _block = LLBC_New1(LLBC_MessageBlock, MAX(minSize, headerLen));
+    else if (_block->GetSize() < minSize)
+        _block->Allocate(minSize - _block->GetSize());
+
+    LLBC_MemSet(_block->GetData(), 0, headerLen);
+
+    _block->SetReadPos(headerLen);
+    _block->SetWritePos(headerLen);
+}
+
+void LLBC_Packet::PrepareLocalDeliver()
+{
+    // Receiver read payload from header block, so copy the shared payload.
+    if (_sharedPayload)
+    {
+        _block->Write(_sharedPayload->GetDataStartWithReadPos(),
+                      _sharedPayload->GetReadableSize());
+        LLBC_Delete(_sharedPayload);
+        _sharedPayload = NULL;
+    }
+
+    this->UpdateLengthPart();
+}
+
+void LLBC_Packet::UpdateLengthPart()
+{
+    const size_t length =
+        _block->GetWritePos() - _headerDesc->GetLenPartNotIncludedLen();
+
+    char *lenBeg = reinterpret_cast<
+        char *>(_block->GetData()) + _lenOffset;
+
+    this->RawSetNonFloatTypeHeaderPartVal(lenBeg, _lenSize, length);
+}
+
+void LLBC_Packet::HandOverEncoder()
+{
+    LLBC_XDelete(_decoder);
+    _decoder = _encoder;
+    _encoder = NULL;
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -13,6 +13,7 @@
 #include "llbc/comm/IService.h"
 
 #include "llbc/comm/headerdesc/PacketHeaderDesc.h"
+#include "llbc/comm/headerdesc/PacketHeaderLayout.h"
 
 #include "llbc/comm/LibPacketHeaderDescFactory.h"
 #include "llbc/comm/PacketHeaderDescAccessor.h"
@@ -20,12 +21,13 @@
 __LLBC_NS_BEGIN
 
 LLBC_PacketHeaderDesc *LLBC_PacketHeaderDescAccessor::_headerDesc = NULL;
+bool LLBC_PacketHeaderDescAccessor::_staticLayout = false;
 
 const LLBC_PacketHeaderDesc *LLBC_PacketHeaderDescAccessor::GetHeaderDesc(bool tryCreate)
 {
     if (UNLIKELY(!_headerDesc))
         if (tryCreate)
-            _headerDesc = LLBC_LibPacketHeaderDescFactory().Create();
+            SetPacketDesc(LLBC_LibPacketHeaderDescFactory().Create());
 
     return _headerDesc;
 }
@@ -39,13 +41,22 @@ int LLBC_PacketHeaderDescAccessor::SetPacketDesc(LLBC_PacketHeaderDesc *headerDe
     }
 
     _headerDesc = headerDesc;
+#if LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
+    _staticLayout = LLBC_LibPacketHeaderLayout::IsMatch(_headerDesc);
+#endif // LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT
 
     return LLBC_RTN_OK;
 }
 
+bool LLBC_PacketHeaderDescAccessor::IsStaticLayout()
+{
+    return _staticLayout;
+}
+
 void LLBC_PacketHeaderDescAccessor::CleanupHeaderDesc()
 {
     LLBC_XDelete(_headerDesc);
+    _staticLayout = false;
 }
 
 __LLBC_NS_END
@@ -0,0 +1,396 @@
+/**
+ * @file    PacketPool.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/Packet.h"
+#include "llbc/comm/PacketPool.h"
+
+namespace
+{
+    typedef LLBC_NS LLBC_PacketPool This;
+}
+
+__LLBC_NS_BEGIN
+
+LLBC_PacketPool *LLBC_PacketPool::Attach()
+{
+#if LLBC_CFG_COMM_ENABLE_PACKET_POOL
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+
+    This *pool = reinterpret_cast<This *>(tls->commTls.packetPool);
+    if (!pool)
+    {
+        pool = LLBC_New(This);
+        tls->commTls.packetPool = pool;
+    }
+
+    pool->_attachCount += 1;
+
+    return pool;
+#else // !LLBC_CFG_COMM_ENABLE_PACKET_POOL
+    return NULL;
+#endif // LLBC_CFG_COMM_ENABLE_PACKET_POOL
+}
+
+void LLBC_PacketPool::Detach()
+{
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+
+    This *pool = reinterpret_cast<This *>(tls->commTls.packetPool);
+    if (!pool || --pool->_attachCount > 0)
+        return;
+
+    tls->commTls.packetPool = NULL;
+
+    // Return all pending batches.
+    for (int i = 0; i < LLBC_CFG_COMM_PACKET_POOL_MAX_RETURN_BATCHES; i++)
+    {
+        if (pool->_batches[i].owner)
+            This::ReturnBatch(pool->_batches[i]);
+    }
+
+    // Mark detached, after that, returned packets will be deleted directly.
+    pool->_returnedLock.Lock();
+    pool->_detached = true;
+    LLBC_Packet *returned = pool->_returned;
+    pool->_returned = NULL;
+    pool->_returnedCount = 0;
+    pool->_returnedLock.Unlock();
+
+    LLBC_Packet *packet;
+    while (returned)
+    {
+        packet = returned;
+        returned = returned->_poolNext;
+
+        LLBC_Delete(packet);
+    }
+
+    while (pool->_idle)
+    {
+        packet = pool->_idle;
+        pool->_idle = pool->_idle->_poolNext;
+
+        LLBC_Delete(packet);
+    }
+
+    pool->_idleCount = 0;
+
+    // Release owner thread reference, if no alive packets, pool will be deleted.
+    pool->Unref();
+}
+
+LLBC_PacketPool *LLBC_PacketPool::GetThreadPool()
+{
+    return reinterpret_cast<This *>(__LLBC_GetLibTls()->commTls.packetPool);
+}
+
+LLBC_Packet *LLBC_PacketPool::Acquire()
+{
+    This *pool = This::GetThreadPool();
+    if (!pool)
+        return LLBC_New(LLBC_Packet);
+
+    return pool->AcquireIdle();
+}
+
+void LLBC_PacketPool::Release(LLBC_Packet *packet)
+{
+    if (UNLIKELY(!packet))
+        return;
+
+    This *pool = This::GetThreadPool();
+    This *owner = packet->_pool;
+    if (owner == pool)
+    {
+        if (pool)
+            pool->ReleaseIdle(packet);
+        else
+            LLBC_Delete(packet);
+    }
+    else if (!owner)
+    {
+        // Adopt non-pooled packet.
+        pool->AddRef();
+        packet->_pool = pool;
+
+        pool->ReleaseIdle(packet);
+    }
+    else if (pool)
+    {
+        pool->HoldForeign(packet);
+    }
+    else
+    {
+        packet->Reset();
+
+        _Batch batch = {owner, packet, packet, 1};
+        This::ReturnBatch(batch);
+    }
+}
+
+void LLBC_PacketPool::FlushReturns()
+{
+    This *pool = This::GetThreadPool();
+    if (!pool)
+        return;
+
+    for (int i = 0; i < LLBC_CFG_COMM_PACKET_POOL_MAX_RETURN_BATCHES; i++)
+    {
+        if (pool->_batches[i].owner)
+            This::ReturnBatch(pool->_batches[i]);
+    }
+}
+
+size_t LLBC_PacketPool::GetIdleCount() const
+{
+    return _idleCount;
+}
+
+uint64 LLBC_PacketPool::GetAcquireCount() const
+{
+    return _acquireCount;
+}
+
+uint64 LLBC_PacketPool::GetHitCount() const
+{
+    return _hitCount;
+}
+
+double LLBC_PacketPool::GetHitRate() const
+{
+    return _acquireCount > 0 ?
+        static_cast<double>(_hitCount) / _acquireCount : 0.0;
+}
+
+uint64 LLBC_PacketPool::GetReleaseCount() const
+{
+    return _releaseCount;
+}
+
+uint64 LLBC_PacketPool::GetForeignReleaseCount() const
+{
+    return _foreignReleaseCount;
+}
+
+uint64 LLBC_PacketPool::GetReturnBatchCount() const
+{
+    return _returnBatchCount;
+}
+
+uint64 LLBC_PacketPool::GetFreeCount() const
+{
+    return _freeCount;
+}
+
+LLBC_PacketPool::LLBC_PacketPool()
+: _attachCount(0)
+, _refCount(1)
+
+, _idle(NULL)
+, _idleCount(0)
+
+, _returnedLock()
+, _detached(false)
+, _returned(NULL)
+, _returnedCount(0)
+
+, _acquireCount(0)
+, _hitCount(0)
+, _releaseCount(0)
+, _foreignReleaseCount(0)
+, _returnBatchCount(0)
+, _freeCount(0)
+{
+    LLBC_MemSet(_batches, 0, sizeof(_batches));
+}
+
+LLBC_PacketPool::~LLBC_PacketPool()
+{
+}
+
+LLBC_Packet *LLBC_PacketPool::AcquireIdle()
+{
+    _acquireCount += 1;
+
+    // Idle list empty, try reclaim the packets returned by other threads.
+    if (!_idle && _returnedCount > 0)
+        this->Reclaim();
+
+    LLBC_Packet *packet = _idle;
+    if (LIKELY(packet))
+    {
+        _hitCount += 1;
+
+        _idle = packet->_poolNext;
+        _idleCount -= 1;
+
+        packet->_poolNext = NULL;
+    }
+    else
+    {
+        packet = LLBC_New(LLBC_Packet);
+        packet->_pool = this;
+
+        this->AddRef();
+    }
+
+    packet->ResetBlock(LLBC_CFG_COMM_PACKET_POOL_BLOCK_SIZE);
+
+    return packet;
+}
+
+void LLBC_PacketPool::ReleaseIdle(LLBC_Packet *packet)
+{
+    _releaseCount += 1;
+    if (_idleCount >= LLBC_CFG_COMM_PACKET_POOL_MAX_IDLE)
+    {
+        _freeCount += 1;
+        LLBC_Delete(packet);
+
+        return;
+    }
+
+    packet->Reset();
+
+    packet->_poolNext = _idle;
+    _idle = packet;
+    _idleCount += 1;
+}
+
+void LLBC_PacketPool::Reclaim()
+{
+    _returnedLock.Lock();
+    LLBC_Packet *returned = _returned;
+    _returned = NULL;
+    _returnedCount = 0;
+    _returnedLock.Unlock();
+
+    LLBC_Packet *packet;
+    while (returned)
+    {
+        packet = returned;
+        returned = returned->_poolNext;
+
+        if (_idleCount < LLBC_CFG_COMM_PACKET_POOL_MAX_IDLE)
+        {
+            packet->_poolNext = _idle;
+            _idle = packet;
+            _idleCount += 1;
+        }
+        else
+        {
+            _freeCount += 1;
+            LLBC_Delete(packet);
+        }
+    }
+}
+
+void LLBC_PacketPool::HoldForeign(LLBC_Packet *packet)
+{
+    _releaseCount += 1;
+    _foreignReleaseCount += 1;
+
+    // Reset packet in releasing thread, owner pool just relink it when reclaim.
+    packet->Reset();
+
+    // Find the owner's pending batch, if not found, use a free batch, if all batches
+    // in using, return the first batch to make room.
+    This *owner = packet->_pool;
+    _Batch *batch = NULL;
+    _Batch *freeBatch = NULL;
+    for (int i = 0; i < LLBC_CFG_COMM_PACKET_POOL_MAX_RETURN_BATCHES; i++)
+    {
+        if (_batches[i].owner == owner)
+        {
+            batch = &_batches[i];
+            break;
+        }
+        else if (!_batches[i].owner && !freeBatch)
+        {
+            freeBatch = &_batches[i];
+        }
+    }
+
+    if (!batch)
+    {
+        if (!freeBatch)
+        {
+            freeBatch = &_batches[0];
+            _returnBatchCount += 1;
+            This::ReturnBatch(*freeBatch);
+        }
+
+        packet->_poolNext = NULL;
+
+        batch = freeBatch;
+        batch->owner = owner;
+        batch->head = batch->tail = packet;
+        batch->count = 1;
+    }
+    else
+    {
+        packet->_poolNext = batch->head;
+        batch->head = packet;
+        batch->count += 1;
+    }
+
+    if (batch->count >= LLBC_CFG_COMM_PACKET_POOL_RETURN_BATCH_SIZE)
+    {
+        _returnBatchCount += 1;
+        This::ReturnBatch(*batch);
+    }
+}
+
+void LLBC_PacketPool::ReturnBatch(_Batch &batch)
+{
+    This *owner = batch.owner;
+    LLBC_Packet *head = batch.head;
+
+    owner->_returnedLock.Lock();
+    if (!owner->_detached &&
+        owner->_returnedCount < LLBC_CFG_COMM_PACKET_POOL_MAX_IDLE)
+    {
+        batch.tail->_poolNext = owner->_returned;
+        owner->_returned = head;
+        owner->_returnedCount += batch.count;
+
+        head = NULL;
+    }
+    owner->_returnedLock.Unlock();
+
+    // Owner pool detached or too many returned packets not reclaim, delete batch packets.
+    LLBC_Packet *packet;
+    while (head)
+    {
+        packet = head;
+        head = head->_poolNext;
+
+        LLBC_Delete(packet);
+    }
+
+    LLBC_MemSet(&batch, 0, sizeof(batch));
+}
+
+void LLBC_PacketPool::AddRef()
+{
+    (void)LLBC_AtomicFetchAndAdd(&_refCount, 1);
+}
+
+void LLBC_PacketPool::Unref()
+{
+    if (LLBC_AtomicFetchAndSub(&_refCount, 1) == 1)
+        LLBC_Delete(this);
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -135,7 +135,7 @@ void LLBC_PollerEvUtil::DestroyEv(LLBC_PollerEvent &ev)
         break;
 
     case _Ev::Send:
-        LLBC_Delete(ev.un.packet);
+        LLBC_PacketPool::Release(ev.un.packet);
         break;
 
     case _Ev::Monitor:
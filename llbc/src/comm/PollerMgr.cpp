@@ -40,6 +40,79 @@ static LLBC_NS LLBC_Socket *__CreateSocket(int type)
     return sock;
 }
 
+static LLBC_NS LLBC_Socket *__CreateListenSocket(int type, const LLBC_NS LLBC_SockAddr_IN &local, bool reusePort)
+{
+    LLBC_NS LLBC_Socket *sock;
+    if (!(sock = __CreateSocket(type)))
+    {
+        return NULL;
+    }
+    else if (sock->SetNonBlocking() != LLBC_RTN_OK ||
+            sock->EnableAddressReusable() != LLBC_RTN_OK ||
+            (reusePort && sock->EnablePortReusable() != LLBC_RTN_OK) ||
+            sock->BindTo(local) != LLBC_RTN_OK ||
+            sock->Listen() != LLBC_RTN_OK)
+    {
+        LLBC_Delete(sock);
+        return NULL;
+    }
+
+    return sock;
+}
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+static LLBC_NS LLBC_Socket *__CreateUnixSocket(int type)
+{
+    LLBC_NS LLBC_SocketHandle handle = LLBC_NS LLBC_CreateUnixSocket();
+    if (UNLIKELY(handle == LLBC_INVALID_SOCKET_HANDLE))
+        return NULL;
+
+    LLBC_NS LLBC_Socket *sock = 
+        LLBC_New1(LLBC_NS LLBC_Socket, handle);
+    sock->SetPollerType(type);
+
+    return sock;
+}
+
+static LLBC_NS LLBC_Socket *__CreateUnixListenSocket(int type, const char *path)
+{
+    LLBC_NS LLBC_Socket *sock;
+    if (!(sock = __CreateUnixSocket(type)))
+    {
+        return NULL;
+    }
+    else if (sock->SetNonBlocking() != LLBC_RTN_OK ||
+            sock->BindToUnix(path) != LLBC_RTN_OK ||
+            sock->Listen() != LLBC_RTN_OK)
+    {
+        LLBC_Delete(sock);
+        return NULL;
+    }
+
+    return sock;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+#if LLBC_TARGET_PLATFORM_LINUX
+static LLBC_NS LLBC_Socket *__CreateShmListenSocket(int type, const char *path)
+{
+    LLBC_NS LLBC_Socket *sock;
+    if (!(sock = __CreateUnixSocket(type)))
+    {
+        return NULL;
+    }
+    else if (sock->SetNonBlocking() != LLBC_RTN_OK ||
+            sock->BindToShm(path) != LLBC_RTN_OK ||
+            sock->Listen() != LLBC_RTN_OK)
+    {
+        LLBC_Delete(sock);
+        return NULL;
+    }
+
+    return sock;
+}
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
@@ -47,6 +120,12 @@ __LLBC_NS_BEGIN
 LLBC_PollerMgr::LLBC_PollerMgr()
 : _type(LLBC_PollerType::End)
 , _svc(NULL)
+, _integratedLoop(LLBC_CFG_COMM_DFT_POLLER_INTEGRATED_LOOP != 0)
+, _reusePortListen(false)
+, _sendBufHighWaterMark(LLBC_CFG_COMM_DFT_SEND_BUF_HIGH_WATER_MARK)
+, _sendCoalescing(false)
+, _sendCoalesceMaxDelay(LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_DELAY)
+, _sendCoalesceMaxBytes(LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES)
 
 , _pollerCount(0)
 , _pollers(NULL)
@@ -56,6 +135,8 @@ LLBC_PollerMgr::LLBC_PollerMgr()
 
 , _pendingAddSocks()
 , _pendingAsyncConns()
+, _pendingReusePortListens()
+, _reusePortSiblings()
 {
 }
 
@@ -74,6 +155,64 @@ void LLBC_PollerMgr::SetService(LLBC_IService *svc)
     _svc = svc;
 }
 
+bool LLBC_PollerMgr::IsIntegratedLoop() const
+{
+    return _integratedLoop;
+}
+
+void LLBC_PollerMgr::SetIntegratedLoop(bool integrated)
+{
+    _integratedLoop = integrated;
+}
+
+bool LLBC_PollerMgr::IsReusePortListen() const
+{
+    return _reusePortListen;
+}
+
+void LLBC_PollerMgr::SetReusePortListen(bool reusePort)
+{
+    _reusePortListen = reusePort;
+}
+
+size_t LLBC_PollerMgr::GetSendBufHighWaterMark() const
+{
+    return _sendBufHighWaterMark;
+}
+
+void LLBC_PollerMgr::SetSendBufHighWaterMark(size_t mark)
+{
+    _sendBufHighWaterMark = mark;
+}
+
+bool LLBC_PollerMgr::IsSendCoalescing() const
+{
+    return _sendCoalescing;
+}
+
+void LLBC_PollerMgr::SetSendCoalescing(bool coalescing, int maxDelay, size_t maxBytes)
+{
+    _sendCoalescing = coalescing;
+    _sendCoalesceMaxDelay = maxDelay;
+    _sendCoalesceMaxBytes = maxBytes;
+}
+
+void LLBC_PollerMgr::GetSendStats(uint64 &sentPackets, uint64 &sendSyscalls) const
+{
+    sentPackets = sendSyscalls = 0;
+
+    This *ncThis = const_cast<This *>(this);
+    LLBC_Guard guard(ncThis->_pollerLock);
+    for (int i = 0; i < _pollerCount; i++)
+    {
+        if (!_pollers[i])
+            continue;
+
+        sentPackets += _pollers[i]->GetSentPacketCount();
+        sendSyscalls += _pollers[i]->GetSendSyscallCount();
+    }
+}
+
 int LLBC_PollerMgr::Start(int count)
 {
     if (count <= 0)
@@ -99,6 +238,9 @@ int LLBC_PollerMgr::Start(int count)
         _pollers[i]->SetService(_svc);
         _pollers[i]->SetPollerMgr(this);
         _pollers[i]->SetBrothersCount(count);
+        _pollers[i]->SetIntegratedLoop(_integratedLoop);
+        _pollers[i]->SetSendBufHighWaterMark(_sendBufHighWaterMark);
+        _pollers[i]->SetSendCoalescing(_sendCoalescing, _sendCoalesceMaxDelay, _sendCoalesceMaxBytes);
     }
 
     // Startup all pollers.
@@ -121,6 +263,13 @@ int LLBC_PollerMgr::Start(int count)
                 LLBC_PollerEvUtil::BuildAsyncConnEv(it->first, it->second));
     _pendingAsyncConns.clear();
 
+    // Process reuse port listens, the first listen sockets already pushed to pollers.
+    for (_PendingReusePortListens::iterator it = _pendingReusePortListens.begin();
+         it != _pendingReusePortListens.end();
+         it++)
+        this->ListenOnOtherPollers(it->first, it->second);
+    _pendingReusePortListens.clear();
+
     return LLBC_RTN_OK;
 }
 
@@ -130,6 +279,10 @@ void LLBC_PollerMgr::Stop()
     LLBC_STLHelper::DeleteContainer(_pendingAddSocks);
     // Always cleanup pending async-conn container.
     _pendingAsyncConns.clear();
+    // Always cleanup pending reuse port listen container.
+    _pendingReusePortListens.clear();
+    // Always cleanup reuse port sibling listen sessions container.
+    _reusePortSiblings.clear();
 
     if (_pollers)
     {
@@ -144,30 +297,35 @@ void LLBC_PollerMgr::Stop()
 
 int LLBC_PollerMgr::Listen(const char *ip, uint16 port)
 {
+    // Reuse port listen sockets must bind the same address, kernel assigned port(port 0) differs per socket.
+    if (_reusePortListen && port == 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return 0;
+    }
+
     LLBC_SockAddr_IN local;
     if (This::GetAddr(ip, port, local) != LLBC_RTN_OK)
         return 0;
 
     LLBC_Socket *sock;
-    if (!(sock = LLBC_INL_NS __CreateSocket(_type)))
-    {
-        return 0;
-    }
-    else if (sock->SetNonBlocking() != LLBC_RTN_OK ||
-            sock->EnableAddressReusable() != LLBC_RTN_OK ||
-            sock->BindTo(local) != LLBC_RTN_OK ||
-            sock->Listen() != LLBC_RTN_OK)
-    {
-        LLBC_Delete(sock);
+    if (!(sock = LLBC_INL_NS __CreateListenSocket(_type, local, _reusePortListen)))
         return 0;
-    }
 
     const int sessionId = this->AllocSessionId();
     if (LIKELY(_pollers))
+    {
         _pollers[sessionId % _pollerCount]->Push(
                 LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
+        if (_reusePortListen)
+            this->ListenOnOtherPollers(sessionId, local);
+    }
     else
+    {
         _pendingAddSocks.insert(std::make_pair(sessionId, sock));
+        if (_reusePortListen)
+            _pendingReusePortListens.insert(std::make_pair(sessionId, local));
+    }
 
     return sessionId;
 }
@@ -218,6 +376,129 @@ int LLBC_PollerMgr::AsyncConn(const char *ip, uint16 port)
     return LLBC_RTN_OK;
 }
 
+int LLBC_PollerMgr::ListenUnix(const char *path)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    // Unix domain socket not support reuse port listen, always listen on one poller.
+    LLBC_Socket *sock;
+    if (!(sock = LLBC_INL_NS __CreateUnixListenSocket(_type, path)))
+        return 0;
+
+    const int sessionId = this->AllocSessionId();
+    if (LIKELY(_pollers))
+        _pollers[sessionId % _pollerCount]->Push(
+                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
+    else
+        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
+
+    return sessionId;
+#else // LLBC_TARGET_PLATFORM_WIN32
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return 0;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
+int LLBC_PollerMgr::ConnectUnix(const char *path)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    LLBC_Socket *sock;
+    if (!(sock = LLBC_INL_NS __CreateUnixSocket(_type)))
+        return 0;
+
+    // Unix domain socket connect never in progress, set non-blocking first, avoid blocking caller
+    // when peer listen backlog full(return failed, last error set to LLBC_ERROR_WBLOCK).
+    sock->SetNonBlocking();
+    if (sock->ConnectToUnix(path) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(sock);
+        return 0;
+    }
+
+    const int sessionId = this->AllocSessionId();
+
+    if (LIKELY(_pollers))
+        _pollers[sessionId % _pollerCount]->Push(
+                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
+    else
+        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
+
+    return sessionId;
+#else // LLBC_TARGET_PLATFORM_WIN32
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return 0;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
+int LLBC_PollerMgr::ListenShm(const char *path)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Shared-memory channel doorbells only supported by EpollPoller.
+    if (_type != LLBC_PollerType::EpollPoller)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return 0;
+    }
+
+    LLBC_Socket *sock;
+    if (!(sock = LLBC_INL_NS __CreateShmListenSocket(_type, path)))
+        return 0;
+
+    const int sessionId = this->AllocSessionId();
+    if (LIKELY(_pollers))
+        _pollers[sessionId % _pollerCount]->Push(
+                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
+    else
+        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
+
+    return sessionId;
+#else // Non-LINUX
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return 0;
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+LLBC_Socket *LLBC_PollerMgr::ConnectShm(const char *path, size_t ringSize)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (_type != LLBC_PollerType::EpollPoller)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return NULL;
+    }
+
+    LLBC_Socket *sock;
+    if (!(sock = LLBC_INL_NS __CreateUnixSocket(_type)))
+    {
+        return NULL;
+    }
+    else if (sock->ConnectToShm(path, ringSize) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(sock);
+        return NULL;
+    }
+
+    sock->SetNonBlocking();
+
+    return sock;
+#else // Non-LINUX
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return NULL;
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+int LLBC_PollerMgr::AddConnectedSocket(LLBC_Socket *sock)
+{
+    const int sessionId = this->AllocSessionId();
+
+    if (LIKELY(_pollers))
+        _pollers[sessionId % _pollerCount]->Push(
+                LLBC_PollerEvUtil::BuildAddSockEv(sessionId, sock));
+    else
+        _pendingAddSocks.insert(std::make_pair(sessionId, sock));
+
+    return sessionId;
+}
+
 int LLBC_PollerMgr::Send(LLBC_Packet *packet)
 {
     _pollers[packet->GetSessionId() % 
@@ -228,6 +509,17 @@ int LLBC_PollerMgr::Send(LLBC_Packet *packet)
 void LLBC_PollerMgr::Close(int sessionId)
 {
     _pollers[sessionId % _pollerCount]->Push(LLBC_PollerEvUtil::BuildCloseEv(sessionId));
+
+    // Reuse port listen session, close all other pollers' sibling listen sessions too.
+    _ReusePortSiblings::iterator it = _reusePortSiblings.find(sessionId);
+    if (it != _reusePortSiblings.end())
+    {
+        const std::vector<int> &siblings = it->second;
+        for (size_t i = 0; i < siblings.size(); i++)
+            _pollers[siblings[i] % _pollerCount]->Push(LLBC_PollerEvUtil::BuildCloseEv(siblings[i]));
+
+        _reusePortSiblings.erase(it);
+    }
 }
 
 int LLBC_PollerMgr::AllocSessionId()
@@ -235,6 +527,43 @@ int LLBC_PollerMgr::AllocSessionId()
     return LLBC_AtomicFetchAndAdd(&_maxSessionId, 1);
 }
 
+int LLBC_PollerMgr::AllocSessionId(int pollerId)
+{
+    // Skip to the nearest session Id which hash to given poller, keep session on this poller.
+    int cur, sessionId;
+    do
+    {
+        cur = _maxSessionId;
+        sessionId = cur + (pollerId - cur % _pollerCount + _pollerCount) % _pollerCount;
+    } while (LLBC_AtomicCompareAndExchange(&_maxSessionId, sessionId + 1, cur) != cur);
+
+    return sessionId;
+}
+
+void LLBC_PollerMgr::ListenOnOtherPollers(int sessionId, const LLBC_SockAddr_IN &local)
+{
+    const int firstPollerId = sessionId % _pollerCount;
+    for (int i = 0; i < _pollerCount; i++)
+    {
+        if (i == firstPollerId)
+            continue;
+
+        // If failed, this poller will not accept connections, other listen sockets still working.
+        LLBC_Socket *sock = LLBC_INL_NS __CreateListenSocket(_type, local, true);
+        if (!sock)
+        {
+            trace("LLBC_PollerMgr::ListenOnOtherPollers() create listen socket failed, poller: %d, err: %s\n",
+                  i, LLBC_FormatLastError());
+            continue;
+        }
+
+        const int pollerSessionId = this->AllocSessionId(i);
+        _pollers[i]->Push(LLBC_PollerEvUtil::BuildAddSockEv(pollerSessionId, sock));
+
+        _reusePortSiblings[sessionId].push_back(pollerSessionId);
+    }
+}
+
 int LLBC_PollerMgr::PushMsgToPoller(int id, LLBC_MessageBlock *block)
 {
     LLBC_Guard guard(_pollerLock);
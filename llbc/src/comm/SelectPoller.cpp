@@ -58,6 +58,8 @@ void LLBC_SelectPoller::Svc()
     while (!_started)
         LLBC_Sleep(20);
 
+    LLBC_PacketPool::Attach();
+
     static const int interval = 20;
     LLBC_FdSet reads, writes, excepts;
 
@@ -10,7 +10,10 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include <typeinfo>
+
 #include "llbc/comm/ICoder.h"
+#include "llbc/comm/ICompressor.h"
 #include "llbc/comm/Packet.h"
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/protocol/IProtocol.h"
@@ -18,6 +21,7 @@
 #include "llbc/comm/protocol/ProtocolStack.h"
 #include "llbc/comm/Service.h"
 #include "llbc/comm/ServiceMgr.h"
+#include "llbc/comm/ServiceMetrics.h"
 
 namespace
 {
@@ -29,7 +33,26 @@ __LLBC_INTERNAL_NS_BEGIN
 
 static void __DeletePacket(void *data)
 {
-    LLBC_Delete(reinterpret_cast<LLBC_NS LLBC_Packet *>(data));
+    LLBC_NS LLBC_PacketPool::Release(reinterpret_cast<LLBC_NS LLBC_Packet *>(data));
+}
+
+static LLBC_NS LLBC_MessageBlock *__CreateSharedPayload(const void *bytes, size_t len)
+{
+    if (len == 0)
+        return NULL;
+
+    LLBC_NS LLBC_MessageBlock *payload = LLBC_New1(LLBC_NS LLBC_MessageBlock, len);
+    payload->Write(bytes, len);
+
+    return payload;
+}
+
+static inline LLBC_NS sint64 __MakeStatusHandlerKey(int opcode, int status)
+{
+    // Shift as unsigned, left shift negative opcode is undefined behavior.
+    return static_cast<LLBC_NS sint64>(
+        (static_cast<LLBC_NS uint64>(static_cast<LLBC_NS uint32>(opcode)) << 32) |
+        static_cast<LLBC_NS uint32>(status));
 }
 
 __LLBC_INTERNAL_NS_END
@@ -43,12 +66,15 @@ LLBC_Service::_EvHandler LLBC_Service::_evHandlers[LLBC_SvcEvType::End] =
     &LLBC_Service::HandleEv_AsyncConnResult,
     &LLBC_Service::HandleEv_DataArrival,
     &LLBC_Service::HandleEv_ProtoReport,
+    &LLBC_Service::HandleEv_PollerMetrics,
 
     &LLBC_Service::HandleEv_SubscribeEv,
     &LLBC_Service::HandleEv_UnsubscribeEv,
     &LLBC_Service::HandleEv_FireEv
 };
 
+LLBC_SpinLock LLBC_Service::_localChannelsLock;
+
 // VS2005 and later version compiler support initialize array in construct list.
 // In here, we disable C4351 warning to initialize it.
 #if LLBC_CUR_COMP == LLBC_COMP_MSVC && LLBC_COMP_VER >= 1400
@@ -60,8 +86,9 @@ LLBC_Service::LLBC_Service(This::Type type)
 , _id(0)
 , _driveMode(This::SelfDrive)
 
-, _started(false)
+, _started(0)
 , _stopping(false)
+, _sendingCount(0)
 
 , _lock()
 
@@ -70,32 +97,45 @@ LLBC_Service::LLBC_Service(This::Type type)
 , _begHeartbeatTime(0)
 , _sinkIntoLoop(false)
 , _afterStop(false)
+, _eventDriven(false)
+, _facadesUpdate(true)
+, _nextFrameTime(0)
+, _pollerDecode(false)
 
 , _pollerMgr()
-, _connectedSessionIds()
-, _connectedSessionIdsLock()
+, _localChannels()
+, _localChannelCount(0)
+, _localDeliveringCount(0)
 #if !LLBC_CFG_COMM_USE_FULL_STACK
 , _stack(LLBC_ProtocolStack::CodecStack)
 #endif
 
 , _facades()
 , _coders()
+, _coderTable()
 , _handlers()
+, _handlerTable()
 , _preHandlers()
+, _preHandlerTable()
 #if LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
 , _unifyPreHandler(NULL)
 #endif
 #if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
 , _statusHandlers()
+, _statusHandlerTable()
 #endif
 #if LLBC_CFG_COMM_ENABLE_STATUS_DESC
 , _statusDescs()
+, _statusDescTable()
 #endif
 
-#if LLBC_CUR_COMP == LLBC_COMP_MSVC && LLBC_COMP_VER >= 1400
+#if LLBC_CUR_COMP != LLBC_COMP_MSVC || LLBC_COMP_VER >= 1400
 , _filters()
 #endif
 
+, _compressorFactory(NULL)
+, _compressThreshold(LLBC_CFG_COMM_DFT_COMPRESS_THRESHOLD)
+
 , _beforeFrameTasks()
 , _afterFrameTasks()
 
@@ -109,6 +149,13 @@ LLBC_Service::LLBC_Service(This::Type type)
 
 , _evManager()
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+, _metrics()
+, _metricsUpdateTime(0)
+, _pollerSamplers()
+, _handlerSamplerTable()
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
 , _svcMgr(*LLBC_ServiceMgrSingleton)
 {
     // Get the poller type from Config.h
@@ -124,6 +171,10 @@ LLBC_Service::LLBC_Service(This::Type type)
     LLBC_MemSet(_filters, 0, sizeof(_filters));
 #endif
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_MemSet(_svcSamplers, 0, sizeof(_svcSamplers));
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
     // Create protocol stack.
 #if !LLBC_CFG_COMM_USE_FULL_STACK
     this->CreateCodecStack(&_stack);
@@ -162,6 +213,8 @@ LLBC_Service::~LLBC_Service()
          layer++)
         LLBC_XDelete(_filters[layer]);
 
+    LLBC_XDelete(_compressorFactory);
+
     _handledBeforeFrameTasks = false;
     this->DestroyFrameTasks(_beforeFrameTasks, _handlingBeforeFrameTasks);
     this->DestroyFrameTasks(_afterFrameTasks, _handlingAfterFrameTasks);
@@ -227,6 +280,187 @@ int LLBC_Service::SetDriveMode(This::DriveMode mode)
     return LLBC_RTN_FAILED;
 }
 
+bool LLBC_Service::IsPollerIntegratedLoop() const
+{
+    return _pollerMgr.IsIntegratedLoop();
+}
+
+int LLBC_Service::SetPollerIntegratedLoop(bool integrated)
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _pollerMgr.SetIntegratedLoop(integrated);
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_Service::IsReusePortListen() const
+{
+    return _pollerMgr.IsReusePortListen();
+}
+
+int LLBC_Service::SetReusePortListen(bool reusePort)
+{
+#if LLBC_TARGET_PLATFORM_WIN32 || !defined(SO_REUSEPORT)
+    if (reusePort)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+        return LLBC_RTN_FAILED;
+    }
+#endif // LLBC_TARGET_PLATFORM_WIN32 || !defined(SO_REUSEPORT)
+
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _pollerMgr.SetReusePortListen(reusePort);
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_Service::IsEventDriven() const
+{
+    return _eventDriven;
+}
+
+int LLBC_Service::SetEventDriven(bool eventDriven, bool facadesUpdate)
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _eventDriven = eventDriven;
+    _facadesUpdate = facadesUpdate;
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_Service::IsPollerDecode() const
+{
+#if LLBC_CFG_COMM_USE_FULL_STACK
+    return true;
+#else
+    return _pollerDecode;
+#endif
+}
+
+int LLBC_Service::SetPollerDecode(bool pollerDecode)
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _pollerDecode = pollerDecode;
+
+    return LLBC_RTN_OK;
+}
+
+size_t LLBC_Service::GetSendBufHighWaterMark() const
+{
+    return _pollerMgr.GetSendBufHighWaterMark();
+}
+
+bool LLBC_Service::IsSendCoalescing() const
+{
+    return _pollerMgr.IsSendCoalescing();
+}
+
+int LLBC_Service::SetSendCoalescing(bool coalescing, int maxDelay, size_t maxBytes)
+{
+    if (maxDelay < 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+    }
+    else if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _pollerMgr.SetSendCoalescing(coalescing, maxDelay, maxBytes);
+
+    return LLBC_RTN_OK;
+}
+
+void LLBC_Service::GetSendStats(uint64 &sentPackets, uint64 &sendSyscalls) const
+{
+    // Only read pollers' atomic counters, not need lock.
+    _pollerMgr.GetSendStats(sentPackets, sendSyscalls);
+}
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+const LLBC_SamplerGroup &LLBC_Service::GetMetrics() const
+{
+    return _metrics;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+int LLBC_Service::SetSendBufHighWaterMark(size_t mark)
+{
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _pollerMgr.SetSendBufHighWaterMark(mark);
+
+    return LLBC_RTN_OK;
+}
+
 int LLBC_Service::Start(int pollerCount)
 {
     if (pollerCount <= 0)
@@ -252,6 +486,18 @@ int LLBC_Service::Start(int pollerCount)
         return LLBC_RTN_FAILED;
     }
 
+    // Event-driven mode facades update frame boundary restart from first frame(maybe restart after Stop()).
+    _nextFrameTime = 0;
+    // Stopped in service thread will not reset stopping flag, reset it.
+    _stopping = false;
+
+    // Handlers can't register after started, freeze them to dispatch tables.
+    this->BuildDispatchTables();
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (this->InitMetrics(pollerCount) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
     if (_pollerMgr.Start(pollerCount) != LLBC_RTN_OK)
         return LLBC_RTN_FAILED;
 
@@ -276,7 +522,7 @@ int LLBC_Service::Start(int pollerCount)
         }
     }
 
-    _started = true;
+    LLBC_AtomicSet(&_started, 1);
 
     if (_driveMode == This::ExternalDrive)
         this->InitFacades();
@@ -291,28 +537,38 @@ bool LLBC_Service::IsStarted() const
 
 void LLBC_Service::Stop()
 {
-    LLBC_Guard guard(_lock);
+    {
+        LLBC_Guard guard(_lock);
 
-    if (!_started || _stopping)
-        return;
+        if (!_started || _stopping)
+            return;
 
-    _stopping = true;
-    if (_driveMode == This::SelfDrive)
-        while (_started)
-            LLBC_ThreadManager::Sleep(20);
-    else
-    {
-        if (_sinkIntoLoop)
+        _stopping = true;
+        if (_driveMode == This::ExternalDrive)
         {
-            _afterStop = true;
+            if (_sinkIntoLoop)
+            {
+                _afterStop = true;
+            }
+            else
+            {
+                this->Cleanup();
+                _stopping = false;
+            }
+
             return;
         }
-        else
-        {
-            this->Cleanup();
-        }
+
+        // Stop in service thread(eg: facade callbacks), service thread will cleanup after exit loop.
+        if (this->IsInDriveThread())
+            return;
     }
 
+    // Wait service thread exit outside the lock, service thread need lock to init facades(maybe not
+    // inited yet when stop immediately after start).
+    while (_started)
+        LLBC_ThreadManager::Sleep(20);
+
     _stopping = false;
 }
 
@@ -358,11 +614,7 @@ int LLBC_Service::Connect(const char *ip, uint16 port)
     LLBC_Guard guard(_lock);
     const int sessionId = _pollerMgr.Connect(ip, port);
     if (sessionId != 0)
-    {
-        _connectedSessionIdsLock.Lock();
-        _connectedSessionIds.insert(sessionId);
-        _connectedSessionIdsLock.Unlock();
-    }
+        this->AddConnectedSessionId(sessionId);
 
     return sessionId;
 }
@@ -373,10 +625,95 @@ int LLBC_Service::AsyncConn(const char *ip, uint16 port)
     return _pollerMgr.AsyncConn(ip, port);
 }
 
+int LLBC_Service::ListenUnix(const char *path)
+{
+    LLBC_Guard guard(_lock);
+    return _pollerMgr.ListenUnix(path);
+}
+
+int LLBC_Service::ConnectUnix(const char *path)
+{
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.ConnectUnix(path);
+    if (sessionId != 0)
+        this->AddConnectedSessionId(sessionId);
+
+    return sessionId;
+}
+
+int LLBC_Service::ListenShm(const char *path)
+{
+    LLBC_Guard guard(_lock);
+    return _pollerMgr.ListenShm(path);
+}
+
+int LLBC_Service::ConnectShm(const char *path, size_t ringSize)
+{
+    // Channel handshake blocking(at most LLBC_CFG_COMM_SHM_HANDSHAKE_TIMEOUT), do it outside lock.
+    LLBC_Socket *sock = _pollerMgr.ConnectShm(path, ringSize);
+    if (!sock)
+        return 0;
+
+    LLBC_Guard guard(_lock);
+    const int sessionId = _pollerMgr.AddConnectedSocket(sock);
+    this->AddConnectedSessionId(sessionId);
+
+    return sessionId;
+}
+
+int LLBC_Service::ConnectLocal(int svcId)
+{
+    LLBC_Guard guard(_lock);
+    if (UNLIKELY(!_started || _stopping))
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return 0;
+    }
+
+    LLBC_Service *peer = static_cast<LLBC_Service *>(_svcMgr.GetService(svcId));
+    if (!peer)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+        return 0;
+    }
+
+    // Peer service stop will close its local channels in locked, so check peer state in locked too.
+    LLBC_Guard channelsGuard(_localChannelsLock);
+    if (!peer->_started || peer->_stopping)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return 0;
+    }
+
+    // Both sides session Ids allocate from self poller manager, never conflict with socket sessions.
+    const int sessionId = _pollerMgr.AllocSessionId();
+    const int peerSessionId = peer->_pollerMgr.AllocSessionId();
+
+    _LocalChannel &channel = _localChannels[sessionId];
+    channel.peer = peer;
+    channel.peerSessionId = peerSessionId;
+    LLBC_AtomicFetchAndAdd(&_localChannelCount, 1);
+
+    _LocalChannel &peerChannel = peer->_localChannels[peerSessionId];
+    peerChannel.peer = this;
+    peerChannel.peerSessionId = sessionId;
+    LLBC_AtomicFetchAndAdd(&peer->_localChannelCount, 1);
+
+    const LLBC_SockAddr_IN emptyAddr;
+    this->AddConnectedSessionId(sessionId);
+    this->Push(LLBC_SvcEvUtil::BuildSessionCreateEv(
+        emptyAddr, emptyAddr, false, sessionId, LLBC_INVALID_SOCKET_HANDLE));
+
+    peer->AddConnectedSessionId(peerSessionId);
+    peer->Push(LLBC_SvcEvUtil::BuildSessionCreateEv(
+        emptyAddr, emptyAddr, false, peerSessionId, LLBC_INVALID_SOCKET_HANDLE));
+
+    return sessionId;
+}
+
 int LLBC_Service::Send(LLBC_Packet *packet)
 {
     // Call internal Lockable() to complete.
-    // lock = true
     // validCheck = true
     return this->LockableSend(packet);
 }
@@ -388,7 +725,7 @@ int LLBC_Service::Send2(int sessionId, int opcode, LLBC_ICoder *coder, int statu
 
 int LLBC_Service::Send2(int svcId, int sessionId, int opcode, LLBC_ICoder *coder, int status, LLBC_PacketHeaderParts *parts)
 {
-    LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+    LLBC_Packet *packet = LLBC_PacketPool::Acquire();
     packet->SetHeader(svcId, sessionId, opcode, status);
     if (parts)
     {
@@ -401,7 +738,6 @@ int LLBC_Service::Send2(int svcId, int sessionId, int opcode, LLBC_ICoder *coder
     packet->SetEncoder(coder);
 
     // Call internal LockableSend() to complete.
-    // lock = true
     // validCheck = true
     return this->LockableSend(packet);
 }
@@ -409,7 +745,6 @@ int LLBC_Service::Send2(int svcId, int sessionId, int opcode, LLBC_ICoder *coder
 int LLBC_Service::Send2(int sessionId, int opcode, const void *bytes, size_t len, int status, LLBC_PacketHeaderParts *parts)
 {
     // Call internal LockableSend() to complete.
-    // lock = true
     // validCheck = true
     const int ret = this->LockableSend(0, sessionId, opcode, bytes, len, status, parts);
     if (parts)
@@ -421,7 +756,6 @@ int LLBC_Service::Send2(int sessionId, int opcode, const void *bytes, size_t len
 int LLBC_Service::Send2(int svcId, int sessionId, int opcode, const void *bytes, size_t len, int status, LLBC_PacketHeaderParts *parts)
 {
     // Call internal LockableSend() to complete.
-    // lock = true
     // validCheck = true
     const int ret = this->LockableSend(svcId, sessionId, opcode, bytes, len, status, parts);
     if (parts)
@@ -453,16 +787,15 @@ int LLBC_Service::Multicast2(const LLBC_SessionIdList &sessionIds, int opcode, c
 
 int LLBC_Service::Multicast2(int svcId, const LLBC_SessionIdList &sessionIds, int opcode, const void *bytes, size_t len, int status, LLBC_PacketHeaderParts *parts)
 {
-    LLBC_Guard guard(_lock);
-
-    // Foreach to call internal method LockableSend() method to complete.
-    // lock = false
+    // Foreach to call internal method LockableSend() method to complete, all packets share one payload copy.
     // validCheck = true
+    LLBC_MessageBlock *payload = LLBC_INL_NS __CreateSharedPayload(bytes, len);
     for (LLBC_SessionIdListCIter sessionIt = sessionIds.begin();
          sessionIt != sessionIds.end();
          sessionIt++)
-        this->LockableSend(svcId, *sessionIt, opcode, bytes, len, status, parts, false);
+        this->LockableSend(svcId, *sessionIt, opcode, payload, status, parts);
 
+    LLBC_XDelete(payload);
     if (parts)
         LLBC_Delete(parts);
 
@@ -477,16 +810,8 @@ int LLBC_Service::Broadcast2(int opcode, LLBC_ICoder *coder, int status, LLBC_Pa
 int LLBC_Service::Broadcast2(int svcId, int opcode, LLBC_ICoder *coder, int status, LLBC_PacketHeaderParts *parts)
 {
     // Copy all connected session Ids.
-    int idx = 0;
-
-    _connectedSessionIdsLock.Lock();
-    LLBC_SessionIdList connectedSessionIds(_connectedSessionIds.size());
-    for (LLBC_SessionIdSetCIter sessionIdIt = _connectedSessionIds.begin();
-         sessionIdIt != _connectedSessionIds.end();
-         idx++, sessionIdIt++)
-         connectedSessionIds[idx] = *sessionIdIt;
-
-    _connectedSessionIdsLock.Unlock();
+    LLBC_SessionIdList connectedSessionIds;
+    this->GetConnectedSessionIds(connectedSessionIds);
 
     // Call internal template method MulticastSendCoder<>() to complete.
     // validCheck = false
@@ -504,17 +829,19 @@ int LLBC_Service::Broadcast2(int opcode, const void *bytes, size_t len, int stat
 
 int LLBC_Service::Broadcast2(int svcId, int opcode, const void *bytes, size_t len , int status, LLBC_PacketHeaderParts *parts)
 {
-    LLBC_Guard guard(_lock);
+    // Copy all connected session Ids.
+    LLBC_SessionIdList connectedSessionIds;
+    this->GetConnectedSessionIds(connectedSessionIds);
 
-    // Foreach to call internal method LockableSend() method to complete.
-    // lock = false
+    // Foreach to call internal method LockableSend() method to complete, all packets share one payload copy.
     // validCheck = false
-    LLBC_Guard connSIdsGuard(_connectedSessionIdsLock);
-    for (LLBC_SessionIdSetCIter sessionIt = _connectedSessionIds.begin();
-         sessionIt != _connectedSessionIds.end();
+    LLBC_MessageBlock *payload = LLBC_INL_NS __CreateSharedPayload(bytes, len);
+    for (LLBC_SessionIdListCIter sessionIt = connectedSessionIds.begin();
+         sessionIt != connectedSessionIds.end();
          sessionIt++)
-        this->LockableSend(svcId, *sessionIt, opcode, bytes, len, status, parts, false, false);
+        this->LockableSend(svcId, *sessionIt, opcode, payload, status, parts, false);
 
+    LLBC_XDelete(payload);
     if (parts)
         LLBC_Delete(parts);
 
@@ -530,17 +857,18 @@ int LLBC_Service::RemoveSession(int sessionId)
         return LLBC_RTN_FAILED;
     }
 
-    LLBC_Guard connSIdsGuard(_connectedSessionIdsLock);
+    // Local channel session, remove both sides' sessions.
+    if (LLBC_AtomicGet(&_localChannelCount) > 0 &&
+        this->RemoveLocalChannel(sessionId))
+        return LLBC_RTN_OK;
 
-    LLBC_SessionIdSetIter sessionIdIt = _connectedSessionIds.find(sessionId);
-    if (sessionIdIt == _connectedSessionIds.end())
+    if (!this->RemoveConnectedSessionId(sessionId))
     {
         LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
         return LLBC_RTN_FAILED;
     }
 
     _pollerMgr.Close(sessionId);
-    _connectedSessionIds.erase(sessionIdIt);
 
     return LLBC_RTN_OK;
 }
@@ -778,6 +1106,32 @@ int LLBC_Service::SetProtocolFilter(LLBC_IProtocolFilter *filter, int toLayer)
     return LLBC_RTN_OK;
 }
 
+int LLBC_Service::SetCompressor(LLBC_ICompressorFactory *factory, size_t threshold)
+{
+    if (UNLIKELY(!factory) || _type == This::Raw)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Guard guard(_lock);
+    if (_started)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+    else if (_compressorFactory)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REPEAT);
+        return LLBC_RTN_FAILED;
+    }
+
+    _compressorFactory = factory;
+    _compressThreshold = threshold;
+
+    return LLBC_RTN_OK;
+}
+
 int LLBC_Service::EnableTimerScheduler()
 {
     LLBC_Guard guard(_lock);
@@ -876,6 +1230,8 @@ int LLBC_Service::Post(LLBC_IDelegate1<LLBC_Service::Base *> *deleg)
         }
     }
 
+    this->WakeupEvents();
+
     return LLBC_RTN_OK;
 }
 
@@ -885,6 +1241,9 @@ void LLBC_Service::OnSvc(bool fullFrame)
 
     // Record begin heartbeat time.
     _begHeartbeatTime = LLBC_GetMilliSeconds();
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    const sint64 frameBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 
     // Handle before frame-tasks.
     this->HandleFrameTasks(_beforeFrameTasks, _handlingBeforeFrameTasks);
@@ -893,8 +1252,16 @@ void LLBC_Service::OnSvc(bool fullFrame)
     // Process queued events.
     this->HandleQueuedEvents();
 
-    // Update all compoments.
-    this->UpdateFacades();
+    // Update all compoments, in event-driven mode, facades only update at frame boundary.
+    bool frameTick = true;
+    if (_eventDriven && fullFrame)
+    {
+        if ((frameTick = _begHeartbeatTime >= _nextFrameTime))
+            _nextFrameTime = _begHeartbeatTime + _frameInterval;
+    }
+
+    if (frameTick)
+        this->UpdateFacades();
     this->UpdateTimers();
     this->UpdateAutoReleasePool();
 
@@ -903,14 +1270,29 @@ void LLBC_Service::OnSvc(bool fullFrame)
     _handledBeforeFrameTasks = false;
 
     // Process Idle.
-    this->ProcessIdle();
+    if (frameTick)
+        this->ProcessIdle();
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    this->UpdateMetrics(frameBegTime);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    // Return the pollers created packets(received packets) to pollers.
+    LLBC_PacketPool::FlushReturns();
 
-    // Sleep FrameInterval - ElapsedTime milli-seconds, if need.
+    // Event-driven mode: wait events, otherwise sleep FrameInterval - ElapsedTime milli-seconds, if need.
     if (fullFrame)
     {
-        const sint64 elapsed = LLBC_GetMilliSeconds() - _begHeartbeatTime;
-        if (elapsed >= 0 && elapsed < _frameInterval)
-            LLBC_Sleep(static_cast<int>(_frameInterval - elapsed));
+        if (_eventDriven)
+        {
+            this->WaitEvents();
+        }
+        else
+        {
+            const sint64 elapsed = LLBC_GetMilliSeconds() - _begHeartbeatTime;
+            if (elapsed >= 0 && elapsed < _frameInterval)
+                LLBC_Sleep(static_cast<int>(_frameInterval - elapsed));
+        }
     }
 
     _sinkIntoLoop = false;
@@ -936,7 +1318,12 @@ LLBC_ProtocolStack *LLBC_Service::CreateRawStack(LLBC_ProtocolStack *stack)
     else
     {
         stack->AddProtocol(LLBC_IProtocol::Create<LLBC_PacketProtocol>(_filters[LLBC_ProtocolLayer::PackLayer]));
-        stack->AddProtocol(LLBC_IProtocol::Create<LLBC_CompressProtocol>(_filters[LLBC_ProtocolLayer::CompressLayer]));
+        LLBC_CompressProtocol *compressProto = static_cast<LLBC_CompressProtocol *>(
+            LLBC_IProtocol::Create<LLBC_CompressProtocol>(_filters[LLBC_ProtocolLayer::CompressLayer]));
+        if (_compressorFactory)
+            compressProto->SetCompressor(_compressorFactory->Create(), _compressThreshold);
+
+        stack->AddProtocol(compressProto);
     }
 
     return stack;
@@ -952,11 +1339,24 @@ LLBC_ProtocolStack *LLBC_Service::CreateCodecStack(LLBC_ProtocolStack *stack)
 
     if (_type != This::Raw)
     {
-        stack->AddProtocol(LLBC_IProtocol::Create<LLBC_CodecProtocol>(_filters[LLBC_ProtocolLayer::CodecLayer]));
-        for (_Coders::iterator it = _coders.begin();
-             it != _coders.end();
-             it++)
-            stack->AddCoder(it->first, it->second);
+        LLBC_CodecProtocol *codecProto = static_cast<LLBC_CodecProtocol *>(
+            LLBC_IProtocol::Create<LLBC_CodecProtocol>(_filters[LLBC_ProtocolLayer::CodecLayer]));
+        stack->AddProtocol(codecProto);
+
+#if !LLBC_CFG_COMM_USE_FULL_STACK
+        if (stack == &_stack)
+        {
+            for (_Coders::iterator it = _coders.begin();
+                 it != _coders.end();
+                 it++)
+                stack->AddCoder(it->first, it->second);
+        }
+        else
+#endif // !LLBC_CFG_COMM_USE_FULL_STACK
+        {
+            // Sessions' stacks created by pollers after service started, share the read-only coder table.
+            codecProto->SetCoderTable(&_coderTable);
+        }
     }
 
     return stack;
@@ -991,32 +1391,46 @@ void LLBC_Service::Svc()
 
 void LLBC_Service::Cleanup()
 {
+    // Wait all in-flight send calls finished, new send calls will failed after stopping flag set,
+    // the last finished send call will notify when stopping.
+    _sendingLock.Lock();
+    while (LLBC_AtomicGet(&_sendingCount) != 0)
+        _sendingCond.Wait(_sendingLock);
+    _sendingLock.Unlock();
+
+    this->CloseLocalChannels();
     _pollerMgr.Stop();
 
     LLBC_ServiceEvent *ev;
     LLBC_MessageBlock *block;
     while (this->TryPop(block) == LLBC_RTN_OK)
     {
-        // Skip event type.
-        block->ShiftReadPos(sizeof(int));
-        block->Read(&ev, sizeof(ev));
+        // Empty block is wakeup signal, not carry event.
+        if (block->GetReadableSize() != 0)
+        {
+            // Skip event type.
+            block->ShiftReadPos(sizeof(int));
+            block->Read(&ev, sizeof(ev));
+
+            LLBC_Delete(ev);
+        }
 
-        LLBC_Delete(ev);
         LLBC_Delete(block);
     }
 
-    _connectedSessionIdsLock.Lock();
-    _connectedSessionIds.clear();
-    _connectedSessionIdsLock.Unlock();
+    this->ClearConnectedSessionIds();
 
     this->DestroyFacades();
     this->DestroyAutoReleasePool();
     this->RemoveServiceFromTls();
 
+    // Timer scheduler belong to drive thread tls, self-drive thread will exit after stopped, refetch it when restart.
+    _timerScheduler = NULL;
+
     if (_driveMode == This::SelfDrive)
         _svcMgr.OnServiceStop(this);
 
-    _started = false;
+    LLBC_AtomicSet(&_started, 0);
 }
 
 void LLBC_Service::AddServiceToTls()
@@ -1030,6 +1444,8 @@ void LLBC_Service::AddServiceToTls()
             break;
 
     tls->commTls.services[idx] = this;
+
+    LLBC_PacketPool::Attach();
 }
 
 void LLBC_Service::RemoveServiceFromTls()
@@ -1045,6 +1461,8 @@ void LLBC_Service::RemoveServiceFromTls()
     LLBC_MemCpy(&tls->commTls.services[idx],
                 &tls->commTls.services[idx + 1],
                 sizeof(tls->commTls.services[0]) * (lmt + 1 - (idx + 1)));
+
+    LLBC_PacketPool::Detach();
 }
 
 bool LLBC_Service::IsCanContinueDriveService()
@@ -1060,6 +1478,19 @@ bool LLBC_Service::IsCanContinueDriveService()
     return checkIdx < lmt ? true : false;
 }
 
+bool LLBC_Service::IsInDriveThread() const
+{
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+    const int lmt = LLBC_CFG_COMM_PER_THREAD_DRIVE_MAX_SVC_COUNT;
+    for (int idx = 0; idx <= lmt && tls->commTls.services[idx]; idx++)
+    {
+        if (tls->commTls.services[idx] == this)
+            return true;
+    }
+
+    return false;
+}
+
 void LLBC_Service::HandleFrameTasks(LLBC_Service::_FrameTasks &tasks, bool &usingFlag)
 {
     usingFlag = true;
@@ -1079,19 +1510,69 @@ void LLBC_Service::DestroyFrameTasks(_FrameTasks &tasks, bool &usingFlag)
 
 void LLBC_Service::HandleQueuedEvents()
 {
-    int type;
-    LLBC_ServiceEvent *ev;
     LLBC_MessageBlock *block;
     while (this->TryPop(block) == LLBC_RTN_OK)
+        this->HandleEvent(block);
+}
+
+void LLBC_Service::HandleEvent(LLBC_MessageBlock *block)
+{
+    // Empty block is wakeup signal(see WakeupEvents()), not carry event.
+    if (UNLIKELY(block->GetReadableSize() == 0))
     {
-        block->Read(&type, sizeof(int));
-        block->Read(&ev, sizeof(LLBC_ServiceEvent *));
+        LLBC_Delete(block);
+        return;
+    }
+
+    int type;
+    LLBC_ServiceEvent *ev;
+    block->Read(&type, sizeof(int));
+    block->Read(&ev, sizeof(LLBC_ServiceEvent *));
 
-        (this->*_evHandlers[type])(*ev);
+    (this->*_evHandlers[type])(*ev);
 
-        LLBC_Delete(ev);
-        LLBC_Delete(block);
+    LLBC_Delete(ev);
+    LLBC_Delete(block);
+}
+
+void LLBC_Service::WaitEvents()
+{
+    // Has frame tasks need handle, don't wait.
+    {
+        LLBC_Guard guard(_lock);
+        if (!_beforeFrameTasks.empty() || !_afterFrameTasks.empty())
+            return;
     }
+
+    // Determine wait time: max wait time, next frame boundary(if facades need update), next timer timeout.
+    sint64 waitTime = LLBC_CFG_COMM_EVENT_DRIVEN_MAX_WAIT_TIME;
+    if (_facadesUpdate)
+        waitTime = MIN(waitTime, _nextFrameTime - LLBC_GetMilliSeconds());
+
+    const sint64 timerTimeout = _timerScheduler->GetNextTimeout();
+    if (timerTimeout >= 0)
+        waitTime = MIN(waitTime, timerTimeout);
+
+    if (waitTime <= 0)
+        return;
+
+    // Block on message queue, any event arrival will wakeup service immediately.
+    LLBC_MessageBlock *block;
+    if (this->TimedPop(block, static_cast<int>(waitTime)) == LLBC_RTN_OK)
+        this->HandleEvent(block);
+}
+
+void LLBC_Service::WakeupEvents()
+{
+    if (!_eventDriven || !_started)
+        return;
+
+    // In service thread, WaitEvents() will check frame tasks before wait, don't need wakeup.
+    if (this->IsInDriveThread())
+        return;
+
+    // Push empty block to wakeup the service thread blocking in WaitEvents().
+    this->Push(LLBC_New1(LLBC_MessageBlock, 0));
 }
 
 void LLBC_Service::HandleEv_SessionCreate(LLBC_ServiceEvent &_)
@@ -1099,11 +1580,7 @@ void LLBC_Service::HandleEv_SessionCreate(LLBC_ServiceEvent &_)
     typedef LLBC_SvcEv_SessionCreate _Ev;
     _Ev &ev = static_cast<_Ev &>(_);
 
-    {
-        _connectedSessionIdsLock.Lock();
-        _connectedSessionIds.insert(ev.sessionId);
-        _connectedSessionIdsLock.Unlock();
-    }
+    this->AddConnectedSessionId(ev.sessionId);
 
     LLBC_SessionInfo info;
     info.SetSessionId(ev.sessionId);
@@ -1123,9 +1600,7 @@ void LLBC_Service::HandleEv_SessionDestroy(LLBC_ServiceEvent &_)
     typedef LLBC_SvcEv_SessionDestroy _Ev;
     _Ev &ev = static_cast<_Ev &>(_);
 
-    _connectedSessionIdsLock.Lock();
-    _connectedSessionIds.erase(ev.sessionId);
-    _connectedSessionIdsLock.Unlock();
+    this->RemoveConnectedSessionId(ev.sessionId);
 
     for (_Facades::iterator it = _facades.begin();
          it != _facades.end();
@@ -1153,29 +1628,61 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
 {
     typedef LLBC_SvcEv_DataArrival _Ev;
     _Ev &ev = static_cast<_Ev &>(_);
-    LLBC_Packet *packet = ev.packet;
+    if (UNLIKELY(ev.packets.empty()))
+        return;
 
-    // Makesure session in connected sessionId set.
-    const int sessionId = packet->GetSessionId();
+    // Makesure session in connected sessionId set, all packets in one event come from the same session.
+    const int sessionId = ev.packets[0]->GetSessionId();
 
-    _connectedSessionIdsLock.Lock();
-    if (_connectedSessionIds.find(sessionId) == 
-        _connectedSessionIds.end())
-    {
-        _connectedSessionIdsLock.Unlock();
+    if (!this->IsSessionConnected(sessionId))
         return;
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    sint64 recvBytes = 0;
+    for (size_t i = 0; i < ev.packets.size(); i++)
+        recvBytes += ev.packets[i]->GetLength();
+
+    _svcSamplers[LLBC_SvcMetrics::RecvPackets]->Sampling(static_cast<sint64>(ev.packets.size()));
+    _svcSamplers[LLBC_SvcMetrics::RecvBytes]->Sampling(recvBytes);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    // Dispatch all packets, any handler may remove the session(or the session removed by other thread),
+    // so recheck session before dispatch each remain packet, the undispatched packets will deleted by event.
+    for (size_t i = 0; i < ev.packets.size(); i++)
+    {
+        if (i > 0 && !this->IsSessionConnected(sessionId))
+            break;
+
+        LLBC_Packet *packet = ev.packets[i];
+        ev.packets[i] = NULL;
+
+        if (!this->DispatchPacket(packet, ev.local))
+            break;
     }
-    _connectedSessionIdsLock.Unlock();
+}
 
-    ev.packet = NULL;
+bool LLBC_Service::DispatchPacket(LLBC_Packet *packet, bool local)
+{
+    const int sessionId = packet->GetSessionId();
 
+    // Local channel packet not pass protocol stack, only need codec.
+    int decodeRet = LLBC_RTN_OK;
+    if (local)
+        decodeRet = this->LocalRecvCodec(packet);
 #if !LLBC_CFG_COMM_USE_FULL_STACK
-    if (UNLIKELY(_stack.RecvCodec(packet, packet) != LLBC_RTN_OK))
+    // In poller decode mode, packet already decoded in poller thread.
+    else if (!_pollerDecode)
+        decodeRet = _stack.RecvCodec(packet, packet);
+#endif
+
+    // Decode failed, remove session, same as decode failed in poller thread.
+    if (UNLIKELY(decodeRet != LLBC_RTN_OK))
     {
+        LLBC_INL_NS __DeletePacket(packet);
         this->RemoveSession(sessionId);
-        return;
+
+        return false;
     }
-#endif
 
     // Create invoke-guard to delete packet.
     LLBC_InvokeGuard delPacketGuard(&LLBC_INL_NS __DeletePacket, packet);
@@ -1187,21 +1694,17 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
     if (status != 0)
     {
 # if LLBC_CFG_COMM_ENABLE_STATUS_DESC
-        _StatusDescs::const_iterator statusDescIt = _statusDescs.find(status);
-        if (statusDescIt != _statusDescs.end())
-            packet->SetStatusDesc(statusDescIt->second);
+        const LLBC_String *statusDesc = _statusDescTable.Find(status);
+        if (statusDesc)
+            packet->SetStatusDesc(*statusDesc);
 # endif // LLBC_CFG_COMM_ENABLE_STATUS_DESC
 # if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
-        _OpStatusHandlers::iterator stHandlersIt = _statusHandlers.find(opcode);
-        if (stHandlersIt != _statusHandlers.end())
+        LLBC_IDelegate1<LLBC_Packet &> *stHandler =
+            _statusHandlerTable.Find(LLBC_INL_NS __MakeStatusHandlerKey(opcode, status));
+        if (stHandler)
         {
-            _StatusHandlers &stHandlers = *stHandlersIt->second;
-            _StatusHandlers::iterator stHandlerIt = stHandlers.find(status);
-            if (stHandlerIt != stHandlers.end())
-            {
-                stHandlerIt->second->Invoke(*packet);
-                return;
-            }
+            stHandler->Invoke(*packet);
+            return true;
         }
 # endif // LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
     }
@@ -1211,13 +1714,13 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
     bool preHandled = false;
     if (_type != This::Raw)
     {
-        _PreHandlers::iterator preIt = _preHandlers.find(opcode);
-        if (preIt != _preHandlers.end())
+        LLBC_IDelegateEx<LLBC_Packet &> *preHandler = _preHandlerTable.Find(opcode);
+        if (preHandler)
         {
-            if (!preIt->second->Invoke(*packet))
+            if (!preHandler->Invoke(*packet))
             {
                 this->RemoveSession(sessionId);
-                return;
+                return false;
             }
 
             preHandled = true;
@@ -1230,15 +1733,25 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
         if (!_unifyPreHandler->Invoke(*packet))
         {
             this->RemoveSession(sessionId);
-            return;
+            return false;
         }
     }
 #endif // LLBC_CFG_COMM_ENABLE_UNIFY_PRESUBSCRIBE
 
-    _Handlers::iterator it = _handlers.find(opcode);
-    if (it != _handlers.end())
+    LLBC_IDelegate1<LLBC_Packet &> *handler = _handlerTable.Find(opcode);
+    if (handler)
     {
-        it->second->Invoke(*packet);
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        // Every subscribed opcode has its handler time sampler(created in Start()).
+        const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        handler->Invoke(*packet);
+
+        LLBC_ISampler *sampler = _handlerSamplerTable.Find(opcode);
+        if (LIKELY(sampler))
+            sampler->Sampling(LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+#else // !LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+        handler->Invoke(*packet);
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
     }
     else
     {
@@ -1247,6 +1760,8 @@ void LLBC_Service::HandleEv_DataArrival(LLBC_ServiceEvent &_)
              facadeIt++)
             (*facadeIt)->OnUnHandledPacket(packet->GetOpcode());
     }
+
+    return true;
 }
 
 void LLBC_Service::HandleEv_ProtoReport(LLBC_ServiceEvent &_)
@@ -1266,6 +1781,32 @@ void LLBC_Service::HandleEv_ProtoReport(LLBC_ServiceEvent &_)
         (*it)->OnProtoReport(report);
 }
 
+void LLBC_Service::HandleEv_PollerMetrics(LLBC_ServiceEvent &_)
+{
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    typedef LLBC_SvcEv_PollerMetrics _Ev;
+    _Ev &ev = static_cast<_Ev &>(_);
+
+    const size_t samplersBeg = static_cast<size_t>(ev.pollerId) * LLBC_SvcMetrics::End;
+    if (UNLIKELY(ev.pollerId < 0 || samplersBeg >= _pollerSamplers.size()))
+        return;
+
+    LLBC_ISampler **samplers = &_pollerSamplers[samplersBeg];
+    samplers[LLBC_SvcMetrics::RecvPackets]->Sampling(static_cast<sint64>(ev.recvPackets));
+    samplers[LLBC_SvcMetrics::RecvBytes]->Sampling(static_cast<sint64>(ev.recvBytes));
+    samplers[LLBC_SvcMetrics::SentPackets]->Sampling(static_cast<sint64>(ev.sentPackets));
+    samplers[LLBC_SvcMetrics::SentBytes]->Sampling(static_cast<sint64>(ev.sentBytes));
+    samplers[LLBC_SvcMetrics::QueueSize]->Sampling(static_cast<sint64>(ev.maxQueueSize));
+    samplers[LLBC_SvcMetrics::SendBacklog]->Sampling(static_cast<sint64>(ev.sendBacklog));
+    samplers[LLBC_SvcMetrics::MaxSessionSendBacklog]->Sampling(static_cast<sint64>(ev.maxSessionSendBacklog),
+        reinterpret_cast<void *>(static_cast<size_t>(ev.maxSendBacklogSessionId)));
+
+    // Service scope sent metrics are summary of all pollers.
+    _svcSamplers[LLBC_SvcMetrics::SentPackets]->Sampling(static_cast<sint64>(ev.sentPackets));
+    _svcSamplers[LLBC_SvcMetrics::SentBytes]->Sampling(static_cast<sint64>(ev.sentBytes));
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+}
+
 void LLBC_Service::HandleEv_SubscribeEv(LLBC_ServiceEvent &_)
 {
     typedef LLBC_SvcEv_SubscribeEv _Ev;
@@ -1374,62 +1915,186 @@ void LLBC_Service::ProcessIdle()
     }
 }
 
-int LLBC_Service::LockableSend(LLBC_Packet *packet,
-                               bool lock,
-                               bool validCheck)
+void LLBC_Service::BuildDispatchTables()
 {
-    if (lock)
-        _lock.Lock();
+    _coderTable.Build(_coders);
+    _handlerTable.Build(_handlers);
+    _preHandlerTable.Build(_preHandlers);
 
-    if (UNLIKELY(!_started))
+#if LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
+    // Flatten opcode->status->handler map to (opcode, status)->handler table.
+    std::map<sint64, LLBC_IDelegate1<LLBC_Packet &> *> stHandlers;
+    for (_OpStatusHandlers::iterator opIt = _statusHandlers.begin();
+         opIt != _statusHandlers.end();
+         opIt++)
+    {
+        for (_StatusHandlers::iterator it = opIt->second->begin();
+             it != opIt->second->end();
+             it++)
+            stHandlers.insert(std::make_pair(LLBC_INL_NS __MakeStatusHandlerKey(opIt->first, it->first), it->second));
+    }
+
+    _statusHandlerTable.Build(stHandlers);
+#endif // LLBC_CFG_COMM_ENABLE_STATUS_HANDLER
+
+#if LLBC_CFG_COMM_ENABLE_STATUS_DESC
+    std::map<int, LLBC_String *> stDescs;
+    for (_StatusDescs::iterator it = _statusDescs.begin();
+         it != _statusDescs.end();
+         it++)
+        stDescs.insert(std::make_pair(it->first, &it->second));
+
+    _statusDescTable.Build(stDescs);
+#endif // LLBC_CFG_COMM_ENABLE_STATUS_DESC
+}
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+int LLBC_Service::InitMetrics(int pollerCount)
+{
+    // Service scope metrics samplers.
+    LLBC_MemSet(_svcSamplers, 0, sizeof(_svcSamplers));
+    for (int metric = LLBC_SvcMetrics::RecvPackets; metric <= LLBC_SvcMetrics::SentBytes; metric++)
+    {
+        if (!(_svcSamplers[metric] = this->AddMetricsSampler(
+                LLBC_SamplerType::IntervalSampler, LLBC_SvcMetrics::GetSamplerName(metric))))
+            return LLBC_RTN_FAILED;
+    }
+
+    if (!(_svcSamplers[LLBC_SvcMetrics::QueueSize] = this->AddMetricsSampler(
+            LLBC_SamplerType::LimitSampler, LLBC_SvcMetrics::GetSamplerName(LLBC_SvcMetrics::QueueSize))) ||
+        !(_svcSamplers[LLBC_SvcMetrics::FrameTime] = this->AddMetricsSampler(
+            LLBC_SamplerType::LimitSampler, LLBC_SvcMetrics::GetSamplerName(LLBC_SvcMetrics::FrameTime))))
+        return LLBC_RTN_FAILED;
+
+    // Poller scope metrics samplers, layout: [pollerId * LLBC_SvcMetrics::End + metric].
+    _pollerSamplers.assign(static_cast<size_t>(pollerCount) * LLBC_SvcMetrics::End, NULL);
+    for (int pollerId = 0; pollerId < pollerCount; pollerId++)
+    {
+        LLBC_ISampler **samplers = &_pollerSamplers[static_cast<size_t>(pollerId) * LLBC_SvcMetrics::End];
+        for (int metric = LLBC_SvcMetrics::Begin; metric != LLBC_SvcMetrics::End; metric++)
+        {
+            if (metric == LLBC_SvcMetrics::FrameTime || metric == LLBC_SvcMetrics::HandlerTime)
+                continue;
+
+            if (!(samplers[metric] = this->AddMetricsSampler(
+                    metric <= LLBC_SvcMetrics::SentBytes ?
+                        LLBC_SamplerType::IntervalSampler : LLBC_SamplerType::LimitSampler,
+                    LLBC_SvcMetrics::GetSamplerName(metric, pollerId))))
+                return LLBC_RTN_FAILED;
+        }
+    }
+
+    // Handler scope metrics samplers, one sampler per subscribed opcode.
+    std::map<int, LLBC_ISampler *> handlerSamplers;
+    for (_Handlers::iterator it = _handlers.begin();
+         it != _handlers.end();
+         it++)
     {
-        if (lock)
-            _lock.Unlock();
+        LLBC_ISampler *sampler = this->AddMetricsSampler(
+            LLBC_SamplerType::LimitSampler, LLBC_SvcMetrics::GetHandlerSamplerName(it->first));
+        if (!sampler)
+            return LLBC_RTN_FAILED;
+
+        handlerSamplers.insert(std::make_pair(it->first, sampler));
+    }
+
+    _handlerSamplerTable.Build(handlerSamplers);
 
-        LLBC_Delete(packet);
+    // Restart service, clear last running metrics.
+    _metrics.Reset();
+    _metricsUpdateTime = 0;
+
+    return LLBC_RTN_OK;
+}
+
+LLBC_ISampler *LLBC_Service::AddMetricsSampler(int type, const LLBC_String &name)
+{
+    // If service restarted, sampler already exist, reuse it.
+    if (_metrics.AddSampler(type, name) != LLBC_RTN_OK &&
+        LLBC_GetLastError() != LLBC_ERROR_EXIST)
+        return NULL;
+
+    return _metrics.GetSampler(name);
+}
+
+void LLBC_Service::UpdateMetrics(sint64 frameBegTime)
+{
+    _svcSamplers[LLBC_SvcMetrics::FrameTime]->Sampling(
+        LLBC_CPUTime::Current().ToMicroSeconds() - frameBegTime);
+    _svcSamplers[LLBC_SvcMetrics::QueueSize]->Sampling(
+        static_cast<sint64>(this->GetMsgQueueSize()));
+
+    // Interval samplers need update per second.
+    const time_t now = static_cast<time_t>(_begHeartbeatTime / 1000);
+    if (now != _metricsUpdateTime)
+    {
+        _metrics.Update(now);
+        _metricsUpdateTime = now;
+    }
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+int LLBC_Service::LockableSend(LLBC_Packet *packet,
+                               bool validCheck)
+{
+    // Mark sending, Cleanup() will wait all in-flight send calls finished before stop pollers.
+    LLBC_AtomicFetchAndAdd(&_sendingCount, 1);
+    if (UNLIKELY(!_started || _stopping))
+    {
+        this->FinishSending();
+        LLBC_PacketPool::Release(packet);
 
         LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
         return LLBC_RTN_FAILED;
     }
 
-    const int sessionId = packet->GetSessionId();
-    if (validCheck)
+    if (validCheck && !this->IsSessionConnected(packet->GetSessionId()))
     {
-        LLBC_Guard connSIdsGuard(_connectedSessionIdsLock);
-        if (_connectedSessionIds.find(sessionId) == _connectedSessionIds.end())
-        {
-            if (lock)
-                _lock.Unlock();
+        this->FinishSending();
+        LLBC_PacketPool::Release(packet);
 
-            LLBC_Delete(packet);
+        LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+        return LLBC_RTN_FAILED;
+    }
 
-            LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
-            return LLBC_RTN_FAILED;
-        }
+    // Local channel session, hand over packet to peer service directly.
+    int ret;
+    if (LLBC_AtomicGet(&_localChannelCount) > 0 &&
+        this->LocalSend(packet, ret))
+    {
+        this->FinishSending();
+        return ret;
     }
 
 #if !LLBC_CFG_COMM_USE_FULL_STACK
+    // Encode in caller thread(Codec-Layer filter also called in it), codec stack only call packet encoder,
+    // not hold any state.
     LLBC_Packet *encoded;
     if (_stack.SendCodec(packet, encoded) != LLBC_RTN_OK)
     {
-        if (lock)
-            _lock.Unlock();
-
+        this->FinishSending();
         return LLBC_RTN_FAILED;
     }
 
-    const int ret = _pollerMgr.Send(encoded);
-    if (lock)
-        _lock.Unlock();
-
-    return ret;
+    // Direct push to session's poller queue.
+    ret = _pollerMgr.Send(encoded);
 #else
-    const int ret = _pollerMgr.Send(packet);
-    if (lock)
-        _lock.Unlock();
+    ret = _pollerMgr.Send(packet);
+#endif
+
+    this->FinishSending();
 
     return ret;
-#endif
+}
+
+void LLBC_Service::FinishSending()
+{
+    // The last in-flight send call finished while stopping, wakeup Cleanup().
+    if (LLBC_AtomicFetchAndSub(&_sendingCount, 1) == 1 && _stopping)
+    {
+        LLBC_Guard guard(_sendingLock);
+        _sendingCond.Broadcast();
+    }
 }
 
 int LLBC_Service::LockableSend(int svcId,
@@ -1439,10 +2104,9 @@ int LLBC_Service::LockableSend(int svcId,
                                size_t len,
                                int status,
                                const LLBC_PacketHeaderParts *parts,
-                               bool lock,
                                bool validCheck)
 {
-    LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+    LLBC_Packet *packet = LLBC_PacketPool::Acquire();
     packet->SetHeader(svcId, sessionId, opcode, status);
     if (parts && _type != This::Raw)
         parts->SetToPacket(*packet);
@@ -1450,11 +2114,208 @@ int LLBC_Service::LockableSend(int svcId,
     int ret = packet->Write(bytes, len);
     if (UNLIKELY(ret != LLBC_RTN_OK))
     {
-        LLBC_Delete(packet);
+        LLBC_PacketPool::Release(packet);
         return ret;
     }
 
-    return this->LockableSend(packet, lock, validCheck);
+    return this->LockableSend(packet, validCheck);
+}
+
+int LLBC_Service::LockableSend(int svcId,
+                               int sessionId,
+                               int opcode,
+                               LLBC_MessageBlock *payload,
+                               int status,
+                               const LLBC_PacketHeaderParts *parts,
+                               bool validCheck)
+{
+    LLBC_Packet *packet = LLBC_PacketPool::Acquire();
+    packet->SetHeader(svcId, sessionId, opcode, status);
+    if (parts && _type != This::Raw)
+        parts->SetToPacket(*packet);
+
+    if (payload)
+        packet->SetSharedPayload(payload);
+
+    return this->LockableSend(packet, validCheck);
+}
+
+void LLBC_Service::AddConnectedSessionId(int sessionId)
+{
+    _ConnectedSessionIds &shard = _connectedSessionIds[
+        static_cast<uint32>(sessionId) % LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS];
+
+    LLBC_Guard guard(shard.lock);
+    shard.sessionIds.insert(sessionId);
+}
+
+bool LLBC_Service::RemoveConnectedSessionId(int sessionId)
+{
+    _ConnectedSessionIds &shard = _connectedSessionIds[
+        static_cast<uint32>(sessionId) % LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS];
+
+    LLBC_Guard guard(shard.lock);
+    return shard.sessionIds.erase(sessionId) != 0;
+}
+
+bool LLBC_Service::IsSessionConnected(int sessionId)
+{
+    _ConnectedSessionIds &shard = _connectedSessionIds[
+        static_cast<uint32>(sessionId) % LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS];
+
+    LLBC_Guard guard(shard.lock);
+    return shard.sessionIds.find(sessionId) != shard.sessionIds.end();
+}
+
+void LLBC_Service::GetConnectedSessionIds(LLBC_SessionIdList &sessionIds)
+{
+    for (int i = 0; i < LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS; i++)
+    {
+        _ConnectedSessionIds &shard = _connectedSessionIds[i];
+
+        LLBC_Guard guard(shard.lock);
+        sessionIds.insert(sessionIds.end(), shard.sessionIds.begin(), shard.sessionIds.end());
+    }
+}
+
+void LLBC_Service::ClearConnectedSessionIds()
+{
+    for (int i = 0; i < LLBC_CFG_COMM_CONNECTED_SESSION_ID_SHARDS; i++)
+    {
+        _ConnectedSessionIds &shard = _connectedSessionIds[i];
+
+        LLBC_Guard guard(shard.lock);
+        shard.sessionIds.clear();
+    }
+}
+
+bool LLBC_Service::LocalSend(LLBC_Packet *packet, int &ret)
+{
+    _localChannelsLock.Lock();
+    _LocalChannels::iterator it = _localChannels.find(packet->GetSessionId());
+    if (it == _localChannels.end())
+    {
+        _localChannelsLock.Unlock();
+        return false;
+    }
+
+    // Hold peer's delivering count, peer service will wait it before cleanup message queue.
+    LLBC_Service *peer = it->second.peer;
+    packet->SetSessionId(it->second.peerSessionId);
+    LLBC_AtomicFetchAndAdd(&peer->_localDeliveringCount, 1);
+    _localChannelsLock.Unlock();
+
+    // Encoder can only hand over to peer as decoder when both services registered same coder factory class,
+    // otherwise encode it here, peer handler's coder cast will be undefined behavior.
+    if (packet->GetEncoder())
+    {
+        const int opcode = packet->GetOpcode();
+        const LLBC_ICoderFactory *factory = _type != This::Raw ? _coderTable.Find(opcode) : NULL;
+        const LLBC_ICoderFactory *peerFactory = peer->_type != This::Raw ? peer->_coderTable.Find(opcode) : NULL;
+        if (!factory || !peerFactory || typeid(*factory) != typeid(*peerFactory))
+            packet->Encode();
+    }
+
+    packet->PrepareLocalDeliver();
+    ret = peer->Push(LLBC_SvcEvUtil::BuildLocalDataArrivalEv(packet));
+
+    LLBC_AtomicFetchAndSub(&peer->_localDeliveringCount, 1);
+
+    return true;
+}
+
+int LLBC_Service::LocalRecvCodec(LLBC_Packet *packet)
+{
+    LLBC_ICoderFactory *factory = NULL;
+    if (_type != This::Raw)
+        factory = _coderTable.Find(packet->GetOpcode());
+
+    // Sender's encoder already hold the data(sender checked coder factory class same as this service's),
+    // use it as decoder, otherwise encode it and refill length part, handler read packet payload.
+    if (packet->GetEncoder())
+    {
+        if (factory)
+        {
+            packet->HandOverEncoder();
+        }
+        else
+        {
+            packet->Encode();
+            packet->UpdateLengthPart();
+        }
+    }
+    else if (factory)
+    {
+        LLBC_ICoder *coder = factory->Create();
+        if (!coder->TryDecode(*packet))
+        {
+            LLBC_Delete(coder);
+
+            LLBC_SetLastError(LLBC_ERROR_FORMAT);
+            return LLBC_RTN_FAILED;
+        }
+
+        packet->SetDecoder(coder);
+    }
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_Service::RemoveLocalChannel(int sessionId)
+{
+    LLBC_Guard guard(_localChannelsLock);
+    _LocalChannels::iterator it = _localChannels.find(sessionId);
+    if (it == _localChannels.end())
+        return false;
+
+    LLBC_Service *peer = it->second.peer;
+    const int peerSessionId = it->second.peerSessionId;
+
+    _localChannels.erase(it);
+    LLBC_AtomicFetchAndSub(&_localChannelCount, 1);
+
+    peer->_localChannels.erase(peerSessionId);
+    LLBC_AtomicFetchAndSub(&peer->_localChannelCount, 1);
+
+    this->RemoveConnectedSessionId(sessionId);
+    this->Push(LLBC_SvcEvUtil::BuildSessionDestroyEv(sessionId));
+
+    peer->RemoveConnectedSessionId(peerSessionId);
+    peer->Push(LLBC_SvcEvUtil::BuildSessionDestroyEv(peerSessionId));
+
+    return true;
+}
+
+void LLBC_Service::CloseLocalChannels()
+{
+    _localChannelsLock.Lock();
+
+    // Swap out first, self connected channel's peer is self.
+    _LocalChannels channels;
+    channels.swap(_localChannels);
+    LLBC_AtomicSet(&_localChannelCount, 0);
+
+    for (_LocalChannels::iterator it = channels.begin();
+         it != channels.end();
+         it++)
+    {
+        LLBC_Service *peer = it->second.peer;
+        const int peerSessionId = it->second.peerSessionId;
+        if (peer == this)
+            continue;
+
+        peer->_localChannels.erase(peerSessionId);
+        LLBC_AtomicFetchAndSub(&peer->_localChannelCount, 1);
+
+        peer->RemoveConnectedSessionId(peerSessionId);
+        peer->Push(LLBC_SvcEvUtil::BuildSessionDestroyEv(peerSessionId));
+    }
+
+    _localChannelsLock.Unlock();
+
+    // Wait all in-flight local deliveries finished, after that, no one will push event to this service.
+    while (LLBC_AtomicGet(&_localDeliveringCount) != 0)
+        LLBC_ThreadManager::Sleep(0);
 }
 
 template <typename SessionIds>
@@ -1466,7 +2327,6 @@ int LLBC_Service::MulticastSendCoder(int svcId,
                                      const LLBC_PacketHeaderParts *parts,
                                      bool validCheck)
 {
-    LLBC_Guard guard(_lock);
     if (UNLIKELY(!_started))
     {
         if (LIKELY(coder))
@@ -1486,7 +2346,7 @@ int LLBC_Service::MulticastSendCoder(int svcId,
 
     typename SessionIds::const_iterator sessionIt = sessionIds.begin();
 
-    LLBC_Packet *firstPacket = LLBC_New(LLBC_Packet);
+    LLBC_Packet *firstPacket = LLBC_PacketPool::Acquire();
     firstPacket->SetHeader(svcId, *sessionIt++, opcode, status);
     if (parts && _type != This::Raw)
         parts->SetToPacket(*firstPacket);
@@ -1504,64 +2364,38 @@ int LLBC_Service::MulticastSendCoder(int svcId,
 
     typename SessionIds::size_type sessionCnt = sessionIds.size();
     if (sessionCnt == 1)
-        return this->LockableSend(firstPacket, false, validCheck);
+        return this->LockableSend(firstPacket, validCheck);
 
-    LLBC_Packet **otherPackets =
-        LLBC_Calloc(LLBC_Packet *, (sizeof(LLBC_Packet *) * (sessionCnt - 1)));
+    // Encode once, all other sessions' packets share one payload copy(zero copy per session).
+    LLBC_MessageBlock *payload = NULL;
     if (LIKELY(hasCoder))
-    {
-        const void *payload = firstPacket->GetPayload();
-        const size_t payloadLen = firstPacket->GetPayloadLength();
-
-        if (validCheck)
-            _connectedSessionIdsLock.Lock();
-
-        for (register typename SessionIds::size_type i = 1;
-             i < sessionCnt;
-             i++)
-        {
-            const int sessionId = *sessionIt++;
-            if (validCheck &&
-                _connectedSessionIds.find(sessionId) == _connectedSessionIds.end())
-                    continue;
-
-            LLBC_Packet *otherPacket = LLBC_New(LLBC_Packet);
-            otherPacket->SetHeader(svcId, sessionId, opcode, status);
-            otherPacket->Write(payload, payloadLen);
+        payload = LLBC_INL_NS __CreateSharedPayload(firstPacket->GetPayload(), firstPacket->GetPayloadLength());
 
-            otherPackets[i - 1] = otherPacket;
-        }
+    LLBC_Packet **otherPackets =
+        LLBC_Calloc(LLBC_Packet *, (sizeof(LLBC_Packet *) * (sessionCnt - 1)));
 
-        if (validCheck)
-            _connectedSessionIdsLock.Unlock();
-    }
-    else
+    for (register typename SessionIds::size_type i = 1;
+         i < sessionCnt;
+         i++)
     {
-        if (validCheck)
-            _connectedSessionIdsLock.Lock();
-
-        for (register typename SessionIds::size_type i = 1;
-             i < sessionCnt;
-             i++)
-        {
-            const int sessionId = *sessionIt++;
-            if (validCheck &&
-                _connectedSessionIds.find(sessionId) == _connectedSessionIds.end())
-                continue;
-
-            LLBC_Packet *otherPacket = LLBC_New(LLBC_Packet);
-            otherPacket->SetHeader(svcId, sessionId, opcode, status);
-            if (parts && _type != This::Raw)
-                parts->SetToPacket(*otherPacket);
+        const int sessionId = *sessionIt++;
+        if (validCheck && !this->IsSessionConnected(sessionId))
+            continue;
 
-            otherPackets[i - 1] = otherPacket;
-        }
+        LLBC_Packet *otherPacket = LLBC_PacketPool::Acquire();
+        otherPacket->SetHeader(svcId, sessionId, opcode, status);
+        if (parts && _type != This::Raw)
+            parts->SetToPacket(*otherPacket);
+        if (payload)
+            otherPacket->SetSharedPayload(payload);
 
-        if (validCheck)
-            _connectedSessionIdsLock.Unlock();
+        otherPackets[i - 1] = otherPacket;
     }
 
-    this->LockableSend(firstPacket, false, validCheck); // Use pass "validCheck" argument to call LockableSend().
+    // All packets hold payload reference, release the creator reference.
+    LLBC_XDelete(payload);
+
+    this->LockableSend(firstPacket, validCheck); // Use pass "validCheck" argument to call LockableSend().
 
     const size_t otherPacketCnt = sessionCnt - 1;
     for (register size_t i = 0; i < otherPacketCnt; i++)
@@ -1570,7 +2404,7 @@ int LLBC_Service::MulticastSendCoder(int svcId,
         if (!otherPacket)
             continue;
 
-        this->LockableSend(otherPacket, false, false); // Don't need vaildate check.
+        this->LockableSend(otherPacket, false); // Don't need vaildate check.
     }
 
     LLBC_Free(otherPackets);
@@ -72,13 +72,15 @@ LLBC_SvcEv_AsyncConn::~LLBC_SvcEv_AsyncConn()
 
 LLBC_SvcEv_DataArrival::LLBC_SvcEv_DataArrival()
 : Base(_EvType::DataArrival)
-, packet(NULL)
+, packets()
+, local(false)
 {
 }
 
 LLBC_SvcEv_DataArrival::~LLBC_SvcEv_DataArrival()
 {
-    LLBC_XDelete(packet);
+    for (size_t i = 0; i < packets.size(); i++)
+        LLBC_PacketPool::Release(packets[i]);
 }
 
 LLBC_SvcEv_ProtoReport::LLBC_SvcEv_ProtoReport()
@@ -95,6 +97,26 @@ LLBC_SvcEv_ProtoReport::~LLBC_SvcEv_ProtoReport()
 {
 }
 
+LLBC_SvcEv_PollerMetrics::LLBC_SvcEv_PollerMetrics()
+: Base(_EvType::PollerMetrics)
+, pollerId(-1)
+
+, recvPackets(0)
+, recvBytes(0)
+, sentPackets(0)
+, sentBytes(0)
+
+, maxQueueSize(0)
+, sendBacklog(0)
+, maxSessionSendBacklog(0)
+, maxSendBacklogSessionId(0)
+{
+}
+
+LLBC_SvcEv_PollerMetrics::~LLBC_SvcEv_PollerMetrics()
+{
+}
+
 LLBC_SvcEv_SubscribeEv::LLBC_SvcEv_SubscribeEv()
 : Base(_EvType::SubscribeEv)
 , id(0)
@@ -177,7 +199,28 @@ LLBC_MessageBlock *LLBC_SvcEvUtil::BuildDataArrivalEv(LLBC_Packet *packet)
     typedef LLBC_SvcEv_DataArrival _Ev;
 
     _Ev *ev = LLBC_New(_Ev);
-    ev->packet = packet;
+    ev->packets.push_back(packet);
+
+    return __CreateEvBlock(ev);
+}
+
+LLBC_MessageBlock *LLBC_SvcEvUtil::BuildDataArrivalEv(std::vector<LLBC_Packet *> &packets)
+{
+    typedef LLBC_SvcEv_DataArrival _Ev;
+
+    _Ev *ev = LLBC_New(_Ev);
+    ev->packets.swap(packets);
+
+    return __CreateEvBlock(ev);
+}
+
+LLBC_MessageBlock *LLBC_SvcEvUtil::BuildLocalDataArrivalEv(LLBC_Packet *packet)
+{
+    typedef LLBC_SvcEv_DataArrival _Ev;
+
+    _Ev *ev = LLBC_New(_Ev);
+    ev->packets.push_back(packet);
+    ev->local = true;
 
     return __CreateEvBlock(ev);
 }
@@ -212,6 +255,34 @@ LLBC_MessageBlock *LLBC_SvcEvUtil::BuildSubscribeEvEv(int id,
     return __CreateEvBlock(ev);
 }
 
+LLBC_MessageBlock *LLBC_SvcEvUtil::BuildPollerMetricsEv(int pollerId,
+                                                        uint64 recvPackets,
+                                                        uint64 recvBytes,
+                                                        uint64 sentPackets,
+                                                        uint64 sentBytes,
+                                                        size_t maxQueueSize,
+                                                        size_t sendBacklog,
+                                                        size_t maxSessionSendBacklog,
+                                                        int maxSendBacklogSessionId)
+{
+    typedef LLBC_SvcEv_PollerMetrics _Ev;
+
+    _Ev *ev = LLBC_New(_Ev);
+    ev->pollerId = pollerId;
+
+    ev->recvPackets = recvPackets;
+    ev->recvBytes = recvBytes;
+    ev->sentPackets = sentPackets;
+    ev->sentBytes = sentBytes;
+
+    ev->maxQueueSize = maxQueueSize;
+    ev->sendBacklog = sendBacklog;
+    ev->maxSessionSendBacklog = maxSessionSendBacklog;
+    ev->maxSendBacklogSessionId = maxSendBacklogSessionId;
+
+    return __CreateEvBlock(ev);
+}
+
 LLBC_MessageBlock *LLBC_SvcEvUtil::BuildUnsubscribeEvEv(int id, const LLBC_String &stub)
 {
     typedef LLBC_SvcEv_UnsubscribeEv _Ev;
@@ -0,0 +1,68 @@
+/**
+ * @file    ServiceMetrics.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/ServiceMetrics.h"
+
+namespace
+{
+    typedef LLBC_NS LLBC_SvcMetrics This;
+}
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static const LLBC_NS LLBC_String __g_descs[] =
+{
+    "RecvPackets",
+    "RecvBytes",
+    "SentPackets",
+    "SentBytes",
+    "QueueSize",
+    "FrameTime",
+    "SendBacklog",
+    "MaxSessionSendBacklog",
+    "HandlerTime",
+
+    "Invalid"
+};
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+bool LLBC_SvcMetrics::IsValid(int metric)
+{
+    return (This::Begin <= metric && metric < This::End);
+}
+
+const LLBC_String &LLBC_SvcMetrics::Type2Str(int metric)
+{
+    return LLBC_INL_NS __g_descs[This::IsValid(metric) ? metric : This::End];
+}
+
+LLBC_String LLBC_SvcMetrics::GetSamplerName(int metric, int pollerId)
+{
+    if (pollerId < 0)
+        return This::Type2Str(metric);
+
+    LLBC_String name;
+    return name.format("Poller%d.%s", pollerId, This::Type2Str(metric).c_str());
+}
+
+LLBC_String LLBC_SvcMetrics::GetHandlerSamplerName(int opcode)
+{
+    LLBC_String name;
+    return name.format("%s.%d", This::Type2Str(This::HandlerTime).c_str(), opcode);
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
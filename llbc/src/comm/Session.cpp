@@ -20,6 +20,21 @@
 #include "llbc/comm/ServiceEvent.h"
 #include "llbc/comm/IService.h"
 
+__LLBC_INTERNAL_NS_BEGIN
+
+static void __DelBlockChain(LLBC_NS LLBC_MessageBlock *block)
+{
+    while (block)
+    {
+        LLBC_NS LLBC_MessageBlock *next = block->GetNext();
+        LLBC_Delete(block);
+
+        block = next;
+    }
+}
+
+__LLBC_INTERNAL_NS_END
+
 
 __LLBC_NS_BEGIN
 
@@ -32,6 +47,14 @@ LLBC_Session::LLBC_Session()
 , _poller(NULL)
 
 , _protoStack(NULL)
+
+, _pollerType(LLBC_PollerType::End)
+, _pollerDecode(false)
+, _sendDirty(false)
+
+, _sendQueuedBytes(0)
+, _sendSentBytes(0)
+, _sendPacketEnds()
 {
 }
 
@@ -89,7 +112,8 @@ void LLBC_Session::SetService(LLBC_IService *svc)
 #if LLBC_CFG_COMM_USE_FULL_STACK
     _protoStack = _svc->CreateFullStack();
 #else
-    _protoStack = _svc->CreateRawStack();
+    _pollerDecode = _svc->IsPollerDecode();
+    _protoStack = _pollerDecode ? _svc->CreateFullStack() : _svc->CreateRawStack();
 #endif
     _protoStack->SetSession(this);
 }
@@ -116,7 +140,7 @@ int LLBC_Session::Send(LLBC_Packet *packet)
 
     if (this->Send(block) != LLBC_RTN_OK)
     {
-        LLBC_Delete(block);
+        LLBC_INL_NS __DelBlockChain(block);
         return LLBC_RTN_FAILED;
     }
 
@@ -125,13 +149,48 @@ int LLBC_Session::Send(LLBC_Packet *packet)
 
 int LLBC_Session::Send(LLBC_MessageBlock *block)
 {
+    size_t blockSize = 0;
+    for (LLBC_MessageBlock *curBlock = block; curBlock; curBlock = curBlock->GetNext())
+        blockSize += curBlock->GetReadableSize();
+
+    // If reach the send buffer high water mark, discard the block and report error, 
+    // the caller will close this session.
+    const size_t highWaterMark = _poller->GetSendBufHighWaterMark();
+    if (highWaterMark > 0 && _socket->GetNoSendDataSize() + blockSize > highWaterMark)
+    {
+        trace("LLBC_Session::Send() session[%d] reach send buffer high water mark: %lu, discard block\n",
+              _id, static_cast<ulong>(highWaterMark));
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_RTN_FAILED;
+    }
+
     if (_socket->AsyncSend(block) != LLBC_RTN_OK)
         return LLBC_RTN_FAILED;
 
+    // Block chain is one packet, record packet end position, packet counted as sent after all bytes sent.
+    _sendQueuedBytes += blockSize;
+    _sendPacketEnds.push_back(_sendQueuedBytes);
+
     // In LINUX or ANDROID platform, if use EPOLL ET mode, we must force call OnSend() one time.
+    // If poller use send coalescing, only mark session dirty, poller will flush it once at the
+    // end of current queued events batch, unless not send data reach the coalescing max bytes.
 #if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
     if (_pollerType == LLBC_PollerType::EpollPoller)
-        this->OnSend();
+    {
+        if (_poller->IsSendCoalescing() &&
+            _socket->GetNoSendDataSize() < _poller->GetSendCoalesceMaxBytes())
+        {
+            if (!_sendDirty)
+            {
+                _sendDirty = true;
+                _poller->MarkSendDirty(_id);
+            }
+        }
+        else
+        {
+            this->OnSend();
+        }
+    }
 #endif
 
     return LLBC_RTN_OK;
@@ -161,6 +220,12 @@ void LLBC_Session::OnRecv()
 }
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+void LLBC_Session::FlushSend()
+{
+    _sendDirty = false;
+    this->OnSend();
+}
+
 #if LLBC_TARGET_PLATFORM_WIN32
 void LLBC_Session::OnClose(LLBC_POverlapped ol)
 #else
@@ -181,25 +246,43 @@ void LLBC_Session::OnClose()
     _poller->RemoveSession(this);
 }
 
-void LLBC_Session::OnSent(size_t len)
+void LLBC_Session::OnSent(size_t len, int sendCalls)
 {
-    // TODO: For support sampler, do stuff here.
-    // ... ...
+    _sendSentBytes += len;
+    while (!_sendPacketEnds.empty() && _sendPacketEnds.front() <= _sendSentBytes)
+    {
+        _sendPacketEnds.pop_front();
+        _poller->_sentPacketCount += 1;
+    }
+
+    _poller->_sendSyscallCount += sendCalls;
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    _poller->_sentBytes += len;
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
 }
 
 bool LLBC_Session::OnRecved(LLBC_MessageBlock *block)
 {
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    for (LLBC_MessageBlock *curBlock = block; curBlock; curBlock = curBlock->GetNext())
+        _poller->_recvBytes += curBlock->GetReadableSize();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
     std::vector<LLBC_Packet *> packets;
 #if LLBC_CFG_COMM_USE_FULL_STACK
     if (_protoStack->Recv(block, packets) != LLBC_RTN_OK)
 #else
-    if (_protoStack->RecvRaw(block, packets) != LLBC_RTN_OK)
+    if ((_pollerDecode ?
+            _protoStack->Recv(block, packets) : _protoStack->RecvRaw(block, packets)) != LLBC_RTN_OK)
 #endif
     {
         this->OnClose();
         return false;
     }
 
+    if (packets.empty())
+        return true;
+
     LLBC_Packet *packet;
     for (size_t i = 0; i < packets.size(); i++)
     {
@@ -207,10 +290,15 @@ bool LLBC_Session::OnRecved(LLBC_MessageBlock *block)
         packet->SetSessionId(_id);
         packet->SetLocalAddr(_socket->GetLocalAddress());
         packet->SetPeerAddr(_socket->GetPeerAddress());
-
-        _svc->Push(LLBC_SvcEvUtil::BuildDataArrivalEv(packet));
     }
 
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    _poller->_recvPacketCount += packets.size();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    // Push all packets to service in one event.
+    _svc->Push(LLBC_SvcEvUtil::BuildDataArrivalEv(packets));
+
     return true;
 }
 
@@ -0,0 +1,498 @@
+/**
+ * @file    ShmChannel.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/comm/ShmChannel.h"
+
+#if LLBC_TARGET_PLATFORM_LINUX
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static const LLBC_NS uint32 __shmMagic = 0x4d534c4c; // "LLSM"
+static const LLBC_NS uint32 __shmVersion = 1;
+
+static const size_t __shmCacheLineSize = 64;
+static const size_t __shmMinRingSize = 4096;
+static const size_t __shmMaxRingSize = 1024 * 1024 * 1024;
+
+/**
+ * \brief The shared-memory segment head.
+ */
+struct __ShmSegHead
+{
+    LLBC_NS uint32 magic;
+    LLBC_NS uint32 ringSize;
+
+    char pad[__shmCacheLineSize - sizeof(LLBC_NS uint32) * 2];
+};
+
+/**
+ * \brief The control socket handshake message.
+ */
+struct __ShmHandshake
+{
+    LLBC_NS uint32 magic;
+    LLBC_NS uint32 version;
+    LLBC_NS uint32 ringSize;
+    LLBC_NS uint32 reserved;
+};
+
+static size_t __RoundUpRingSize(size_t ringSize)
+{
+    size_t roundedSize = __shmMinRingSize;
+    while (roundedSize < ringSize && roundedSize < __shmMaxRingSize)
+        roundedSize <<= 1;
+
+    return roundedSize;
+}
+
+static bool __IsValidRingSize(size_t ringSize)
+{
+    return ringSize >= __shmMinRingSize &&
+        ringSize <= __shmMaxRingSize &&
+        (ringSize & (ringSize - 1)) == 0;
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+/**
+ * \brief The shared-memory ring head, reader and writer positions in different cache lines.
+ *        The positions never wrap, ring offset is position & (ringSize - 1).
+ */
+struct LLBC_ShmChannel::_Ring
+{
+    volatile sint64 writePos;
+    volatile sint32 readerWaiting;
+    char pad0[LLBC_INL_NS __shmCacheLineSize - sizeof(sint64) - sizeof(sint32)];
+
+    volatile sint64 readPos;
+    volatile sint32 writerWaiting;
+    char pad1[LLBC_INL_NS __shmCacheLineSize - sizeof(sint64) - sizeof(sint32)];
+};
+
+LLBC_ShmChannel::LLBC_ShmChannel()
+: _doorbell(LLBC_INVALID_HANDLE)
+, _peerDoorbell(LLBC_INVALID_HANDLE)
+
+, _seg(NULL)
+, _segSize(0)
+, _ringSize(0)
+
+, _sendRing(NULL)
+, _sendData(NULL)
+, _sendCachedReadPos(0)
+
+, _recvRing(NULL)
+, _recvData(NULL)
+, _recvCachedWritePos(0)
+
+, _broken(false)
+{
+}
+
+LLBC_ShmChannel::~LLBC_ShmChannel()
+{
+    if (_seg)
+        ::munmap(_seg, _segSize);
+
+    if (_doorbell != LLBC_INVALID_HANDLE)
+        LLBC_CloseEventFd(_doorbell);
+    if (_peerDoorbell != LLBC_INVALID_HANDLE)
+        LLBC_CloseEventFd(_peerDoorbell);
+}
+
+int LLBC_ShmChannel::Connect(LLBC_SocketHandle ctrl, size_t ringSize)
+{
+    if (_seg || _doorbell != LLBC_INVALID_HANDLE)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_RTN_FAILED;
+    }
+
+    ringSize = LLBC_INL_NS __RoundUpRingSize(ringSize);
+
+    int shmFd;
+    if ((shmFd = CreateSegment(GetSegmentSize(ringSize))) == -1)
+        return LLBC_RTN_FAILED;
+
+    if (this->MapSegment(shmFd, ringSize, true) != LLBC_RTN_OK ||
+        (_doorbell = LLBC_CreateEventFd()) == LLBC_INVALID_HANDLE)
+    {
+        ::close(shmFd);
+        return LLBC_RTN_FAILED;
+    }
+
+    // Connector initialize the segment, both sides readers are waiting at the beginning.
+    LLBC_INL_NS __ShmSegHead *segHead = reinterpret_cast<LLBC_INL_NS __ShmSegHead *>(_seg);
+    segHead->magic = LLBC_INL_NS __shmMagic;
+    segHead->ringSize = static_cast<uint32>(ringSize);
+    _sendRing->readerWaiting = 1;
+    _recvRing->readerWaiting = 1;
+
+    // Send segment and self doorbell to acceptor, segment fd not need any more after sent.
+    LLBC_INL_NS __ShmHandshake handshake;
+    handshake.magic = LLBC_INL_NS __shmMagic;
+    handshake.version = LLBC_INL_NS __shmVersion;
+    handshake.ringSize = static_cast<uint32>(ringSize);
+    handshake.reserved = 0;
+
+    const int fds[2] = {shmFd, _doorbell};
+    int ret = LLBC_SendWithFds(ctrl, &handshake, sizeof(handshake), fds, 2);
+    ::close(shmFd);
+    if (ret != static_cast<int>(sizeof(handshake)))
+    {
+        if (ret >= 0)
+            LLBC_SetLastError(LLBC_ERROR_TRUNCATED);
+        return LLBC_RTN_FAILED;
+    }
+
+    // Wait acceptor reply, the reply carry acceptor's doorbell.
+    struct timeval timeout;
+    timeout.tv_sec = LLBC_CFG_COMM_SHM_HANDSHAKE_TIMEOUT / 1000;
+    timeout.tv_usec = (LLBC_CFG_COMM_SHM_HANDSHAKE_TIMEOUT % 1000) * 1000;
+    LLBC_SetSocketOption(ctrl, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    int peerDoorbell = LLBC_INVALID_HANDLE;
+    int fdCount = 1;
+    ret = LLBC_RecvWithFds(ctrl, &handshake, sizeof(handshake), &peerDoorbell, fdCount);
+
+    timeout.tv_sec = timeout.tv_usec = 0;
+    LLBC_SetSocketOption(ctrl, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    if (ret == -1)
+    {
+        if (LLBC_GetLastError() == LLBC_ERROR_WBLOCK ||
+            LLBC_GetLastError() == LLBC_ERROR_AGAIN)
+            LLBC_SetLastError(LLBC_ERROR_TIMEOUT);
+        return LLBC_RTN_FAILED;
+    }
+    else if (ret != static_cast<int>(sizeof(handshake)) ||
+        handshake.magic != LLBC_INL_NS __shmMagic ||
+        fdCount != 1)
+    {
+        if (fdCount == 1)
+            ::close(peerDoorbell);
+
+        LLBC_SetLastError(ret == 0 ? LLBC_ERROR_END : LLBC_ERROR_FORMAT);
+        return LLBC_RTN_FAILED;
+    }
+
+    _peerDoorbell = peerDoorbell;
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_ShmChannel::PrepareAccept()
+{
+    if (_doorbell != LLBC_INVALID_HANDLE)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_RTN_FAILED;
+    }
+
+    if ((_doorbell = LLBC_CreateEventFd()) == LLBC_INVALID_HANDLE)
+        return LLBC_RTN_FAILED;
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_ShmChannel::Accept(LLBC_SocketHandle ctrl)
+{
+    if (_doorbell == LLBC_INVALID_HANDLE)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_INIT);
+        return LLBC_RTN_FAILED;
+    }
+    else if (this->IsEstablished())
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_INL_NS __ShmHandshake handshake;
+    int fds[2] = {-1, -1};
+    int fdCount = 2;
+    int ret = LLBC_RecvWithFds(ctrl, &handshake, sizeof(handshake), fds, fdCount);
+    if (ret == -1)
+    {
+        return LLBC_RTN_FAILED;
+    }
+    else if (ret == 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_END);
+        return LLBC_RTN_FAILED;
+    }
+
+    struct stat shmStat;
+    if (ret != static_cast<int>(sizeof(handshake)) ||
+        handshake.magic != LLBC_INL_NS __shmMagic ||
+        handshake.version != LLBC_INL_NS __shmVersion ||
+        !LLBC_INL_NS __IsValidRingSize(handshake.ringSize) ||
+        fdCount != 2 ||
+        ::fstat(fds[0], &shmStat) != 0 ||
+        static_cast<size_t>(shmStat.st_size) < GetSegmentSize(handshake.ringSize))
+    {
+        for (int i = 0; i < fdCount; i++)
+            ::close(fds[i]);
+
+        LLBC_SetLastError(LLBC_ERROR_FORMAT);
+        return LLBC_RTN_FAILED;
+    }
+
+    ret = this->MapSegment(fds[0], handshake.ringSize, false);
+    ::close(fds[0]);
+    if (ret != LLBC_RTN_OK)
+    {
+        ::close(fds[1]);
+        return LLBC_RTN_FAILED;
+    }
+
+    // Reply self doorbell, the reply message is very small, fresh control socket always can send it.
+    handshake.reserved = 0;
+    if ((ret = LLBC_SendWithFds(ctrl, &handshake, sizeof(handshake), &_doorbell, 1)) !=
+            static_cast<int>(sizeof(handshake)))
+    {
+        ::close(fds[1]);
+
+        if (ret >= 0 ||
+            LLBC_GetLastError() == LLBC_ERROR_WBLOCK ||
+            LLBC_GetLastError() == LLBC_ERROR_AGAIN)
+            LLBC_SetLastError(LLBC_ERROR_TRUNCATED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _peerDoorbell = fds[1];
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_ShmChannel::IsEstablished() const
+{
+    return _seg && _peerDoorbell != LLBC_INVALID_HANDLE;
+}
+
+bool LLBC_ShmChannel::IsBroken() const
+{
+    return _broken;
+}
+
+size_t LLBC_ShmChannel::GetRingSize() const
+{
+    return _ringSize;
+}
+
+LLBC_Handle LLBC_ShmChannel::GetDoorbell() const
+{
+    return _doorbell;
+}
+
+size_t LLBC_ShmChannel::Write(const void *data, size_t len)
+{
+    // Only self write the writePos, read it directly, the readPos cached, only reload when ring seems full.
+    const sint64 writePos = _sendRing->writePos;
+    sint64 freeSize = static_cast<sint64>(_ringSize) - (writePos - _sendCachedReadPos);
+    if (freeSize < static_cast<sint64>(len))
+    {
+        _sendCachedReadPos = LLBC_AtomicGet(&_sendRing->readPos);
+        freeSize = static_cast<sint64>(_ringSize) - (writePos - _sendCachedReadPos);
+    }
+
+    // Positions in shared-memory, peer can write it, out of range means peer broken.
+    if (UNLIKELY(freeSize < 0 || freeSize > static_cast<sint64>(_ringSize)))
+    {
+        _broken = true;
+        return 0;
+    }
+
+    const size_t writeLen = MIN(len, static_cast<size_t>(freeSize));
+    if (writeLen == 0)
+        return 0;
+
+    const size_t offset = static_cast<size_t>(writePos) & (_ringSize - 1);
+    const size_t firstLen = MIN(writeLen, _ringSize - offset);
+    ::memcpy(_sendData + offset, data, firstLen);
+    if (firstLen < writeLen)
+        ::memcpy(_sendData, reinterpret_cast<const char *>(data) + firstLen, writeLen - firstLen);
+
+    // Atomic add is full barrier: data visible before position, and position visible
+    // before NotifyReader() check reader waiting flag(only self write the writePos).
+    LLBC_AtomicFetchAndAdd(&_sendRing->writePos, static_cast<sint32>(writeLen));
+
+    return writeLen;
+}
+
+size_t LLBC_ShmChannel::Read(void *buf, size_t len)
+{
+    const sint64 readPos = _recvRing->readPos;
+    sint64 readableSize = _recvCachedWritePos - readPos;
+    if (readableSize < static_cast<sint64>(len))
+    {
+        _recvCachedWritePos = LLBC_AtomicGet(&_recvRing->writePos);
+        readableSize = _recvCachedWritePos - readPos;
+    }
+
+    if (UNLIKELY(readableSize < 0 || readableSize > static_cast<sint64>(_ringSize)))
+    {
+        _broken = true;
+        return 0;
+    }
+
+    const size_t readLen = MIN(len, static_cast<size_t>(readableSize));
+    if (readLen == 0)
+        return 0;
+
+    const size_t offset = static_cast<size_t>(readPos) & (_ringSize - 1);
+    const size_t firstLen = MIN(readLen, _ringSize - offset);
+    ::memcpy(buf, _recvData + offset, firstLen);
+    if (firstLen < readLen)
+        ::memcpy(reinterpret_cast<char *>(buf) + firstLen, _recvData, readLen - firstLen);
+
+    // Atomic add is full barrier: data read out before position, and position visible
+    // before NotifyWriter() check writer waiting flag(only self write the readPos).
+    LLBC_AtomicFetchAndAdd(&_recvRing->readPos, static_cast<sint32>(readLen));
+
+    return readLen;
+}
+
+bool LLBC_ShmChannel::WaitReadable()
+{
+    // Set waiting flag first(CAS is full barrier, flag visible before recheck position), then recheck,
+    // pair with writer's Write() + NotifyReader(), at least one side will see the other side's change,
+    // wakeup never lost. If recheck found data, clear the flag(peer maybe already cleared it).
+    LLBC_AtomicCompareAndExchange(&_recvRing->readerWaiting, 1, 0);
+    if (LLBC_AtomicGet(&_recvRing->writePos) == _recvRing->readPos)
+        return true;
+
+    LLBC_AtomicCompareAndExchange(&_recvRing->readerWaiting, 0, 1);
+    return false;
+}
+
+bool LLBC_ShmChannel::WaitWritable()
+{
+    // Same as WaitReadable(), pair with reader's Read() + NotifyWriter().
+    LLBC_AtomicCompareAndExchange(&_sendRing->writerWaiting, 1, 0);
+
+    _sendCachedReadPos = LLBC_AtomicGet(&_sendRing->readPos);
+    if (_sendRing->writePos - _sendCachedReadPos == static_cast<sint64>(_ringSize))
+        return true;
+
+    LLBC_AtomicCompareAndExchange(&_sendRing->writerWaiting, 0, 1);
+    return false;
+}
+
+bool LLBC_ShmChannel::NotifyReader()
+{
+    if (_sendRing->readerWaiting == 0 ||
+        LLBC_AtomicCompareAndExchange(&_sendRing->readerWaiting, 0, 1) != 1)
+        return false;
+
+    LLBC_SignalEventFd(_peerDoorbell);
+    return true;
+}
+
+bool LLBC_ShmChannel::NotifyWriter()
+{
+    if (_recvRing->writerWaiting == 0 ||
+        LLBC_AtomicCompareAndExchange(&_recvRing->writerWaiting, 0, 1) != 1)
+        return false;
+
+    LLBC_SignalEventFd(_peerDoorbell);
+    return true;
+}
+
+void LLBC_ShmChannel::RingSelf()
+{
+    LLBC_SignalEventFd(_doorbell);
+}
+
+void LLBC_ShmChannel::ResetDoorbell()
+{
+    LLBC_ResetEventFd(_doorbell);
+}
+
+int LLBC_ShmChannel::MapSegment(int shmFd, size_t ringSize, bool connector)
+{
+    const size_t segSize = GetSegmentSize(ringSize);
+    void *seg = ::mmap(NULL, segSize, PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+    if (seg == MAP_FAILED)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    _seg = seg;
+    _segSize = segSize;
+    _ringSize = ringSize;
+
+    // Segment layout: | seg head | ring0 head | ring1 head | ring0 data | ring1 data |,
+    // ring0 is connector->acceptor direction, ring1 is acceptor->connector direction.
+    char *rings = reinterpret_cast<char *>(seg) + sizeof(LLBC_INL_NS __ShmSegHead);
+    _Ring *ring0 = reinterpret_cast<_Ring *>(rings);
+    _Ring *ring1 = ring0 + 1;
+    char *data0 = rings + sizeof(_Ring) * 2;
+    char *data1 = data0 + ringSize;
+
+    _sendRing = connector ? ring0 : ring1;
+    _sendData = connector ? data0 : data1;
+    _sendCachedReadPos = _sendRing->readPos;
+
+    _recvRing = connector ? ring1 : ring0;
+    _recvData = connector ? data1 : data0;
+    _recvCachedWritePos = _recvRing->writePos;
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_ShmChannel::CreateSegment(size_t segSize)
+{
+    static volatile sint32 seq = 0;
+
+    int shmFd = -1;
+    char name[64];
+    for (int i = 0; i < 8 && shmFd == -1; i++)
+    {
+        snprintf(name, sizeof(name), "/llbc_shm_%d_%d",
+            static_cast<int>(::getpid()), LLBC_AtomicFetchAndAdd(&seq, 1));
+        if ((shmFd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600)) == -1 && errno != EEXIST)
+            break;
+    }
+
+    if (shmFd == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return -1;
+    }
+
+    // Unlink immediately, the segment will be destroyed when all mappings and fds closed.
+    ::shm_unlink(name);
+    if (::ftruncate(shmFd, static_cast<off_t>(segSize)) != 0)
+    {
+        ::close(shmFd);
+
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return -1;
+    }
+
+    return shmFd;
+}
+
+size_t LLBC_ShmChannel::GetSegmentSize(size_t ringSize)
+{
+    return sizeof(LLBC_INL_NS __ShmSegHead) + sizeof(_Ring) * 2 + ringSize * 2;
+}
+
+__LLBC_NS_END
+
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+#include "llbc/common/AfterIncl.h"
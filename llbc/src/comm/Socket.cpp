@@ -13,6 +13,8 @@
 #include "llbc/comm/PollerType.h"
 #include "llbc/comm/Socket.h"
 #include "llbc/comm/Session.h"
+#include "llbc/comm/BasePoller.h"
+#include "llbc/comm/ShmChannel.h"
 
 namespace
 {
@@ -46,10 +48,15 @@ LLBC_Socket::LLBC_Socket(LLBC_SocketHandle handle)
 , _pollerType(_PollerType::End)
 
 , _listenSocket(false)
+, _unixSocket(false)
+, _shmSocket(false)
+, _shmChannel(NULL)
 , _peerAddr()
 , _localAddr()
 
 , _willSend()
+, _sendSyscallCount(0)
+, _sentBlockCount(0)
 #if LLBC_TARGET_PLATFORM_WIN32
 , _nonBlocking(false)
 , _olGroup()
@@ -66,6 +73,12 @@ LLBC_Socket::LLBC_Socket(LLBC_SocketHandle handle)
 LLBC_Socket::~LLBC_Socket()
 {
     this->Close();
+
+    // Shared-memory channel delete after socket closed, poller maybe still need it's doorbell
+    // to remove session after socket closed.
+#if LLBC_TARGET_PLATFORM_LINUX
+    LLBC_XDelete(_shmChannel);
+#endif // LLBC_TARGET_PLATFORM_LINUX
 }
 
 void LLBC_Socket::SetSession(LLBC_Session *session)
@@ -142,6 +155,11 @@ int LLBC_Socket::DisableAddressReusable()
     return LLBC_DisableAddressReusable(_handle);
 }
 
+int LLBC_Socket::EnablePortReusable()
+{
+    return LLBC_EnablePortReusable(_handle);
+}
+
 bool LLBC_Socket::IsNonBlocking() const
 {
 #if LLBC_TARGET_PLATFORM_NON_WIN32
@@ -205,6 +223,17 @@ int LLBC_Socket::BindTo(const LLBC_SockAddr_IN &addr)
     return LLBC_RTN_OK;
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+int LLBC_Socket::BindToUnix(const char *path)
+{
+    if (LLBC_BindToUnixAddress(_handle, path) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    _unixSocket = true;
+    return LLBC_RTN_OK;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 int LLBC_Socket::Listen(int backlog)
 {
     if (LLBC_ListenForConnection(_handle, backlog) != LLBC_RTN_OK)
@@ -221,12 +250,28 @@ bool LLBC_Socket::IsListen() const
 
 LLBC_Socket *LLBC_Socket::Accept()
 {
-    LLBC_SocketHandle newHandle = LLBC_AcceptClient(_handle, &_peerAddr);
+    LLBC_SocketHandle newHandle = LLBC_AcceptClient(_handle, _unixSocket ? NULL : &_peerAddr);
     if (newHandle == LLBC_INVALID_SOCKET_HANDLE)
         return NULL;
 
     LLBC_Socket *newSocket = LLBC_New1(LLBC_Socket, newHandle);
     newSocket->_pollerType = _pollerType;
+    newSocket->_unixSocket = _unixSocket;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Accepted shared-memory channel socket prepare channel doorbell at here, channel handshake
+    // will be finished when first control socket readable event arrived.
+    if (_shmSocket)
+    {
+        newSocket->_shmSocket = true;
+        newSocket->_shmChannel = LLBC_New(LLBC_ShmChannel);
+        if (newSocket->_shmChannel->PrepareAccept() != LLBC_RTN_OK)
+        {
+            LLBC_Delete(newSocket);
+            return NULL;
+        }
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX
 
     return newSocket;
 }
@@ -260,6 +305,67 @@ int LLBC_Socket::Connect(const LLBC_SockAddr_IN &addr)
     return LLBC_RTN_OK;
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+int LLBC_Socket::ConnectToUnix(const char *path)
+{
+    if (LLBC_ConnectToUnixPeer(_handle, path) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    _unixSocket = true;
+    return LLBC_RTN_OK;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+bool LLBC_Socket::IsUnix() const
+{
+    return _unixSocket;
+}
+
+#if LLBC_TARGET_PLATFORM_LINUX
+int LLBC_Socket::BindToShm(const char *path)
+{
+    if (this->BindToUnix(path) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    _shmSocket = true;
+    return LLBC_RTN_OK;
+}
+
+int LLBC_Socket::ConnectToShm(const char *path, size_t ringSize)
+{
+    if (_shmChannel)
+    {
+        LLBC_SetLastError(LLBC_ERROR_REENTRY);
+        return LLBC_RTN_FAILED;
+    }
+
+    if (this->ConnectToUnix(path) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_ShmChannel *channel = LLBC_New(LLBC_ShmChannel);
+    if (channel->Connect(_handle, ringSize) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(channel);
+        return LLBC_RTN_FAILED;
+    }
+
+    _shmSocket = true;
+    _shmChannel = channel;
+
+    return LLBC_RTN_OK;
+}
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+bool LLBC_Socket::IsShm() const
+{
+    return _shmSocket;
+}
+
+LLBC_ShmChannel *LLBC_Socket::GetShmChannel()
+{
+    return _shmChannel;
+}
+
 #if LLBC_TARGET_PLATFORM_WIN32
 int LLBC_Socket::ConnectEx(const LLBC_SockAddr_IN &addr, LLBC_POverlapped ol)
 {
@@ -294,9 +400,18 @@ int LLBC_Socket::AsyncSend(const char *buf, int len)
 
 int LLBC_Socket::AsyncSend(LLBC_MessageBlock *block)
 {
+    // Block may be a chain(eg: packet header block + shared payload block), append them all.
+    LLBC_MessageBlock *next = block->GetNext();
     if (_willSend.Append(block) != LLBC_RTN_OK)
         return LLBC_RTN_FAILED;
 
+    for (block = next; block; block = next)
+    {
+        next = block->GetNext();
+        if (_willSend.Append(block) != LLBC_RTN_OK)
+            LLBC_Delete(block);
+    }
+
 #if LLBC_TARGET_PLATFORM_WIN32
     if (_pollerType != _PollerType::IocpPoller)
         return LLBC_RTN_OK;
@@ -347,6 +462,27 @@ bool LLBC_Socket::IsExistNoSendData() const
     return !!_willSend.FirstBlock();
 }
 
+size_t LLBC_Socket::GetNoSendDataSize() const
+{
+    return _willSend.GetSize();
+}
+
+uint64 LLBC_Socket::GetSendSyscallCount() const
+{
+    return _sendSyscallCount;
+}
+
+uint64 LLBC_Socket::GetSentBlockCount() const
+{
+    return _sentBlockCount;
+}
+
+uint64 LLBC_Socket::GetSavedSendSyscallCount() const
+{
+    return _sentBlockCount > _sendSyscallCount ? 
+        _sentBlockCount - _sendSyscallCount : 0;
+}
+
 int LLBC_Socket::Recv(char *buf, int len)
 {
     return LLBC_Recv(_handle, buf, len, 0);
@@ -354,6 +490,10 @@ int LLBC_Socket::Recv(char *buf, int len)
 
 int LLBC_Socket::UpdateLocalAddress()
 {
+    // Unix domain socket has no ip address.
+    if (_unixSocket)
+        return LLBC_RTN_OK;
+
     return LLBC_GetSocketName(_handle, _localAddr);
 }
 
@@ -374,6 +514,9 @@ uint16 LLBC_Socket::GetLocalPort() const
 
 int LLBC_Socket::UpdatePeerAddress()
 {
+    if (_unixSocket)
+        return LLBC_RTN_OK;
+
     return LLBC_GetPeerSocketName(_handle, _peerAddr);
 }
 
@@ -409,7 +552,7 @@ void LLBC_Socket::OnSend()
             size_t sent = block->GetReadableSize();
             _olGroup.DeleteOverlapped(ol);
 
-            _session->OnSent(sent);
+            _session->OnSent(sent, 1);
 
             return;
         }
@@ -418,8 +561,52 @@ void LLBC_Socket::OnSend()
     }
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (_shmSocket)
+    {
+        this->OnShmSend();
+        return;
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
     int len = 0, totalLen = 0;
+    const uint64 oldSendSyscallCount = _sendSyscallCount;
     LLBC_MessageBlock *block = _willSend.FirstBlock();
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    // Gather send, flush at most LLBC_IOV_MAX blocks per writev() call.
+    LLBC_IoVec iovs[LLBC_CFG_COMM_MAX_GATHER_SEND_BLOCKS < LLBC_IOV_MAX ? 
+        LLBC_CFG_COMM_MAX_GATHER_SEND_BLOCKS : LLBC_IOV_MAX];
+    const int maxIovCount = sizeof(iovs) / sizeof(iovs[0]);
+    while (block)
+    {
+        int iovCount = 0;
+        size_t needSend = 0;
+        for (; block && iovCount < maxIovCount; block = block->GetNext())
+        {
+            iovs[iovCount].iov_base = block->GetDataStartWithReadPos();
+            iovs[iovCount].iov_len = block->GetReadableSize();
+            needSend += iovs[iovCount++].iov_len;
+        }
+
+        if ((len = LLBC_SendV(_handle, iovs, iovCount)) < 0)
+            break;
+
+        _sendSyscallCount += 1;
+        for (int i = 0, remain = len; 
+             i < iovCount && remain >= static_cast<int>(iovs[i].iov_len);
+             remain -= static_cast<int>(iovs[i++].iov_len))
+            _sentBlockCount += 1;
+
+        totalLen += len;
+        _willSend.Remove(len);
+
+        // Partial sent, socket send buffer is full, wait next writable event.
+        if (static_cast<size_t>(len) < needSend)
+            break;
+
+        block = _willSend.FirstBlock();
+    }
+#else // LLBC_TARGET_PLATFORM_WIN32
     while (block)
     {
         if ((len = LLBC_Send(_handle, 
@@ -427,10 +614,15 @@ void LLBC_Socket::OnSend()
                              static_cast<int>(block->GetReadableSize()), 0)) < 0)
             break;
 
+        _sendSyscallCount += 1;
+        if (static_cast<size_t>(len) == block->GetReadableSize())
+            _sentBlockCount += 1;
+
         totalLen += len;
         _willSend.Remove(len);
         block = _willSend.FirstBlock();
     }
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
 
     if (len < 0 && LLBC_GetLastError() != LLBC_ERROR_WBLOCK
 #if LLBC_TARGET_PLATFORM_NON_WIN32
@@ -444,7 +636,7 @@ void LLBC_Socket::OnSend()
     }
 
     if (totalLen > 0)
-        _session->OnSent(totalLen);
+        _session->OnSent(totalLen, static_cast<int>(_sendSyscallCount - oldSendSyscallCount));
 
 #if LLBC_TARGET_PLATFORM_WIN32
     if (_pollerType != _PollerType::IocpPoller)
@@ -510,10 +702,22 @@ void LLBC_Socket::OnRecv()
     }
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (_shmSocket)
+    {
+        this->OnShmCtrlRecv();
+        return;
+    }
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
     int len = 0;
     bool recvFlag = false;
-    
-    LLBC_MessageBlock *block = LLBC_New(LLBC_MessageBlock);
+
+    // Receive data into poller's pooled blocks, if block full, chain new block.
+    LLBC_MessageBlockPool &pool = _session->GetPoller()->GetRecvBlockPool();
+
+    LLBC_MessageBlock *head = pool.Acquire();
+    LLBC_MessageBlock *block = head;
     while ((len = LLBC_Recv(_handle,
                             block->GetDataStartWithWritePos(),
                             static_cast<int>(block->GetWritableSize()),
@@ -521,7 +725,10 @@ void LLBC_Socket::OnRecv()
     {
         block->ShiftWritePos(len);
         if (block->GetWritableSize() == 0)
-            block->Allocate();
+        {
+            block->SetNext(pool.Acquire());
+            block = block->GetNext();
+        }
 
         recvFlag = true;
     }
@@ -529,14 +736,18 @@ void LLBC_Socket::OnRecv()
     int errNo = LLBC_GetLastError();
     int subErrNo = LLBC_GetSubErrorNo();
 
+    // Blocks chain only borrow to session, after session process, recycle it.
     if (recvFlag)
     {
-        if (!_session->OnRecved(block))
+        const bool recvRet = _session->OnRecved(head);
+        pool.ReleaseChain(head);
+
+        if (!recvRet)
             return;
     }
     else
     {
-        LLBC_Delete(block);
+        pool.ReleaseChain(head);
     }
 
     LLBC_SetLastError(errNo);
@@ -561,6 +772,143 @@ void LLBC_Socket::OnRecv()
 #endif // LLBC_TARGET_PLATFORM_WIN32
 }
 
+#if LLBC_TARGET_PLATFORM_LINUX
+void LLBC_Socket::OnShmWakeup()
+{
+    _shmChannel->ResetDoorbell();
+    if (UNLIKELY(!_shmChannel->IsEstablished()))
+        return;
+
+    // Drain the channel into poller's pooled blocks, at most one ring size per wakeup, if reach,
+    // ring self doorbell to continue in next poller loop, give other sessions a chance.
+    LLBC_MessageBlockPool &pool = _session->GetPoller()->GetRecvBlockPool();
+
+    size_t len, recvLen = 0;
+    LLBC_MessageBlock *head = pool.Acquire();
+    LLBC_MessageBlock *block = head;
+    for (; ;)
+    {
+        while ((len = _shmChannel->Read(block->GetDataStartWithWritePos(), block->GetWritableSize())) > 0)
+        {
+            block->ShiftWritePos(len);
+            if (block->GetWritableSize() == 0)
+            {
+                block->SetNext(pool.Acquire());
+                block = block->GetNext();
+            }
+
+            recvLen += len;
+        }
+
+        if (UNLIKELY(_shmChannel->IsBroken()))
+        {
+            pool.ReleaseChain(head);
+            _session->OnClose();
+
+            return;
+        }
+
+        if (recvLen >= _shmChannel->GetRingSize())
+        {
+            _shmChannel->RingSelf();
+            break;
+        }
+        else if (_shmChannel->WaitReadable())
+        {
+            break;
+        }
+    }
+
+    if (recvLen > 0)
+    {
+        _shmChannel->NotifyWriter();
+
+        const bool recvRet = _session->OnRecved(head);
+        pool.ReleaseChain(head);
+
+        if (!recvRet)
+            return;
+    }
+    else
+    {
+        pool.ReleaseChain(head);
+    }
+
+    // Doorbell maybe rang by peer read data, continue send not send data.
+    if (_willSend.FirstBlock())
+        this->OnShmSend();
+}
+
+void LLBC_Socket::OnShmCtrlRecv()
+{
+    if (!_shmChannel->IsEstablished())
+    {
+        if (_shmChannel->Accept(_handle) != LLBC_RTN_OK)
+        {
+            if (LLBC_GetLastError() != LLBC_ERROR_WBLOCK &&
+                LLBC_GetLastError() != LLBC_ERROR_AGAIN)
+                _session->OnClose();
+
+            return;
+        }
+
+        // Channel established, send the data which sent before handshake finished.
+        if (_willSend.FirstBlock())
+            this->OnShmSend();
+
+        return;
+    }
+
+    // After handshake, peer never send data by control socket, readable means peer closed.
+    int len;
+    char buf[64];
+    while ((len = LLBC_Recv(_handle, buf, sizeof(buf), 0)) > 0);
+
+    if (len == 0 || (LLBC_GetLastError() != LLBC_ERROR_WBLOCK &&
+        LLBC_GetLastError() != LLBC_ERROR_AGAIN))
+        _session->OnClose();
+}
+
+void LLBC_Socket::OnShmSend()
+{
+    if (UNLIKELY(!_shmChannel->IsEstablished()))
+        return;
+
+    size_t totalLen = 0;
+    LLBC_MessageBlock *block;
+    while ((block = _willSend.FirstBlock()))
+    {
+        const size_t needSend = block->GetReadableSize();
+        const size_t len = _shmChannel->Write(block->GetDataStartWithReadPos(), needSend);
+        if (UNLIKELY(_shmChannel->IsBroken()))
+        {
+            _session->OnClose();
+            return;
+        }
+
+        if (len > 0)
+        {
+            totalLen += len;
+            _willSend.Remove(len);
+        }
+
+        if (len == needSend)
+            _sentBlockCount += 1;
+        else if (_shmChannel->WaitWritable()) // Ring full, wait peer read and ring the doorbell.
+            break;
+    }
+
+    if (totalLen == 0)
+        return;
+
+    // Only ring peer doorbell when peer waiting, busy channel not need any syscall.
+    const int notifyCalls = _shmChannel->NotifyReader() ? 1 : 0;
+    _sendSyscallCount += notifyCalls;
+
+    _session->OnSent(totalLen, notifyCalls);
+}
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
 #if LLBC_TARGET_PLATFORM_WIN32
 void LLBC_Socket::OnClose(LLBC_POverlapped ol)
 #else
@@ -0,0 +1,156 @@
+/**
+ * @file    ZlibCompressor.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/common/ThirdHeader.h"
+
+#include "llbc/comm/ZlibCompressor.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_ZlibCompressor::LLBC_ZlibCompressor(int level)
+: _level(level)
+
+, _deflateStream(NULL)
+, _inflateStream(NULL)
+{
+}
+
+LLBC_ZlibCompressor::~LLBC_ZlibCompressor()
+{
+    if (_deflateStream)
+    {
+        deflateEnd(_deflateStream);
+        LLBC_Delete(_deflateStream);
+    }
+
+    if (_inflateStream)
+    {
+        inflateEnd(_inflateStream);
+        LLBC_Delete(_inflateStream);
+    }
+}
+
+int LLBC_ZlibCompressor::Compress(const void *data, size_t len, LLBC_MessageBlock &out)
+{
+    // Create deflate stream at first time, after that, only reset it.
+    if (!_deflateStream)
+    {
+        _deflateStream = LLBC_New(z_stream);
+        LLBC_MemSet(_deflateStream, 0, sizeof(z_stream));
+        if (deflateInit(_deflateStream, _level) != Z_OK)
+        {
+            LLBC_XDelete(_deflateStream);
+
+            LLBC_SetLastError(LLBC_ERROR_UNKNOWN);
+            return LLBC_RTN_FAILED;
+        }
+    }
+    else if (deflateReset(_deflateStream) != Z_OK)
+    {
+        LLBC_SetLastError(LLBC_ERROR_UNKNOWN);
+        return LLBC_RTN_FAILED;
+    }
+
+    // Write raw length.
+    const uint32 rawLen = LLBC_Host2Net2(static_cast<uint32>(len));
+    out.Write(&rawLen, sizeof(uint32));
+
+    // Make sure out block has enough space to hold all compressed data.
+    const size_t bound = deflateBound(_deflateStream, static_cast<uLong>(len));
+    if (out.GetWritableSize() < bound)
+        out.Allocate(bound - out.GetWritableSize());
+
+    _deflateStream->next_in = reinterpret_cast<Bytef *>(const_cast<void *>(data));
+    _deflateStream->avail_in = static_cast<uInt>(len);
+    _deflateStream->next_out = reinterpret_cast<Bytef *>(out.GetDataStartWithWritePos());
+    _deflateStream->avail_out = static_cast<uInt>(bound);
+    if (deflate(_deflateStream, Z_FINISH) != Z_STREAM_END)
+    {
+        LLBC_SetLastError(LLBC_ERROR_UNKNOWN);
+        return LLBC_RTN_FAILED;
+    }
+
+    out.ShiftWritePos(static_cast<long>(_deflateStream->total_out));
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_ZlibCompressor::Decompress(const void *data, size_t len, LLBC_MessageBlock &out)
+{
+    // Read raw length.
+    uint32 rawLen = 0;
+    if (UNLIKELY(len < sizeof(uint32)))
+    {
+        LLBC_SetLastError(LLBC_ERROR_FORMAT);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_MemCpy(&rawLen, data, sizeof(uint32));
+    LLBC_Net2Host(rawLen);
+    if (UNLIKELY(rawLen > LLBC_CFG_COMM_MAX_DECOMPRESSED_SIZE))
+    {
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_RTN_FAILED;
+    }
+
+    // Create inflate stream at first time, after that, only reset it.
+    if (!_inflateStream)
+    {
+        _inflateStream = LLBC_New(z_stream);
+        LLBC_MemSet(_inflateStream, 0, sizeof(z_stream));
+        if (inflateInit(_inflateStream) != Z_OK)
+        {
+            LLBC_XDelete(_inflateStream);
+
+            LLBC_SetLastError(LLBC_ERROR_UNKNOWN);
+            return LLBC_RTN_FAILED;
+        }
+    }
+    else if (inflateReset(_inflateStream) != Z_OK)
+    {
+        LLBC_SetLastError(LLBC_ERROR_UNKNOWN);
+        return LLBC_RTN_FAILED;
+    }
+
+    if (out.GetWritableSize() < rawLen)
+        out.Allocate(rawLen - out.GetWritableSize());
+
+    _inflateStream->next_in =
+        reinterpret_cast<Bytef *>(const_cast<char *>(reinterpret_cast<const char *>(data) + sizeof(uint32)));
+    _inflateStream->avail_in = static_cast<uInt>(len - sizeof(uint32));
+    _inflateStream->next_out = reinterpret_cast<Bytef *>(out.GetDataStartWithWritePos());
+    _inflateStream->avail_out = static_cast<uInt>(rawLen);
+    if (inflate(_inflateStream, Z_FINISH) != Z_STREAM_END ||
+        _inflateStream->total_out != rawLen)
+    {
+        LLBC_SetLastError(LLBC_ERROR_FORMAT);
+        return LLBC_RTN_FAILED;
+    }
+
+    out.ShiftWritePos(static_cast<long>(rawLen));
+
+    return LLBC_RTN_OK;
+}
+
+LLBC_ZlibCompressorFactory::LLBC_ZlibCompressorFactory(int level)
+: _level(level)
+{
+}
+
+LLBC_ICompressor *LLBC_ZlibCompressorFactory::Create() const
+{
+    return LLBC_New1(LLBC_ZlibCompressor, _level);
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
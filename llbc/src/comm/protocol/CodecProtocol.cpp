@@ -17,6 +17,8 @@
 __LLBC_NS_BEGIN
 
 LLBC_CodecProtocol::LLBC_CodecProtocol()
+: _coders()
+, _coderTable(NULL)
 {
 }
 
@@ -46,11 +48,29 @@ int LLBC_CodecProtocol::Recv(void *in, void *&out)
 {
     out = in;
     LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
-    _Coders::iterator it = _coders.find(packet->GetOpcode());
-    if (it != _coders.end())
+
+    LLBC_ICoderFactory *factory = NULL;
+    if (_coderTable)
+    {
+        factory = _coderTable->Find(packet->GetOpcode());
+    }
+    else
+    {
+        _Coders::iterator it = _coders.find(packet->GetOpcode());
+        if (it != _coders.end())
+            factory = it->second;
+    }
+
+    if (factory)
     {
-        LLBC_ICoder *coder = it->second->Create();
-        coder->Decode(*packet);
+        LLBC_ICoder *coder = factory->Create();
+        if (!coder->TryDecode(*packet))
+        {
+            LLBC_Delete(coder);
+
+            LLBC_SetLastError(LLBC_ERROR_FORMAT);
+            return LLBC_RTN_FAILED;
+        }
 
         packet->SetDecoder(coder);
     }
@@ -69,6 +89,11 @@ int LLBC_CodecProtocol::AddCoder(int opcode, LLBC_ICoderFactory *coder)
     return LLBC_RTN_OK;
 }
 
+void LLBC_CodecProtocol::SetCoderTable(const LLBC_DispatchTable<int, LLBC_ICoderFactory> *coderTable)
+{
+    _coderTable = coderTable;
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -10,17 +10,29 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/comm/Packet.h"
+#include "llbc/comm/ICompressor.h"
+#include "llbc/comm/PacketHeaderDescAccessor.h"
+
 #include "llbc/comm/protocol/ProtocolLayer.h"
+#include "llbc/comm/protocol/ProtoReportLevel.h"
 #include "llbc/comm/protocol/IProtocol.h"
+#include "llbc/comm/protocol/ProtocolStack.h"
 
 __LLBC_NS_BEGIN
 
 LLBC_CompressProtocol::LLBC_CompressProtocol()
+: _compressor(NULL)
+, _threshold(LLBC_CFG_COMM_DFT_COMPRESS_THRESHOLD)
+
+, _buf(NULL)
 {
 }
 
 LLBC_CompressProtocol::~LLBC_CompressProtocol()
 {
+    LLBC_XDelete(_compressor);
+    LLBC_XDelete(_buf);
 }
 
 int LLBC_CompressProtocol::GetLayer() const
@@ -36,12 +48,57 @@ int LLBC_CompressProtocol::Connect(LLBC_SockAddr_IN &local, LLBC_SockAddr_IN &pe
 int LLBC_CompressProtocol::Send(void *in, void *&out)
 {
     out = in;
+    if (!_compressor)
+        return LLBC_RTN_OK;
+
+    // The highest flag bit is the compressed mark in this service, clear it first, peer
+    // will not take raw payload as compressed payload.
+    LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
+    packet->SetPayloadCompressed(false);
+
+    const size_t payloadLen = packet->GetPayloadLength();
+    if (payloadLen < _threshold)
+        return LLBC_RTN_OK;
+
+    // Compress payload, if compress failed or compressed data not smaller than raw data, send raw payload.
+    _buf->SetReadPos(0);
+    _buf->SetWritePos(0);
+    if (_compressor->Compress(packet->GetPayload(), payloadLen, *_buf) != LLBC_RTN_OK ||
+        _buf->GetWritePos() >= payloadLen)
+        return LLBC_RTN_OK;
+
+    packet->SetPayload(_buf->GetData(), _buf->GetWritePos());
+    packet->SetPayloadCompressed(true);
+
     return LLBC_RTN_OK;
 }
 
 int LLBC_CompressProtocol::Recv(void *in, void *&out)
 {
     out = in;
+
+    LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
+    if (!_compressor || !packet->IsPayloadCompressed())
+        return LLBC_RTN_OK;
+
+    _buf->SetReadPos(0);
+    _buf->SetWritePos(0);
+    if (_compressor->Decompress(packet->GetPayload(), packet->GetPayloadLength(), *_buf) != LLBC_RTN_OK)
+    {
+        _stack->Report(this,
+                       LLBC_ProtoReportLevel::Error,
+                       LLBC_String().format("decompress packet failed, opcode: %d, payload len: %lu",
+                                            packet->GetOpcode(), static_cast<ulong>(packet->GetPayloadLength())));
+
+        LLBC_PacketPool::Release(packet);
+        out = NULL;
+
+        return LLBC_RTN_FAILED;
+    }
+
+    packet->SetPayload(_buf->GetData(), _buf->GetWritePos());
+    packet->SetPayloadCompressed(false);
+
     return LLBC_RTN_OK;
 }
 
@@ -51,6 +108,24 @@ int LLBC_CompressProtocol::AddCoder(int opcode, LLBC_ICoderFactory *coder)
     return LLBC_RTN_FAILED;
 }
 
+void LLBC_CompressProtocol::SetCompressor(LLBC_ICompressor *compressor, size_t threshold)
+{
+    LLBC_XDelete(_compressor);
+
+    // Compressed packet must mark the highest flag bit, if header has no flags part, ignore compressor.
+    if (!LLBC_PacketHeaderDescAccessor::GetHeaderDesc()->IsHasFlagsPart())
+    {
+        LLBC_XDelete(compressor);
+        return;
+    }
+
+    _compressor = compressor;
+    _threshold = threshold;
+
+    if (_compressor && !_buf)
+        _buf = LLBC_New(LLBC_MessageBlock);
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
@@ -27,11 +27,6 @@ namespace
 
 __LLBC_INTERNAL_NS_BEGIN
 
-void inline __DelBlock(void *data)
-{
-    LLBC_Delete(reinterpret_cast<LLBC_NS LLBC_MessageBlock *>(data));
-}
-
 void inline __DelPacketList(void *&data)
 {
     if (!data)
@@ -42,7 +37,7 @@ void inline __DelPacketList(void *&data)
 
     LLBC_NS LLBC_Packet *packet;
     while (block->Read(&packet, sizeof(LLBC_NS LLBC_Packet *)) == LLBC_RTN_OK)
-        LLBC_Delete(packet);
+        LLBC_NS LLBC_PacketPool::Release(packet);
 
     LLBC_Delete(block);
 
@@ -66,7 +61,7 @@ LLBC_PacketProtocol::LLBC_PacketProtocol()
 
 LLBC_PacketProtocol::~LLBC_PacketProtocol()
 {
-    LLBC_XDelete(_packet);
+    LLBC_PacketPool::Release(_packet);
 }
 
 int LLBC_PacketProtocol::GetLayer() const
@@ -84,7 +79,7 @@ int LLBC_PacketProtocol::Send(void *in, void *&out)
     LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
 
     out = packet->GiveUp();
-    LLBC_Delete(packet);
+    LLBC_PacketPool::Release(packet);
 
     return LLBC_RTN_OK;
 }
@@ -92,10 +87,21 @@ int LLBC_PacketProtocol::Send(void *in, void *&out)
 int LLBC_PacketProtocol::Recv(void *in, void *&out)
 {
     out = NULL;
-    LLBC_MessageBlock *block = reinterpret_cast<LLBC_MessageBlock *>(in);
 
-    LLBC_InvokeGuard guard(&LLBC_INL_NS __DelBlock, block);
-    
+    // Consume the blocks chain one by one, no need to merge it.
+    for (LLBC_MessageBlock *block = reinterpret_cast<LLBC_MessageBlock *>(in);
+         block;
+         block = block->GetNext())
+    {
+        if (this->RecvBlock(block, out) != LLBC_RTN_OK)
+            return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_PacketProtocol::RecvBlock(LLBC_MessageBlock *block, void *&out)
+{
     size_t readableSize;
     while ((readableSize = block->GetReadableSize()) > 0)
     {
@@ -109,7 +115,7 @@ int LLBC_PacketProtocol::Recv(void *in, void *&out)
                 return LLBC_RTN_OK;
 
             // Create new packet.
-            _packet = LLBC_New(LLBC_Packet);
+            _packet = LLBC_PacketPool::Acquire();
             _packet->WriteHeader(_headerAssembler.GetHeader());
             _payloadNeedRecv = _packet->GetLength() - _headerIncludedLen;
             if (_payloadNeedRecv < 0)
@@ -120,7 +126,8 @@ int LLBC_PacketProtocol::Recv(void *in, void *&out)
 
                 _headerAssembler.Reset();
 
-                LLBC_XDelete(_packet);
+                LLBC_PacketPool::Release(_packet);
+                _packet = NULL;
                 _payloadNeedRecv = 0;
 
                 LLBC_INL_NS __DelPacketList(out);
@@ -130,7 +137,8 @@ int LLBC_PacketProtocol::Recv(void *in, void *&out)
 
             // Reset the header assembler.
             _headerAssembler.Reset();
-            if (headerUsed == readableSize) // If readable size equal headerUsed, just return.
+            // If readable size equal headerUsed, just return, but empty payload packet must construct immediately.
+            if (headerUsed == readableSize && _payloadNeedRecv > 0)
                 return LLBC_RTN_OK;
 
             // Offset the readable buffer pointer and modify readable size value.
@@ -35,7 +35,7 @@ void __DeletePacketsBlock(void *data)
 
     _Packet *packet;
     while (block->Read(&packet, sizeof(_Packet *)) == LLBC_RTN_OK)
-        LLBC_Delete(packet);
+        LLBC_NS LLBC_PacketPool::Release(packet);
 
     LLBC_Delete(block);
 }
@@ -204,7 +204,9 @@ int LLBC_ProtocolStack::RecvRaw(LLBC_MessageBlock *block, std::vector<LLBC_Packe
                 //  Just need delete decoded packets, and non-decode packets.
              
                 // Delete all decoded packets.
-                LLBC_STLHelper::DeleteContainer(packets);
+                for (size_t i = 0; i < packets.size(); i++)
+                    LLBC_PacketPool::Release(packets[i]);
+                packets.clear();
                 // Delete non-decode packets and the message-block.
                 // Yeah, this operation will done by LLBC_InvokeGuard, we don't need care it too.
                 return LLBC_RTN_FAILED;
@@ -246,9 +248,12 @@ int LLBC_ProtocolStack::Recv(LLBC_MessageBlock *block, std::vector<LLBC_Packet *
         LLBC_Packet *packet;
         if (this->RecvCodec(rawPackets[i], packet) != LLBC_RTN_OK)
         {
-            LLBC_STLHelper::DeleteContainer(packets);
-            for (++i; i < rawPackets.size(); i++)
-                LLBC_Delete(rawPackets[i]);
+            for (size_t j = 0; j < packets.size(); j++)
+                LLBC_PacketPool::Release(packets[j]);
+            packets.clear();
+
+            for (; i < rawPackets.size(); i++)
+                LLBC_PacketPool::Release(rawPackets[i]);
 
             return LLBC_RTN_FAILED;
         }
@@ -55,29 +55,41 @@ int LLBC_RawProtocol::Send(void *in, void *&out)
     LLBC_Packet *packet = reinterpret_cast<LLBC_Packet *>(in);
     LLBC_MessageBlock *block = packet->GiveUp();
 
+    // Skip header, if payload is shared, header block will be empty, discard it.
     block->SetReadPos(_headerLen);
-    out = block;
-
-    LLBC_Delete(packet);
+    if (block->GetReadableSize() == 0 && block->GetNext())
+    {
+        out = block->GetNext();
+        LLBC_Delete(block);
+    }
+    else
+    {
+        out = block;
+    }
+
+    LLBC_PacketPool::Release(packet);
 
     return LLBC_RTN_OK;
 }
 
 int LLBC_RawProtocol::Recv(void *in, void *&out)
 {
-    LLBC_MessageBlock *block = reinterpret_cast<LLBC_MessageBlock *>(in);
-
-    // Create packet and write data.
-    LLBC_Packet *packet = LLBC_New(LLBC_Packet);
-    const size_t readableSize = block->GetReadableSize();
-    packet->Write(block->GetDataStartWithReadPos(), readableSize);
+    // Create packet and write all blocks chain data.
+    size_t readableSize = 0;
+    LLBC_Packet *packet = LLBC_PacketPool::Acquire();
+    for (LLBC_MessageBlock *block = reinterpret_cast<LLBC_MessageBlock *>(in);
+         block;
+         block = block->GetNext())
+    {
+        const size_t blockReadableSize = block->GetReadableSize();
+        packet->Write(block->GetDataStartWithReadPos(), blockReadableSize);
+
+        readableSize += blockReadableSize;
+    }
 
     // Write length part.
     packet->SetHeaderPartVal(_lenPartId, static_cast<sint32>(readableSize));
 
-    // Delete this block.
-    LLBC_Delete(block);
-
     // Create output.
     out = LLBC_New1(LLBC_MessageBlock, sizeof(LLBC_Packet *));
     (reinterpret_cast<LLBC_MessageBlock *>(out))->Write(&packet, sizeof(LLBC_Packet *));
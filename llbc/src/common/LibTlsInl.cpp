@@ -35,10 +35,16 @@ __LLBC_LibTls::__LLBC_LibTls()
     this->coreTls.nativeThreadHandle =LLBC_INVALID_NATIVE_THREAD_HANDLE;
     this->coreTls.task = NULL;
     this->coreTls.timerScheduler = NULL;
+    ::memset(this->coreTls.logRings, 0, sizeof(this->coreTls.logRings));
+    ::memset(this->coreTls.logRingOwners, 0, sizeof(this->coreTls.logRingOwners));
+    this->coreTls.logCachedTime = -1;
+    this->coreTls.logCachedTimeStr[0] = '\0';
+    this->coreTls.logCachedTimeLen = 0;
 
     objbaseTls.poolStack = NULL;
 
     ::memset(commTls.services, 0, sizeof(commTls.services));
+    commTls.packetPool = NULL;
 }
 
 void __LLBC_CreateLibTls()
@@ -11,6 +11,7 @@
 #include "llbc/common/BeforeIncl.h"
 
 #include "llbc/core/Core.h"
+#include "llbc/core/log/LogRunnable.h"
 
 __LLBC_NS_BEGIN
 
@@ -56,6 +57,9 @@ void __LLBC_CoreCleanup()
 
     LLBC_TimerScheduler::DestroyEntryThreadScheduler();
 
+    // Release entry thread log rings.
+    LLBC_LogRunnable::ReleaseThreadRings();
+
     // Destroy main bundle.
     LLBC_Bundle::DestroyMainBundle();
 }
@@ -49,6 +49,11 @@ void LLBC_BaseLogAppender::Finalize()
     LLBC_XDelete(_chain);
 }
 
+int LLBC_BaseLogAppender::Flush()
+{
+    return LLBC_RTN_OK;
+}
+
 LLBC_LogTokenChain *LLBC_BaseLogAppender::GetTokenChain() const
 {
     return _chain;
@@ -14,6 +14,9 @@
 #include "llbc/core/file/File.h"
 #include "llbc/core/utils/Util_Text.h"
 
+#include "llbc/core/os/OS_Time.h"
+#include "llbc/core/thread/Guard.h"
+
 #include "llbc/core/log/LogData.h"
 #include "llbc/core/log/LogLevel.h"
 #include "llbc/core/log/LogTokenChain.h"
@@ -26,7 +29,16 @@ LLBC_LogFileAppender::LLBC_LogFileAppender()
 , _maxFileSize(LONG_MAX)
 , _maxBackupIndex(INT_MAX)
 , _fileName()
+
+, _fileLock()
 , _file(NULL)
+, _fileSize(0)
+
+, _flushInterval(LLBC_CFG_LOG_DEFAULT_SYNC_FILE_FLUSH_INTERVAL)
+, _bufferSize(LLBC_CFG_LOG_DEFAULT_FILE_BUFFER_SIZE)
+, _lastFlushTime(0)
+
+, _formattedData()
 {
 }
 
@@ -53,12 +65,16 @@ int LLBC_LogFileAppender::Initialize(const LLBC_LogAppenderInitInfo &initInfo)
 
     _isDailyRolling = initInfo.dailyRolling;
 
-    _maxFileSize = MAX(1, initInfo.maxFileSize);
+    _maxFileSize = static_cast<size_t>(MAX(1L, initInfo.maxFileSize));
     _maxBackupIndex = MAX(0, initInfo.maxBackupIndex);
 
     _fileName.clear();
     _fileName.append(initInfo.file);
 
+    _flushInterval = MAX(0, initInfo.flushInterval);
+    _bufferSize = MAX(0, initInfo.bufferSize);
+    _lastFlushTime = LLBC_GetMilliSeconds();
+
     _file = new LLBC_File;
     if (this->OpenLogFile(*_file) != LLBC_RTN_OK)
     {
@@ -79,6 +95,13 @@ void LLBC_LogFileAppender::Finalize()
     _fileName.clear();
 
     LLBC_XDelete(_file);
+    _fileSize = 0;
+
+    _flushInterval = LLBC_CFG_LOG_DEFAULT_SYNC_FILE_FLUSH_INTERVAL;
+    _bufferSize = LLBC_CFG_LOG_DEFAULT_FILE_BUFFER_SIZE;
+    _lastFlushTime = 0;
+
+    _formattedData.clear();
 
     _Base::Finalize();
 }
@@ -92,35 +115,79 @@ int LLBC_LogFileAppender::Output(const LLBC_LogData &data)
         return LLBC_RTN_FAILED;
     }
 
-    const size_t fileSize = _file->GetSize();
-    if (fileSize > _maxFileSize || fileSize < 0)
+    // Synchronous loggers output in logging threads, file, file size and formatted data buffer
+    // shared by all threads, guard them.
+    LLBC_Guard guard(_fileLock);
+
+    // File size tracked by appender self, if exceed limit, close(will flush) and reopen.
+    if (_fileSize > _maxFileSize)
     {
         _file->Close();
         if (this->OpenLogFile(*_file) != LLBC_RTN_OK)
             return LLBC_RTN_FAILED;
     }
 
-    LLBC_String formattedData;
+    // Reuse formatted data buffer, and write to file buffer, file buffer full will write to file.
+    _formattedData.clear();
+    chain->Format(data, _formattedData);
 
-    chain->Format(data, formattedData);
     const size_t actuallyWrite = 
-        _file->Write(formattedData.data(), formattedData.size());
-    if (actuallyWrite != LLBC_File::npos)
+        _file->Write(_formattedData.data(), _formattedData.size());
+    if (actuallyWrite == LLBC_File::npos)
+        return LLBC_RTN_FAILED;
+
+    _fileSize += actuallyWrite;
+
+    // Fatal log or reach flush interval, flush it.
+    if (data.level >= LLBC_LogLevel::Fatal ||
+        LLBC_GetMilliSeconds() - _lastFlushTime >= _flushInterval)
+        this->DoFlush();
+
+    if (actuallyWrite != _formattedData.size())
     {
-        _file->Flush();
-        if (actuallyWrite != formattedData.size())
-        {
-            LLBC_SetLastError(LLBC_ERROR_TRUNCATED);
-            return LLBC_RTN_FAILED;
-        }
+        LLBC_SetLastError(LLBC_ERROR_TRUNCATED);
+        return LLBC_RTN_FAILED;
+    }
 
+    return LLBC_RTN_OK;
+}
+
+int LLBC_LogFileAppender::Flush()
+{
+    LLBC_Guard guard(_fileLock);
+    return this->DoFlush();
+}
+
+int LLBC_LogFileAppender::DoFlush()
+{
+    if (!_file || !_file->IsOpened())
         return LLBC_RTN_OK;
+
+    _lastFlushTime = LLBC_GetMilliSeconds();
+
+    return _file->Flush();
+}
+
+int LLBC_LogFileAppender::OpenLogFile(LLBC_File &file)
+{
+    if (this->DoOpenLogFile(file) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    // Use full buffer mode, and track file size self, avoid get file size in every output.
+    if (_bufferSize > 0)
+        file.SetBufferMode(LLBC_FileBufferMode::FullBuf, _bufferSize);
+
+    _fileSize = file.GetSize();
+    if (_fileSize == LLBC_File::npos)
+    {
+        file.Close();
+        return LLBC_RTN_FAILED;
     }
 
-    return LLBC_RTN_FAILED;
+    return LLBC_RTN_OK;
 }
 
-int LLBC_LogFileAppender::OpenLogFile(LLBC_File &file) const
+int LLBC_LogFileAppender::DoOpenLogFile(LLBC_File &file) const
 {
     LLBC_String name;
 
@@ -39,7 +39,7 @@ void LLBC_LogFileToken::Format(const LLBC_LogData &data, LLBC_String &formattedD
 {
     int index = static_cast<int>(formattedData.size());
     if (data.fileLen)
-        formattedData.append(data.others + data.fileBeg, data.fileLen);
+        formattedData.append(data.file, data.fileLen);
 
     LLBC_LogFormattingInfo *formatter = this->GetFormatter();
     formatter->Format(formattedData, index);
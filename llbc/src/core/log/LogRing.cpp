@@ -0,0 +1,96 @@
+/**
+ * @file    LogRing.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+
+#include "llbc/core/log/LogRing.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_LogRing::LLBC_LogRing(uint32 capacity)
+: _records(LLBC_Malloc(LLBC_LogRecord, sizeof(LLBC_LogRecord) * capacity))
+, _mask(capacity - 1)
+
+, _writePos(0)
+, _cachedReadPos(0)
+
+, _readPos(0)
+, _cachedWritePos(0)
+
+, _refCount(2)
+{
+}
+
+LLBC_LogRing::~LLBC_LogRing()
+{
+    LLBC_LogRecord *record;
+    while ((record = this->BeginRead()))
+    {
+        record->FreeHeapData();
+        this->EndRead();
+    }
+
+    LLBC_XFree(_records);
+}
+
+LLBC_LogRecord *LLBC_LogRing::BeginWrite()
+{
+    // Only reload consumer read position when seems ring full.
+    if (static_cast<uint32>(_writePos - _cachedReadPos) > _mask)
+    {
+        _cachedReadPos = LLBC_AtomicGet(&_readPos);
+        if (static_cast<uint32>(_writePos - _cachedReadPos) > _mask)
+            return NULL;
+    }
+
+    return &_records[_writePos & _mask];
+}
+
+void LLBC_LogRing::EndWrite()
+{
+    // Full memory barrier, make sure record data visible before write position.
+    LLBC_AtomicFetchAndAdd(&_writePos, 1);
+}
+
+LLBC_LogRecord *LLBC_LogRing::BeginRead()
+{
+    // Only reload producer write position when seems ring empty.
+    if (_readPos == _cachedWritePos)
+    {
+        _cachedWritePos = LLBC_AtomicGet(&_writePos);
+        if (_readPos == _cachedWritePos)
+            return NULL;
+    }
+
+    return &_records[_readPos & _mask];
+}
+
+void LLBC_LogRing::EndRead()
+{
+    LLBC_AtomicFetchAndAdd(&_readPos, 1);
+}
+
+void LLBC_LogRing::Release()
+{
+    // Full memory barrier, producer's published records visible to consumer when consumer found producer released.
+    if (LLBC_AtomicFetchAndSub(&_refCount, 1) == 1)
+        delete this;
+}
+
+bool LLBC_LogRing::IsPeerReleased() const
+{
+    return _refCount == 1;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
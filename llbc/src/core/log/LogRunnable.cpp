@@ -10,23 +10,43 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/os/OS_Atomic.h"
+
 #include "llbc/core/thread/MessageBlock.h"
 
 #include "llbc/core/log/LogData.h"
+#include "llbc/core/log/LogRing.h"
 #include "llbc/core/log/ILogAppender.h"
 #include "llbc/core/log/LogAppenderBuilder.h"
 #include "llbc/core/log/LogRunnable.h"
 
+__LLBC_INTERNAL_NS_BEGIN
+
+// The log runnable Id generator, Id never reuse, make sure thread ring slots never match destroyed runnable.
+static volatile LLBC_NS sint32 __g_maxLogRunnableId = 0;
+
+__LLBC_INTERNAL_NS_END
+
 __LLBC_NS_BEGIN
 
 LLBC_LogRunnable::LLBC_LogRunnable()
 : _stoped(false)
 , _head(NULL)
+
+, _id(static_cast<uint32>(LLBC_AtomicFetchAndAdd(&LLBC_INL_NS __g_maxLogRunnableId, 1) + 1))
+, _ringsLock()
+, _rings()
+, _drainingRings()
+
+, _idle(0)
+, _idleWaitTime(LLBC_CFG_LOG_RUNNABLE_IDLE_WAIT_TIME)
+, _wakeupSem()
 {
 }
 
 LLBC_LogRunnable::~LLBC_LogRunnable()
 {
+    this->ReleaseRings();
 }
 
 void LLBC_LogRunnable::Cleanup()
@@ -40,36 +60,41 @@ void LLBC_LogRunnable::Cleanup()
         delete appender;
     }
 
-    // Delete all not process's message blocks.
-    LLBC_LogData *logData = NULL;
+    // Release all rings(producer threads found ring released will not use it again), delete not process's message blocks.
+    this->ReleaseRings();
+
+    LLBC_LogRecord *record = NULL;
     LLBC_MessageBlock *block = NULL;
 
     while (this->TryPop(block) == LLBC_RTN_OK)
     {
-        block->Read(&logData, sizeof(LLBC_LogData *));
-        this->FreeLogData(logData);
+        block->Read(&record, sizeof(LLBC_LogRecord *));
+        this->FreeLogRecord(record);
         delete block;
     }
 }
 
 void LLBC_LogRunnable::Svc()
 {
-    LLBC_LogData *logData = NULL;
-    LLBC_MessageBlock *block = NULL;
     while (LIKELY(!_stoped))
     {
-        if (this->TimedPop(block, 20) != LLBC_RTN_OK)
-        {
+        if (this->Drain(LLBC_CFG_LOG_RING_DRAIN_BATCH_SIZE) > 0)
             continue;
-        }
 
-        block->Read(&logData, sizeof(LLBC_LogData *));
+        // All log records output, flush appenders before idle.
+        this->FlushAppenders();
 
-        this->Output(logData);
+        // Mark idle, then re-check, avoid lost the log records which pushed before marked.
+        LLBC_AtomicSet(&_idle, 1);
+        if (this->Drain(LLBC_CFG_LOG_RING_DRAIN_BATCH_SIZE) == 0)
+            _wakeupSem.TimedWait(_idleWaitTime);
 
-        this->FreeLogData(logData);
-        delete block;
+        LLBC_AtomicSet(&_idle, 0);
     }
+
+    // Output all remaining log records before exit.
+    while (this->Drain(static_cast<size_t>(-1)) > 0);
+    this->FlushAppenders();
 }
 
 void LLBC_LogRunnable::AddAppender(LLBC_ILogAppender *appender)
@@ -111,17 +136,169 @@ int LLBC_LogRunnable::Output(LLBC_LogData *data)
     return LLBC_RTN_OK;
 }
 
+void LLBC_LogRunnable::SetIdleWaitTime(int idleWaitTime)
+{
+    _idleWaitTime = MAX(1, idleWaitTime);
+}
+
 void LLBC_LogRunnable::Stop()
 {
     _stoped = true;
+    _wakeupSem.Post();
 }
 
-void LLBC_LogRunnable::FreeLogData(LLBC_LogData *data)
+LLBC_LogRing *LLBC_LogRunnable::GetThreadRing()
 {
-    LLBC_XFree(data->msg);
-    LLBC_XFree(data->others);
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+    void **rings = tls->coreTls.logRings;
+    uint32 *owners = tls->coreTls.logRingOwners;
+
+    int freeSlot = -1;
+    for (int i = 0; i < LLBC_CFG_LOG_PER_THREAD_MAX_RING_COUNT; i++)
+    {
+        LLBC_LogRing *ring = reinterpret_cast<LLBC_LogRing *>(rings[i]);
+        if (ring && ring->IsPeerReleased())
+        {
+            // Owner runnable cleaned up or destroyed, release the ring and reuse the slot.
+            ring->Release();
+
+            rings[i] = NULL;
+            owners[i] = 0;
+        }
+        else if (owners[i] == _id)
+        {
+            return ring;
+        }
+
+        if (owners[i] == 0 && freeSlot == -1)
+            freeSlot = i;
+    }
+
+    if (freeSlot == -1)
+        return NULL;
+
+    LLBC_LogRing *ring = LLBC_New1(LLBC_LogRing, LLBC_CFG_LOG_RING_RECORD_COUNT);
+
+    _ringsLock.Lock();
+    _rings.push_back(ring);
+    _ringsLock.Unlock();
+
+    rings[freeSlot] = ring;
+    owners[freeSlot] = _id;
+
+    return ring;
+}
+
+void LLBC_LogRunnable::ReleaseThreadRings()
+{
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+    void **rings = tls->coreTls.logRings;
+    uint32 *owners = tls->coreTls.logRingOwners;
+
+    for (int i = 0; i < LLBC_CFG_LOG_PER_THREAD_MAX_RING_COUNT; i++)
+    {
+        if (rings[i])
+        {
+            reinterpret_cast<LLBC_LogRing *>(rings[i])->Release();
+
+            rings[i] = NULL;
+            owners[i] = 0;
+        }
+    }
+}
+
+void LLBC_LogRunnable::Wakeup()
+{
+    if (_idle && LLBC_AtomicCompareAndExchange(&_idle, 0, 1) == 1)
+        _wakeupSem.Post();
+}
+
+void LLBC_LogRunnable::FreeLogRecord(LLBC_LogRecord *record)
+{
+    record->FreeHeapData();
+    LLBC_Free(record);
+}
+
+void LLBC_LogRunnable::ReleaseRings()
+{
+    _ringsLock.Lock();
+    for (size_t i = 0; i < _rings.size(); i++)
+        _rings[i]->Release();
+
+    _rings.clear();
+    _ringsLock.Unlock();
+}
+
+void LLBC_LogRunnable::FlushAppenders()
+{
+    for (LLBC_ILogAppender *appender = _head;
+         appender != NULL;
+         appender = appender->GetAppenderNext())
+        appender->Flush();
+}
+
+size_t LLBC_LogRunnable::Drain(size_t batchSize)
+{
+    size_t outputCount = 0;
+
+    // Copy rings out, producer threads create ring need not wait appenders output.
+    // Rings only released by this runnable, so it is safe to drain the copied rings without lock.
+    _ringsLock.Lock();
+    _drainingRings.assign(_rings.begin(), _rings.end());
+    _ringsLock.Unlock();
+
+    // Drain all threads' rings.
+    size_t releasedCount = 0;
+    for (size_t i = 0; i < _drainingRings.size(); i++)
+    {
+        LLBC_LogRing *ring = _drainingRings[i];
+
+        // Producer thread exited, no more records will be written, drain all and release the ring.
+        const bool producerReleased = ring->IsPeerReleased();
+        const size_t drainSize = producerReleased ? static_cast<size_t>(-1) : batchSize;
+
+        LLBC_LogRecord *record;
+        for (size_t j = 0; j < drainSize && (record = ring->BeginRead()); j++)
+        {
+            this->Output(&record->data);
+
+            record->FreeHeapData();
+            ring->EndRead();
+
+            ++ outputCount;
+        }
+
+        if (producerReleased)
+            _drainingRings[releasedCount++] = ring;
+    }
+
+    if (UNLIKELY(releasedCount > 0))
+    {
+        _ringsLock.Lock();
+        for (size_t i = 0; i < releasedCount; i++)
+            _rings.erase(std::find(_rings.begin(), _rings.end(), _drainingRings[i]));
+        _ringsLock.Unlock();
+
+        for (size_t i = 0; i < releasedCount; i++)
+            _drainingRings[i]->Release();
+    }
+
+    // Drain the records which pushed to message queue.
+    LLBC_LogRecord *record = NULL;
+    LLBC_MessageBlock *block = NULL;
+    for (size_t i = 0; i < batchSize && this->TryPop(block) == LLBC_RTN_OK; i++)
+    {
+        block->Read(&record, sizeof(LLBC_LogRecord *));
+
+        this->Output(&record->data);
+
+        this->FreeLogRecord(record);
+        delete block;
+
+        ++ outputCount;
+    }
 
-    delete data;
+    return outputCount;
 }
 
 __LLBC_NS_END
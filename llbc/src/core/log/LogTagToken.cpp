@@ -39,7 +39,7 @@ void LLBC_LogTagToken::Format(const LLBC_LogData &data, LLBC_String &formattedDa
 {
     int index = static_cast<int>(formattedData.size());
     if (data.tagLen)
-        formattedData.append(data.others + data.tagBeg, data.tagLen);
+        formattedData.append(data.tag, data.tagLen);
 
     LLBC_LogFormattingInfo *formatter = this->GetFormatter();
     formatter->Format(formattedData, index);
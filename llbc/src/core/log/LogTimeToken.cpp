@@ -19,6 +19,7 @@
 __LLBC_NS_BEGIN
 
 LLBC_LogTimeToken::LLBC_LogTimeToken()
+: _precision(0)
 {
 }
 
@@ -29,6 +30,14 @@ LLBC_LogTimeToken::~LLBC_LogTimeToken()
 int LLBC_LogTimeToken::Initialize(LLBC_LogFormattingInfo *formatter, const LLBC_String &str)
 {
     this->SetFormatter(formatter);
+
+    if (str == "ms")
+        _precision = 3;
+    else if (str == "us")
+        _precision = 6;
+    else
+        _precision = 0;
+
     return LLBC_RTN_OK;
 }
 
@@ -39,9 +48,36 @@ int LLBC_LogTimeToken::GetType() const
 
 void LLBC_LogTimeToken::Format(const LLBC_LogData &data, LLBC_String &formattedData) const
 {
-    LLBC_Time logTime(data.logTime);
+    // Only re-format second part when log time second changed, cache in TLS,
+    // loggers can format in multiple threads without lock.
+    __LLBC_LibTls *tls = __LLBC_GetLibTls();
+    if (data.logTime != tls->coreTls.logCachedTime)
+    {
+        const LLBC_String timeStr = LLBC_Time(data.logTime).Format();
+        tls->coreTls.logCachedTimeLen = MIN(timeStr.size(), sizeof(tls->coreTls.logCachedTimeStr));
+        memcpy(tls->coreTls.logCachedTimeStr, timeStr.data(), tls->coreTls.logCachedTimeLen);
+
+        tls->coreTls.logCachedTime = data.logTime;
+    }
+
     int index = static_cast<int>(formattedData.size());
-    formattedData.append(logTime.Format());
+    formattedData.append(tls->coreTls.logCachedTimeStr, tls->coreTls.logCachedTimeLen);
+
+    // Patch in sub-second digits.
+    if (_precision > 0)
+    {
+        char subSecStr[8];
+        uint32 subSec = _precision == 3 ? data.logTimeUs / 1000 : data.logTimeUs;
+
+        subSecStr[0] = '.';
+        for (int i = _precision; i > 0; i--)
+        {
+            subSecStr[i] = static_cast<char>('0' + subSec % 10);
+            subSec /= 10;
+        }
+
+        formattedData.append(subSecStr, _precision + 1);
+    }
 
     LLBC_LogFormattingInfo *formatter = this->GetFormatter();
     formatter->Format(formattedData, index);
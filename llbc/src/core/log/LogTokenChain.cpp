@@ -62,6 +62,7 @@ int LLBC_LogTokenChain::Build(const LLBC_String &pattern)
     LLBC_LogFormattingInfo *formatter = NULL;
 
     LLBC_String buf;
+    LLBC_String option;
     if (pattern.empty())
     {
         curPattern = LLBC_INTERNAL_NS __g_default_pattern;
@@ -132,7 +133,21 @@ int LLBC_LogTokenChain::Build(const LLBC_String &pattern)
                 formatter = new LLBC_LogFormattingInfo;
             }
 
-            token->Initialize(formatter, "");
+            // Time token support precision option, like: %T{ms}.
+            option.clear();
+            if (ch == LLBC_LogTokenType::TimeToken &&
+                i < patternLength && curPattern[i] == '{')
+            {
+                const char *optEnd = reinterpret_cast<const char *>(
+                    ::memchr(curPattern + i, '}', patternLength - i));
+                if (optEnd)
+                {
+                    option.assign(curPattern + i + 1, optEnd - curPattern - i - 1);
+                    i = optEnd - curPattern + 1;
+                }
+            }
+
+            token->Initialize(formatter, option);
             this->AppendToken(token);
 
             formatter = NULL;
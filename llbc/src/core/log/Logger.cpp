@@ -12,6 +12,7 @@
 
 #include "llbc/core/utils/Util_Text.h"
 
+#include "llbc/core/os/OS_Time.h"
 #include "llbc/core/os/OS_Thread.h"
 
 #include "llbc/core/time/Time.h"
@@ -21,6 +22,7 @@
 
 #include "llbc/core/log/LogLevel.h"
 #include "llbc/core/log/LogData.h"
+#include "llbc/core/log/LogRing.h"
 #include "llbc/core/log/LoggerConfigInfo.h"
 #include "llbc/core/log/ILogAppender.h"
 #include "llbc/core/log/LogAppenderBuilder.h"
@@ -31,6 +33,10 @@
 #pragma warning(disable:4996)
 #endif
 
+#ifndef va_copy
+ #define va_copy(dst, src) ((dst) = (src))
+#endif
+
 __LLBC_INTERNAL_NS_BEGIN
 
 static const LLBC_NS LLBC_String __g_invalidLoggerName;
@@ -99,6 +105,8 @@ int LLBC_Logger::Initialize(const LLBC_String &name, const LLBC_LoggerConfigInfo
         appenderInitInfo.dailyRolling = _config->IsDailyRollingMode();
         appenderInitInfo.maxFileSize = _config->GetMaxFileSize();
         appenderInitInfo.maxBackupIndex = _config->GetMaxBackupIndex();
+        appenderInitInfo.flushInterval = _config->GetFileFlushInterval();
+        appenderInitInfo.bufferSize = _config->GetFileBufferSize();
 
         LLBC_ILogAppender *appender =
             LLBC_LogAppenderBuilderSingleton->BuildAppender(LLBC_LogAppenderType::File);
@@ -111,8 +119,17 @@ int LLBC_Logger::Initialize(const LLBC_String &name, const LLBC_LoggerConfigInfo
         _logRunnable->AddAppender(appender);
     }
 
+    // Asynchronous mode, runnable output all log records. Synchronous mode with file flush interval,
+    // runnable only flush file buffered logs every interval, avoid last logs unflushed when logger idle.
     if (_config->IsAsyncMode())
+    {
+        _logRunnable->Activate(1);
+    }
+    else if (_config->IsLogToFile() && _config->GetFileFlushInterval() > 0)
+    {
+        _logRunnable->SetIdleWaitTime(_config->GetFileFlushInterval());
         _logRunnable->Activate(1);
+    }
 
     return LLBC_RTN_OK;
 }
@@ -131,7 +148,7 @@ void LLBC_Logger::Finalize()
     if (!_logRunnable)
         return;
 
-    if (_config->IsAsyncMode())
+    if (_logRunnable->GetThreadCount() > 0)
     {
         _logRunnable->Stop();
         _logRunnable->Wait();
@@ -184,10 +201,12 @@ int LLBC_Logger::Debug(const char *tag, const char *file, int line, const char *
     if (LLBC_LogLevel::Debug < _logLevel)
         return LLBC_RTN_OK;
 
-    char *fmttedMsg; int msgLen;
-    LLBC_FormatArg(message, fmttedMsg, msgLen);
+    va_list ap;
+    va_start(ap, message);
+    const int ret = this->DirectOutput(LLBC_LogLevel::Debug, tag, file, line, message, ap);
+    va_end(ap);
 
-    return this->DirectOutput(LLBC_LogLevel::Debug, tag, file, line, fmttedMsg, msgLen);
+    return ret;
 }
 
 int LLBC_Logger::Info(const char *tag, const char *file, int line, const char *message, ...)
@@ -195,10 +214,12 @@ int LLBC_Logger::Info(const char *tag, const char *file, int line, const char *m
     if (LLBC_LogLevel::Info < _logLevel)
         return LLBC_RTN_OK;
 
-    char *fmttedMsg; int msgLen;
-    LLBC_FormatArg(message, fmttedMsg, msgLen);
+    va_list ap;
+    va_start(ap, message);
+    const int ret = this->DirectOutput(LLBC_LogLevel::Info, tag, file, line, message, ap);
+    va_end(ap);
 
-    return this->DirectOutput(LLBC_LogLevel::Info, tag, file, line, fmttedMsg, msgLen);
+    return ret;
 }
 
 int LLBC_Logger::Warn(const char *tag, const char *file, int line, const char *message, ...)
@@ -206,10 +227,12 @@ int LLBC_Logger::Warn(const char *tag, const char *file, int line, const char *m
     if (LLBC_LogLevel::Warn < _logLevel)
         return LLBC_RTN_OK;
 
-    char *fmttedMsg; int msgLen;
-    LLBC_FormatArg(message, fmttedMsg, msgLen);
+    va_list ap;
+    va_start(ap, message);
+    const int ret = this->DirectOutput(LLBC_LogLevel::Warn, tag, file, line, message, ap);
+    va_end(ap);
 
-    return this->DirectOutput(LLBC_LogLevel::Warn, tag, file, line, fmttedMsg, msgLen);
+    return ret;
 }
 
 int LLBC_Logger::Error(const char *tag, const char *file, int line, const char *message, ...)
@@ -217,10 +240,12 @@ int LLBC_Logger::Error(const char *tag, const char *file, int line, const char *
     if (LLBC_LogLevel::Error < _logLevel)
         return LLBC_RTN_OK;
 
-    char *fmttedMsg; int msgLen;
-    LLBC_FormatArg(message, fmttedMsg, msgLen);
+    va_list ap;
+    va_start(ap, message);
+    const int ret = this->DirectOutput(LLBC_LogLevel::Error, tag, file, line, message, ap);
+    va_end(ap);
 
-    return this->DirectOutput(LLBC_LogLevel::Error, tag, file, line, fmttedMsg, msgLen);
+    return ret;
 }
 
 int LLBC_Logger::Fatal(const char *tag, const char *file, int line, const char *message, ...)
@@ -228,10 +253,12 @@ int LLBC_Logger::Fatal(const char *tag, const char *file, int line, const char *
     if (LLBC_LogLevel::Fatal < _logLevel)
         return LLBC_RTN_OK;
 
-    char *fmttedMsg; int msgLen;
-    LLBC_FormatArg(message, fmttedMsg, msgLen);
+    va_list ap;
+    va_start(ap, message);
+    const int ret = this->DirectOutput(LLBC_LogLevel::Fatal, tag, file, line, message, ap);
+    va_end(ap);
 
-    return this->DirectOutput(LLBC_LogLevel::Fatal, tag, file, line, fmttedMsg, msgLen);
+    return ret;
 }
 
 int LLBC_Logger::Output(int level, const char *tag, const char *file, int line, const char *message, ...) 
@@ -239,74 +266,144 @@ int LLBC_Logger::Output(int level, const char *tag, const char *file, int line,
     if (level < _logLevel)
         return LLBC_RTN_OK;
 
-    char *fmttedMsg; int msgLen;
-    LLBC_FormatArg(message, fmttedMsg, msgLen);
+    va_list ap;
+    va_start(ap, message);
+    const int ret = this->DirectOutput(level, tag, file, line, message, ap);
+    va_end(ap);
 
-    return this->DirectOutput(level, tag, file, line, fmttedMsg, msgLen);
+    return ret;
 }
 
-int LLBC_Logger::DirectOutput(int level, const char *tag, const char *file, int line, char *message, int len) 
+int LLBC_Logger::DirectOutput(int level, const char *tag, const char *file, int line, const char *message, va_list ap) 
 {
-    LLBC_LogData *data = this->BuildLogData(level, tag, file, line, message, len);
+    // Synchronous mode, use stack record, direct output.
     if (!_config->IsAsyncMode())
     {
-        const int ret = _logRunnable->Output(data);
-        LLBC_LogRunnable::FreeLogData(data);
+        LLBC_LogRecord record;
+        this->FillLogRecord(&record, level, tag, file, line, message, ap);
+
+        const int ret = _logRunnable->Output(&record.data);
+        record.FreeHeapData();
 
         return ret;
     }
 
-    LLBC_MessageBlock *block = new LLBC_MessageBlock;
-    block->Write(&data, sizeof(LLBC_LogData));
+    // Asynchronous mode, use current thread's record ring, if ring full, wait log runnable drain.
+    LLBC_LogRing *ring = _logRunnable->GetThreadRing();
+    if (LIKELY(ring))
+    {
+        LLBC_LogRecord *record;
+        for (int waitTimes = 0; UNLIKELY(!(record = ring->BeginWrite())); waitTimes++)
+        {
+            // Yield a few times first, if runnable still busy, sleep to give up cpu.
+            _logRunnable->Wakeup();
+            LLBC_Sleep(waitTimes < LLBC_CFG_LOG_RING_FULL_YIELD_TIMES ? 0 : 1);
+        }
+
+        this->FillLogRecord(record, level, tag, file, line, message, ap);
+        ring->EndWrite();
+
+        _logRunnable->Wakeup();
+
+        return LLBC_RTN_OK;
+    }
+
+    // Current thread rings count reach limit, fallback to message queue.
+    LLBC_LogRecord *record = LLBC_Malloc(LLBC_LogRecord, sizeof(LLBC_LogRecord));
+    this->FillLogRecord(record, level, tag, file, line, message, ap);
+
+    LLBC_MessageBlock *block = new LLBC_MessageBlock(sizeof(LLBC_LogRecord *));
+    block->Write(&record, sizeof(LLBC_LogRecord *));
 
     _logRunnable->Push(block);
+    _logRunnable->Wakeup();
 
     return LLBC_RTN_OK;
 }
 
-LLBC_LogData *LLBC_Logger::BuildLogData(int level,
-                                        const char *tag,
-                                        const char *file,
-                                        int line,
-                                        char *message,
-                                        int len)
+void LLBC_Logger::FillLogRecord(LLBC_LogRecord *record,
+                                int level,
+                                const char *tag,
+                                const char *file,
+                                int line,
+                                const char *message,
+                                va_list ap)
 {
-    LLBC_LogData *data = new LLBC_LogData;
-    
-    data->level = level;
-    data->loggerName = _name.c_str();
+    LLBC_LogData &data = record->data;
 
-    data->tagLen = tag ? LLBC_StrLenA(tag) : 0;
-    data->fileLen = file ? LLBC_StrLenA(file) : 0;
+    data.level = level;
+    data.loggerName = _name.c_str();
 
-    data->tagBeg = 0;
-    data->fileBeg = data->tagLen;
+    // Tag and file name maybe not static string, copy them to record buffer, if too long, copy to heap.
+    const size_t bufSize = sizeof(record->buf);
+    data.tagLen = tag ? LLBC_StrLenA(tag) : 0;
+    data.fileLen = file ? LLBC_StrLenA(file) : 0;
 
-    const uint32 othersSize = data->tagLen + data->fileLen;
-    if (othersSize == 0)
-    {
-        data->others = NULL;
-    }
-    else
-    {
-        data->others = LLBC_Malloc(char, othersSize);
-        if (tag)
-            memcpy(data->others + data->tagBeg, tag, data->tagLen);
-        if (file)
-            memcpy(data->others + data->fileBeg, file, data->fileLen);
-    }
+    char *othersBuf = record->buf;
+    const size_t othersLen = data.tagLen + data.fileLen;
+    record->heapOthers = NULL;
+    if (UNLIKELY(othersLen > bufSize))
+        othersBuf = record->heapOthers = LLBC_Malloc(char, othersLen);
 
-    data->logTime = LLBC_Time::GetCurrentTime().GetLocalTime();
+    if (data.tagLen > 0)
+        memcpy(othersBuf, tag, data.tagLen);
+    if (data.fileLen > 0)
+        memcpy(othersBuf + data.tagLen, file, data.fileLen);
 
-    data->line = line;
+    data.tag = othersBuf;
+    data.file = othersBuf + data.tagLen;
+    data.line = line;
 
-    data->msg = message;
-    data->msgLen = len;
+    // Fetch second and micro-second part at once, second part keep local time semantic.
+    struct timeval tv;
+    LLBC_GetTimeOfDay(&tv, NULL);
+    data.logTime = static_cast<time_t>(tv.tv_sec) - LLBC_GetTimezone();
+    data.logTimeUs = static_cast<uint32>(tv.tv_usec);
 
     __LLBC_LibTls *tls = __LLBC_GetLibTls();
-    data->threadHandle = tls->coreTls.nativeThreadHandle;
+    data.threadHandle = tls->coreTls.nativeThreadHandle;
+
+    // Format message to record buffer, if too long, format again to heap.
+    record->heapMsg = NULL;
+    const size_t othersBufLen = record->heapOthers ? 0 : othersLen;
+    char *msgBuf = record->buf + othersBufLen;
+    const size_t msgBufSize = bufSize - othersBufLen;
+    if (UNLIKELY(!message))
+    {
+        data.msg = msgBuf;
+        data.msgLen = 0;
+
+        return;
+    }
+
+    va_list apCopy;
+    va_copy(apCopy, ap);
+#if LLBC_TARGET_PLATFORM_WIN32
+    int msgLen = ::_vscprintf(message, apCopy);
+    if (msgLen >= 0 && static_cast<size_t>(msgLen) < msgBufSize)
+        ::vsnprintf_s(msgBuf, msgBufSize, _TRUNCATE, message, ap);
+#else
+    int msgLen = ::vsnprintf(msgBuf, msgBufSize, message, apCopy);
+#endif
+    va_end(apCopy);
+
+    if (UNLIKELY(msgLen < 0))
+    {
+        msgLen = 0;
+    }
+    else if (UNLIKELY(static_cast<size_t>(msgLen) >= msgBufSize))
+    {
+        record->heapMsg = LLBC_Malloc(char, msgLen + 1);
+#if LLBC_TARGET_PLATFORM_WIN32
+        ::vsnprintf_s(record->heapMsg, msgLen + 1, _TRUNCATE, message, ap);
+#else
+        ::vsnprintf(record->heapMsg, msgLen + 1, message, ap);
+#endif
+        msgBuf = record->heapMsg;
+    }
 
-    return data;
+    data.msg = msgBuf;
+    data.msgLen = static_cast<uint32>(msgLen);
 }
 
 __LLBC_NS_END
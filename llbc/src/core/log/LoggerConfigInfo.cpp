@@ -33,6 +33,8 @@ LLBC_LoggerConfigInfo::LLBC_LoggerConfigInfo()
 , _dailyMode(true)
 , _maxFileSize(INT_MAX)
 , _maxBackupIndex(0)
+, _fileFlushInterval(LLBC_CFG_LOG_DEFAULT_SYNC_FILE_FLUSH_INTERVAL)
+, _fileBufferSize(LLBC_CFG_LOG_DEFAULT_FILE_BUFFER_SIZE)
 {
 }
 
@@ -58,6 +60,9 @@ int LLBC_LoggerConfigInfo::Initialize(const LLBC_Property &cfg)
     _dailyMode = (cfg.HasProperty("dailyRollingMode") ? cfg.GetValue("dailyRollingMode").AsBool() : LLBC_CFG_LOG_DEFAULT_DAILY_MODE);
     _maxFileSize = (cfg.HasProperty("maxFileSize") ? cfg.GetValue("maxFileSize").AsLong() : LLBC_CFG_LOG_DEFAULT_MAX_FILE_SIZE);
     _maxBackupIndex = (cfg.HasProperty("maxBackupIndex") ? cfg.GetValue("maxBackupIndex").AsInt32() : LLBC_CFG_LOG_DEFAULT_MAX_BACKUP_INDEX);
+    _fileFlushInterval = (cfg.HasProperty("fileFlushInterval") ? cfg.GetValue("fileFlushInterval").AsInt32() :
+        (_asyncMode ? LLBC_CFG_LOG_DEFAULT_ASYNC_FILE_FLUSH_INTERVAL : LLBC_CFG_LOG_DEFAULT_SYNC_FILE_FLUSH_INTERVAL));
+    _fileBufferSize = (cfg.HasProperty("fileBufferSize") ? cfg.GetValue("fileBufferSize").AsInt32() : LLBC_CFG_LOG_DEFAULT_FILE_BUFFER_SIZE);
 
 	// Check configs.
 	if (!(_logLevel >= LLBC_LogLevel::Begin && _logLevel < LLBC_LogLevel::End))
@@ -65,6 +70,8 @@ int LLBC_LoggerConfigInfo::Initialize(const LLBC_Property &cfg)
 
     _maxFileSize = MAX(1, _maxFileSize);
     _maxBackupIndex = MAX(0, _maxBackupIndex);
+    _fileFlushInterval = MAX(0, _fileFlushInterval);
+    _fileBufferSize = MAX(0, _fileBufferSize);
     
 #if LLBC_TARGET_PLATFORM_IPHONE
     if (_logToFile && !_logFile.empty() && _logFile[0] != LLBC_SLASH_A)
@@ -129,6 +136,16 @@ int LLBC_LoggerConfigInfo::GetMaxBackupIndex() const
     return _maxBackupIndex;
 }
 
+int LLBC_LoggerConfigInfo::GetFileFlushInterval() const
+{
+    return _fileFlushInterval;
+}
+
+int LLBC_LoggerConfigInfo::GetFileBufferSize() const
+{
+    return _fileBufferSize;
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
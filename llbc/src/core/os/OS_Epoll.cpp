@@ -61,6 +61,61 @@ int LLBC_EpollClose(LLBC_Handle epfd)
     return LLBC_RTN_OK;
 }
 
+LLBC_Handle LLBC_CreateEventFd()
+{
+    LLBC_Handle efd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (efd == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_INVALID_HANDLE;
+    }
+
+    return efd;
+}
+
+int LLBC_SignalEventFd(LLBC_Handle efd)
+{
+    const uint64 val = 1;
+    int ret;
+    while ((ret = ::write(efd, &val, sizeof(uint64))) < 0 && errno == EINTR);
+
+    // If eventfd counter overflow(EAGAIN), eventfd still readable, treat as success.
+    if (ret < 0 && errno != EAGAIN)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_ResetEventFd(LLBC_Handle efd)
+{
+    uint64 val;
+    int ret;
+    while ((ret = ::read(efd, &val, sizeof(uint64))) < 0 && errno == EINTR);
+
+    // Nonblocking eventfd, EAGAIN means counter already zero.
+    if (ret < 0 && errno != EAGAIN)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_CloseEventFd(LLBC_Handle efd)
+{
+    if (::close(efd) != 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
+
 #endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
 
 __LLBC_NS_END
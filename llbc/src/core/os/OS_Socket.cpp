@@ -20,6 +20,63 @@ static LPFN_CONNECTEX __g_ConnectExProc = NULL;
 static LPFN_GETACCEPTEXSOCKADDRS __g_GetAcceptExSockAddrs = NULL;
 #endif // LLBC_TARGET_PLATFORM_WIN32
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+static int __BuildUnixAddr(const char *path, struct sockaddr_un &addr, LLBC_NS LLBC_SocketLen &len)
+{
+    const size_t pathLen = path ? strlen(path) : 0;
+    if (pathLen == 0)
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+    }
+    else if (pathLen >= sizeof(addr.sun_path))
+    {
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_RTN_FAILED;
+    }
+
+    memset(&addr, 0, sizeof(struct sockaddr_un));
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path, pathLen);
+
+    // Abstract namespace address: sun_path[0] is '\0', address length not include the trailing zero.
+    if (path[0] == '@')
+    {
+#if LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+        addr.sun_path[0] = '\0';
+        len = static_cast<LLBC_NS LLBC_SocketLen>(sizeof(addr.sun_family) + pathLen);
+#else // Non-LINUX && Non-ANDROID
+        LLBC_NS LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+#endif // LLBC_TARGET_PLATFORM_LINUX || LLBC_TARGET_PLATFORM_ANDROID
+    }
+    else
+    {
+        len = static_cast<LLBC_NS LLBC_SocketLen>(sizeof(struct sockaddr_un));
+    }
+
+    return LLBC_RTN_OK;
+}
+
+static bool __IsStaleUnixAddr(const struct sockaddr_un &addr, LLBC_NS LLBC_SocketLen len)
+{
+    // Probe with non-blocking connect, only connection refused means nobody listening on it.
+    const int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe == -1)
+        return false;
+
+    const int flags = ::fcntl(probe, F_GETFL);
+    if (flags != -1)
+        ::fcntl(probe, F_SETFL, flags | O_NONBLOCK);
+
+    const bool stale =
+        ::connect(probe, reinterpret_cast<const struct sockaddr *>(&addr), len) == -1 && errno == ECONNREFUSED;
+    ::close(probe);
+
+    return stale;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 __LLBC_INTERNAL_NS_END
 
 __LLBC_NS_BEGIN
@@ -160,6 +217,19 @@ LLBC_SocketHandle LLBC_CreateTcpSocketEx()
 #endif // LLBC_TARGET_PLATFORM_WIN32
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+LLBC_SocketHandle LLBC_CreateUnixSocket()
+{
+    LLBC_SocketHandle handle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (handle == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+    }
+
+    return handle;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 int LLBC_ShutdownSocketInput(LLBC_SocketHandle handle)
 {
     if (UNLIKELY(handle == LLBC_INVALID_SOCKET_HANDLE))
@@ -284,6 +354,32 @@ int LLBC_Send(LLBC_SocketHandle handle, const void *buf, int len, int flags)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+int LLBC_SendV(LLBC_SocketHandle handle, const LLBC_IoVec *iovs, int iovCount)
+{
+    ssize_t ret = 0;
+    while ((ret = ::writev(handle, iovs, iovCount)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+        {
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+            return LLBC_RTN_FAILED;
+        }
+        else if (errno == EAGAIN)
+        {
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+            return LLBC_RTN_FAILED;
+        }
+
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    return static_cast<int>(ret);
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 int LLBC_SendEx(LLBC_SocketHandle handle,
                 LLBC_SockBuf *buffers,
                 ulong bufferCount,
@@ -391,6 +487,128 @@ int LLBC_RecvEx(LLBC_SocketHandle handle,
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+int LLBC_SendWithFds(LLBC_SocketHandle handle, const void *buf, int len, const int *fds, int fdCount)
+{
+    if (UNLIKELY(!buf || len <= 0 || fdCount < 0 || (fdCount > 0 && !fds)))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+    }
+    else if (UNLIKELY(fdCount > LLBC_MAX_PASS_FDS))
+    {
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_RTN_FAILED;
+    }
+
+    struct iovec iov;
+    iov.iov_base = const_cast<void *>(buf);
+    iov.iov_len = static_cast<size_t>(len);
+
+    char ctrlBuf[CMSG_SPACE(sizeof(int) * LLBC_MAX_PASS_FDS)];
+    memset(ctrlBuf, 0, sizeof(ctrlBuf));
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(struct msghdr));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    if (fdCount > 0)
+    {
+        msg.msg_control = ctrlBuf;
+        msg.msg_controllen = CMSG_SPACE(sizeof(int) * fdCount);
+
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fdCount);
+        memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * fdCount);
+    }
+
+    ssize_t ret = 0;
+    while ((ret = ::sendmsg(handle, &msg, 0)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else if (errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    return static_cast<int>(ret);
+}
+
+int LLBC_RecvWithFds(LLBC_SocketHandle handle, void *buf, int len, int *fds, int &fdCount)
+{
+    if (UNLIKELY(!buf || len <= 0 || fdCount < 0 || (fdCount > 0 && !fds)))
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+    }
+
+    struct iovec iov;
+    iov.iov_base = buf;
+    iov.iov_len = static_cast<size_t>(len);
+
+    char ctrlBuf[CMSG_SPACE(sizeof(int) * LLBC_MAX_PASS_FDS)];
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(struct msghdr));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = ctrlBuf;
+    msg.msg_controllen = sizeof(ctrlBuf);
+
+    ssize_t ret = 0;
+    while ((ret = ::recvmsg(handle, &msg, 0)) < 0 && errno == EINTR);
+    if (ret == -1)
+    {
+        if (errno == EWOULDBLOCK)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else if (errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_AGAIN);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Collect received descriptors, the descriptors exceed caller's capacity will be closed.
+    int recvdCount = 0;
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+            continue;
+
+        const int *cmsgFds = reinterpret_cast<const int *>(CMSG_DATA(cmsg));
+        const int cmsgFdCount = static_cast<int>((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+        for (int i = 0; i < cmsgFdCount; i++)
+        {
+            if (recvdCount < fdCount)
+                fds[recvdCount++] = cmsgFds[i];
+            else
+                ::close(cmsgFds[i]);
+        }
+    }
+
+    fdCount = recvdCount;
+    if (msg.msg_flags & MSG_CTRUNC)
+    {
+        for (int i = 0; i < recvdCount; i++)
+            ::close(fds[i]);
+        fdCount = 0;
+
+        LLBC_SetLastError(LLBC_ERROR_LIMIT);
+        return LLBC_RTN_FAILED;
+    }
+
+    return static_cast<int>(ret);
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 int LLBC_CloseSocket(LLBC_SocketHandle handle)
 {
     if (UNLIKELY(handle == LLBC_INVALID_SOCKET_HANDLE))
@@ -490,6 +708,24 @@ int LLBC_EnableAddressReusable(LLBC_SocketHandle handle)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+int LLBC_EnablePortReusable(LLBC_SocketHandle handle)
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32 && defined(SO_REUSEPORT)
+    int reuse = 1;
+    if (::setsockopt(handle, SOL_SOCKET, 
+        SO_REUSEPORT, reinterpret_cast<const char *>(&reuse), sizeof(int))!= 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+#else // Not support SO_REUSEPORT
+    LLBC_SetLastError(LLBC_ERROR_NOT_IMPL);
+    return LLBC_RTN_FAILED;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32 && defined(SO_REUSEPORT)
+}
+
 int LLBC_DisableAddressReusable(LLBC_SocketHandle handle)
 {
     int reuse = 0;
@@ -665,6 +901,41 @@ int LLBC_BindToAddress(LLBC_SocketHandle handle, const char *ip, uint16 port)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+int LLBC_BindToUnixAddress(LLBC_SocketHandle handle, const char *path)
+{
+    struct sockaddr_un addr;
+    LLBC_SocketLen len;
+    if (LLBC_INTERNAL_NS __BuildUnixAddr(path, addr, len) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    // Remove the socket file which left by previous process, if it still listening by other process, not steal it.
+    struct stat st;
+    if (path[0] != '@' && ::stat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+    {
+        if (LLBC_INTERNAL_NS __IsStaleUnixAddr(addr, len))
+        {
+            ::unlink(path);
+        }
+        else
+        {
+            errno = EADDRINUSE;
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+            return LLBC_RTN_FAILED;
+        }
+    }
+
+    if (::bind(handle, reinterpret_cast<struct sockaddr *>(&addr), len) == -1)
+    {
+        LLBC_SetLastError(LLBC_ERROR_CLIB);
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 int LLBC_ListenForConnection(LLBC_SocketHandle handle, int backlog)
 {
     if (backlog <= 0)
@@ -823,6 +1094,28 @@ int LLBC_ConnectToPeer(LLBC_SocketHandle handle, const LLBC_SockAddr_IN &addr)
 #endif // LLBC_TARGET_PLATFORM_NON_WIN32
 }
 
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+int LLBC_ConnectToUnixPeer(LLBC_SocketHandle handle, const char *path)
+{
+    struct sockaddr_un addr;
+    LLBC_SocketLen len;
+    if (LLBC_INTERNAL_NS __BuildUnixAddr(path, addr, len) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (::connect(handle, reinterpret_cast<const struct sockaddr *>(&addr), len) == -1)
+    {
+        if (errno == EINPROGRESS || errno == EAGAIN)
+            LLBC_SetLastError(LLBC_ERROR_WBLOCK);
+        else
+            LLBC_SetLastError(LLBC_ERROR_CLIB);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
 int LLBC_ConnectToPeerEx(LLBC_SocketHandle handle,
                          const LLBC_SockAddr_IN &addr,
                          const void *sendBuf,
@@ -194,36 +194,22 @@ sint64 LLBC_IntervalSampler::GetSpeedInHours(int hours) const
 
 void LLBC_IntervalSampler::ShiftSpeedArray(sint64 *arr, int size, int diff)
 {
-    sint64 *tmpArr = new sint64[size - 1];
-    if(diff > 0)
+    // Shift in place, this method called per second, don't allocate temporary array.
+    const int absDiff = LLBC_Abs(diff);
+    if (absDiff >= size)
     {
-        if(diff < size)
-        {
-            memcpy(tmpArr, arr, (size - diff) * sizeof(sint64));
-            memcpy(&arr[diff], tmpArr, (size - diff) * sizeof(sint64));
-            memset(arr, 0, diff * sizeof(sint64));
-        }
-        else
-        {
-            memset(arr, 0, size * sizeof(sint64));
-        }
+        memset(arr, 0, size * sizeof(sint64));
+    }
+    else if (diff > 0)
+    {
+        memmove(&arr[diff], arr, (size - diff) * sizeof(sint64));
+        memset(arr, 0, diff * sizeof(sint64));
     }
     else
     {
-        int absDiff = LLBC_Abs(diff);
-        if(absDiff < size)
-        {
-            memcpy(tmpArr, &arr[absDiff], (size - diff) * sizeof(sint64));
-            memcpy(arr, tmpArr, (size - absDiff) * sizeof(sint64));
-            memset(&arr[size - absDiff], 0, absDiff * sizeof(sint64));
-        }
-        else
-        {
-            memset(arr, 0, size * sizeof(sint64));
-        }
+        memmove(arr, &arr[absDiff], (size - absDiff) * sizeof(sint64));
+        memset(&arr[size - absDiff], 0, absDiff * sizeof(sint64));
     }
-
-    delete []tmpArr;
 }
 
 __LLBC_NS_END
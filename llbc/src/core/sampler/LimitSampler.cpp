@@ -39,21 +39,26 @@ void LLBC_LimitSampler::Reset()
 
     _minValSamplingTime = 0;
     _maxValSamplingTime = 0;
+
+    _Base::Reset();
 }
 
 int LLBC_LimitSampler::Sampling(sint64 value, void *appData)
 {
+    // First sampling value is both min and max value.
+    const bool firstSampling = !this->IsBeginSampling();
     if (_Base::Sampling(value, appData) != LLBC_RTN_OK)
     {
         return LLBC_RTN_FAILED;
     }
 
-    if (value < _minVal)
+    if (firstSampling || value < _minVal)
     {
         _minVal = value;
         _minValSamplingTime = time(NULL);
     }
-    else if (value > _maxVal)
+
+    if (firstSampling || value > _maxVal)
     {
         _maxVal = value;
         _maxValSamplingTime = time(NULL);
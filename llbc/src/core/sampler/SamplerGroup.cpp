@@ -68,7 +68,7 @@ int LLBC_SamplerGroup::AddSampler(int type, const LLBC_String &name)
 
     _samplers->insert(std::make_pair(name, sampler));
 
-    return true;
+    return LLBC_RTN_OK;
 }
 
 void LLBC_SamplerGroup::Reset()
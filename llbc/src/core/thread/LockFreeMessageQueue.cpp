@@ -0,0 +1,166 @@
+/**
+ * @file    LockFreeMessageQueue.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Atomic.h"
+
+#include "llbc/core/thread/MessageBlock.h"
+#include "llbc/core/thread/LockFreeMessageQueue.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_LockFreeMessageQueue::LLBC_LockFreeMessageQueue()
+: _pushHead(NULL)
+, _popHead(NULL)
+
+, _size(0)
+, _waiting(0)
+{
+}
+
+LLBC_LockFreeMessageQueue::~LLBC_LockFreeMessageQueue()
+{
+    this->Cleanup();
+}
+
+ulong LLBC_LockFreeMessageQueue::GetSize() const
+{
+    return static_cast<ulong>(LLBC_AtomicGet(const_cast<volatile sint32 *>(&_size)));
+}
+
+void LLBC_LockFreeMessageQueue::Cleanup()
+{
+    LLBC_MessageBlock *block;
+    while (this->PopNonWait(block))
+        LLBC_Delete(block);
+}
+
+void LLBC_LockFreeMessageQueue::PushBack(LLBC_MessageBlock *block)
+{
+    // Increase size before link, make sure size never less than 0.
+    LLBC_AtomicFetchAndAdd(&_size, 1);
+
+    block->SetPrev(NULL);
+
+    LLBC_MessageBlock *head;
+    do
+    {
+        head = _pushHead;
+        block->SetNext(head);
+    } while (LLBC_AtomicCompareAndExchangePointer(
+        reinterpret_cast<void * volatile *>(&_pushHead), block, head) != head);
+
+    this->Wakeup();
+}
+
+bool LLBC_LockFreeMessageQueue::Pop(LLBC_MessageBlock *&block, int interval)
+{
+    if (this->PopNonWait(block))
+        return true;
+    else if (interval == 0)
+        return false;
+
+    if (interval == LLBC_INFINITE)
+    {
+        while (!this->PopNonWait(block))
+            this->Wait(LLBC_INFINITE);
+
+        return true;
+    }
+
+    this->Wait(interval);
+    return this->PopNonWait(block);
+}
+
+bool LLBC_LockFreeMessageQueue::PopNonWait(LLBC_MessageBlock *&block)
+{
+    if (!_popHead)
+    {
+        // Take over all pushed blocks, and reverse it to FIFO order.
+        LLBC_MessageBlock *stack = reinterpret_cast<LLBC_MessageBlock *>(
+            LLBC_AtomicExchangePointer(reinterpret_cast<void * volatile *>(&_pushHead), NULL));
+        if (!stack)
+            return false;
+
+        while (stack)
+        {
+            LLBC_MessageBlock *next = stack->GetNext();
+            stack->SetNext(_popHead);
+            _popHead = stack;
+
+            stack = next;
+        }
+    }
+
+    block = _popHead;
+    _popHead = block->GetNext();
+    block->SetNext(NULL);
+
+    LLBC_AtomicFetchAndSub(&_size, 1);
+
+    return true;
+}
+
+void LLBC_LockFreeMessageQueue::Wait(int interval)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Publish waiting flag(full barrier), then recheck queue, producer will
+    // see the flag or consumer will see the pushed block.
+    LLBC_AtomicCompareAndExchange(&_waiting, 1, 0);
+    if (!_pushHead)
+    {
+        struct timespec timeout;
+        struct timespec *timeoutPtr = NULL;
+        if (interval != LLBC_INFINITE)
+        {
+            timeout.tv_sec = interval / 1000;
+            timeout.tv_nsec = (interval % 1000) * 1000000;
+            timeoutPtr = &timeout;
+        }
+
+        ::syscall(SYS_futex, &_waiting, FUTEX_WAIT_PRIVATE, 1, timeoutPtr, NULL, 0);
+    }
+
+    LLBC_AtomicSet(&_waiting, 0);
+#else // Non-LLBC_TARGET_PLATFORM_LINUX
+    _lock.Lock();
+    LLBC_AtomicCompareAndExchange(&_waiting, 1, 0);
+    if (!_pushHead)
+    {
+        if (interval == LLBC_INFINITE)
+            _cond.Wait(_lock);
+        else
+            _cond.TimedWait(_lock, interval);
+    }
+
+    LLBC_AtomicSet(&_waiting, 0);
+    _lock.Unlock();
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+void LLBC_LockFreeMessageQueue::Wakeup()
+{
+    if (LIKELY(!_waiting))
+        return;
+
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (LLBC_AtomicCompareAndExchange(&_waiting, 0, 1) == 1)
+        ::syscall(SYS_futex, &_waiting, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else // Non-LLBC_TARGET_PLATFORM_LINUX
+    _lock.Lock();
+    _cond.Notify();
+    _lock.Unlock();
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
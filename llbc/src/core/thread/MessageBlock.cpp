@@ -10,6 +10,8 @@
 #include "llbc/common/Export.h"
 #include "llbc/common/BeforeIncl.h"
 
+#include "llbc/core/os/OS_Atomic.h"
+
 #include "llbc/core/thread/MessageBlock.h"
 
 namespace
@@ -21,6 +23,7 @@ __LLBC_NS_BEGIN
 
 LLBC_MessageBlock::LLBC_MessageBlock(size_t size)
 : _attach(false)
+, _sharedRefs(NULL)
 , _buf(NULL)
 , _size(size)
 , _readPos(0)
@@ -34,6 +37,7 @@ LLBC_MessageBlock::LLBC_MessageBlock(size_t size)
 
 LLBC_MessageBlock::LLBC_MessageBlock(void *buf, size_t size)
 : _attach(true)
+, _sharedRefs(NULL)
 , _buf(reinterpret_cast<char *>(buf))
 , _size(size)
 , _readPos(0)
@@ -45,7 +49,9 @@ LLBC_MessageBlock::LLBC_MessageBlock(void *buf, size_t size)
 
 LLBC_MessageBlock::~LLBC_MessageBlock()
 {
-    if (_buf && !_attach)
+    if (_sharedRefs)
+        this->ReleaseShared();
+    else if (_buf && !_attach)
         LLBC_Free(_buf);
 }
 
@@ -56,6 +62,11 @@ int LLBC_MessageBlock::Allocate(size_t size)
         LLBC_SetLastError(LLBC_ERROR_INVALID);
         return LLBC_RTN_FAILED;
     }
+    else if (UNLIKELY(_sharedRefs))
+    {
+        LLBC_SetLastError(LLBC_ERROR_PERM);
+        return LLBC_RTN_FAILED;
+    }
 
     this->Resize(_size + size);
 
@@ -90,6 +101,11 @@ int LLBC_MessageBlock::Write(const void *buf, size_t len)
     {
         return LLBC_RTN_OK;
     }
+    else if (UNLIKELY(_sharedRefs))
+    {
+        LLBC_SetLastError(LLBC_ERROR_PERM);
+        return LLBC_RTN_FAILED;
+    }
 
     if (_writePos + len > _size)
     {
@@ -106,7 +122,16 @@ int LLBC_MessageBlock::Write(const void *buf, size_t len)
 
 void LLBC_MessageBlock::Release()
 {
-    if (!_attach && _buf)
+    if (_sharedRefs)
+    {
+        this->ReleaseShared();
+        _buf = NULL;
+        _size = 0;
+
+        _readPos = 0;
+        _writePos = 0;
+    }
+    else if (!_attach && _buf)
     {
         LLBC_Free(_buf);
         _buf = NULL;
@@ -122,6 +147,11 @@ bool LLBC_MessageBlock::IsAttach() const
     return _attach;
 }
 
+bool LLBC_MessageBlock::IsShared() const
+{
+    return _sharedRefs != NULL;
+}
+
 void *LLBC_MessageBlock::GetData() const
 {
     return _buf;
@@ -222,6 +252,7 @@ int LLBC_MessageBlock::ShiftWritePos(long off)
 void LLBC_MessageBlock::Swap(LLBC_MessageBlock *another)
 {
     LLBC_Swap(_attach, another->_attach);
+    LLBC_Swap(_sharedRefs, another->_sharedRefs);
 
     LLBC_Swap(_buf, another->_buf);
     LLBC_Swap(_size, another->_size);
@@ -254,6 +285,27 @@ LLBC_MessageBlock *LLBC_MessageBlock::Clone() const
     return clone;
 }
 
+LLBC_MessageBlock *LLBC_MessageBlock::Share()
+{
+    // This block hold the first reference.
+    if (!_sharedRefs)
+    {
+        _sharedRefs = LLBC_Malloc(volatile sint32, sizeof(sint32));
+        *_sharedRefs = 1;
+    }
+
+    LLBC_AtomicFetchAndAdd(_sharedRefs, 1);
+
+    LLBC_MessageBlock *block = LLBC_New2(LLBC_MessageBlock, _buf, _size);
+    block->_attach = _attach;
+    block->_sharedRefs = _sharedRefs;
+
+    block->_readPos = _readPos;
+    block->_writePos = _writePos;
+
+    return block;
+}
+
 LLBC_MessageBlock *LLBC_MessageBlock::GetPrev() const
 {
     return _prev;
@@ -282,6 +334,18 @@ void LLBC_MessageBlock::Resize(size_t newSize)
     _size = newSize;
 }
 
+void LLBC_MessageBlock::ReleaseShared()
+{
+    if (LLBC_AtomicFetchAndSub(_sharedRefs, 1) == 1)
+    {
+        LLBC_Free(const_cast<sint32 *>(_sharedRefs));
+        if (_buf && !_attach)
+            LLBC_Free(_buf);
+    }
+
+    _sharedRefs = NULL;
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
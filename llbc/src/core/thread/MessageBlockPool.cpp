@@ -0,0 +1,123 @@
+/**
+ * @file    MessageBlockPool.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/thread/MessageBlock.h"
+#include "llbc/core/thread/MessageBlockPool.h"
+
+__LLBC_NS_BEGIN
+
+LLBC_MessageBlockPool::LLBC_MessageBlockPool(size_t blockSize, size_t maxIdle)
+: _blockSize(blockSize)
+, _maxIdle(maxIdle)
+
+, _idle(NULL)
+, _idleCount(0)
+
+, _acquireCount(0)
+, _allocCount(0)
+, _freeCount(0)
+{
+}
+
+LLBC_MessageBlockPool::~LLBC_MessageBlockPool()
+{
+    LLBC_MessageBlock *block;
+    while (_idle)
+    {
+        block = _idle;
+        _idle = _idle->GetNext();
+
+        LLBC_Delete(block);
+    }
+
+    _idleCount = 0;
+}
+
+LLBC_MessageBlock *LLBC_MessageBlockPool::Acquire()
+{
+    _acquireCount += 1;
+
+    LLBC_MessageBlock *block = _idle;
+    if (UNLIKELY(!block))
+    {
+        _allocCount += 1;
+        return LLBC_New1(LLBC_MessageBlock, _blockSize);
+    }
+
+    _idle = block->GetNext();
+    _idleCount -= 1;
+
+    block->SetNext(NULL);
+
+    return block;
+}
+
+void LLBC_MessageBlockPool::Release(LLBC_MessageBlock *block)
+{
+    // Only reuse pool size's blocks.
+    if (_idleCount >= _maxIdle || block->GetSize() != _blockSize)
+    {
+        _freeCount += 1;
+        LLBC_Delete(block);
+
+        return;
+    }
+
+    block->SetReadPos(0);
+    block->SetWritePos(0);
+    block->SetPrev(NULL);
+    block->SetNext(_idle);
+
+    _idle = block;
+    _idleCount += 1;
+}
+
+void LLBC_MessageBlockPool::ReleaseChain(LLBC_MessageBlock *head)
+{
+    LLBC_MessageBlock *block;
+    while (head)
+    {
+        block = head;
+        head = head->GetNext();
+
+        this->Release(block);
+    }
+}
+
+size_t LLBC_MessageBlockPool::GetBlockSize() const
+{
+    return _blockSize;
+}
+
+size_t LLBC_MessageBlockPool::GetIdleCount() const
+{
+    return _idleCount;
+}
+
+uint64 LLBC_MessageBlockPool::GetAcquireCount() const
+{
+    return _acquireCount;
+}
+
+uint64 LLBC_MessageBlockPool::GetAllocCount() const
+{
+    return _allocCount;
+}
+
+uint64 LLBC_MessageBlockPool::GetFreeCount() const
+{
+    return _freeCount;
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
@@ -17,6 +17,10 @@ __LLBC_NS_BEGIN
 
 LLBC_MessageBuffer::LLBC_MessageBuffer()
 : _head(NULL)
+, _tail(NULL)
+
+, _size(0)
+, _blockCount(0)
 {
 }
 
@@ -40,20 +44,16 @@ size_t LLBC_MessageBuffer::Read(void *buf, size_t len)
     }
 
     size_t needReadLen = len;
-    while (needReadLen > 0)
+    while (needReadLen > 0 && _head)
     {
         size_t availableSize = _head->GetWritePos() - _head->GetReadPos();
         if (availableSize >= needReadLen)
         {
             _head->Read(reinterpret_cast<char *>(buf) + (len - needReadLen), needReadLen);
-            _head->SetReadPos(_head->GetReadPos() + needReadLen);
+            _size -= needReadLen;
 
             if (availableSize == needReadLen)
-            {
-                LLBC_MessageBlock *block = _head;
-                _head = _head->GetNext();
-                delete block;
-            }
+                this->RemoveHead();
 
             needReadLen = 0;
             break;
@@ -61,10 +61,9 @@ size_t LLBC_MessageBuffer::Read(void *buf, size_t len)
 
         _head->Read(reinterpret_cast<char *>(buf) + (len - needReadLen), availableSize);
         needReadLen -= availableSize;
+        _size -= availableSize;
 
-        LLBC_MessageBlock *block = _head;
-        _head = _head->GetNext();
-        delete block;
+        this->RemoveHead();
     }
 
     if (needReadLen > 0)
@@ -103,13 +102,29 @@ LLBC_MessageBlock *LLBC_MessageBuffer::FirstBlock() const
     return _head;
 }
 
+size_t LLBC_MessageBuffer::GetSize() const
+{
+    return _size;
+}
+
+size_t LLBC_MessageBuffer::GetBlockCount() const
+{
+    return _blockCount;
+}
+
 LLBC_MessageBlock *LLBC_MessageBuffer::MergeBuffersAndDetach()
 {
     if (!_head)
         return NULL;
 
+    // Shared block is read only, can't merge other blocks into it.
     LLBC_MessageBlock *mergedBlock = _head;
     LLBC_MessageBlock *curBlock = _head->GetNext();
+    if (_head->IsShared())
+    {
+        mergedBlock = new LLBC_MessageBlock(_size);
+        curBlock = _head;
+    }
     while (curBlock)
     {
         mergedBlock->Write(
@@ -120,7 +135,9 @@ LLBC_MessageBlock *LLBC_MessageBuffer::MergeBuffersAndDetach()
         curBlock = next;
     }
 
-    _head = NULL;
+    _head = _tail = NULL;
+    _size = _blockCount = 0;
+
     mergedBlock->SetNext(NULL);
 
     return mergedBlock;
@@ -143,52 +160,40 @@ int LLBC_MessageBuffer::Append(LLBC_MessageBlock *block)
     block->SetNext(NULL);
 
     if (!_head)
-    {
         _head = block;
-        return LLBC_RTN_OK;
-    }
+    else
+        _tail->SetNext(block);
 
-    LLBC_MessageBlock *curBlock = _head;
-    while (curBlock->GetNext())
-        curBlock = curBlock->GetNext();
+    _tail = block;
 
-    curBlock->SetNext(block);
+    _size += block->GetReadableSize();
+    _blockCount += 1;
 
     return LLBC_RTN_OK;
 }
 
 size_t LLBC_MessageBuffer::Remove(size_t length)
 {
-    if (UNLIKELY(length < 0))
-    {
-        LLBC_SetLastError(LLBC_ERROR_ARG);
-        return 0;
-    }
-
     size_t needRemoveLength = length;
-    while (needRemoveLength > 0)
+    while (needRemoveLength > 0 && _head)
     {
         size_t availableSize = _head->GetWritePos() - _head->GetReadPos();
         if (availableSize >= needRemoveLength)
         {
             _head->SetReadPos(_head->GetReadPos() + needRemoveLength);
+            _size -= needRemoveLength;
 
             if (availableSize == needRemoveLength)
-            {
-                LLBC_MessageBlock *block = _head;
-                _head = _head->GetNext();
-                delete block;
-            }
+                this->RemoveHead();
 
             needRemoveLength = 0;
             break;
         }
 
         needRemoveLength -= availableSize;
+        _size -= availableSize;
 
-        LLBC_MessageBlock *block = _head;
-        _head = _head->GetNext();
-        delete block;
+        this->RemoveHead();
     }
 
     if (needRemoveLength > 0)
@@ -208,6 +213,20 @@ void LLBC_MessageBuffer::Cleanup()
         _head = _head->GetNext();
         delete block;
     }
+
+    _tail = NULL;
+    _size = _blockCount = 0;
+}
+
+void LLBC_MessageBuffer::RemoveHead()
+{
+    LLBC_MessageBlock *block = _head;
+    if (!(_head = _head->GetNext()))
+        _tail = NULL;
+
+    _blockCount -= 1;
+
+    delete block;
 }
 
 __LLBC_NS_END
@@ -52,6 +52,8 @@ LLBC_BaseTask::LLBC_BaseTask(LLBC_ThreadManager *threadMgr)
     , _curThreadNum(0)
     , _startCompleted(false)
     , _threadManager(threadMgr ? threadMgr : LLBC_ThreadManagerSingleton)
+
+    , _msgQueueLockFree(LLBC_CFG_THREAD_DFT_LOCK_FREE_MSG_QUEUE != 0)
 {
 }
 
@@ -71,6 +73,15 @@ int LLBC_BaseTask::Activate(int threadNum,
 
     _lock.Lock();
 
+    // Lock-free message queue only support single consumer.
+    if (_msgQueueLockFree && threadNum != 1)
+    {
+        _lock.Unlock();
+
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_RTN_FAILED;
+    }
+
     if (_threadManager->CreateThreads(threadNum,
                                       &LLBC_INTERNAL_NS __LLBC_BaseTaskEntry,
                                       task,
@@ -103,6 +114,30 @@ int LLBC_BaseTask::GetThreadCount() const
     return this->_threadNum;
 }
 
+bool LLBC_BaseTask::IsMsgQueueLockFree() const
+{
+    return _msgQueueLockFree;
+}
+
+int LLBC_BaseTask::SetMsgQueueLockFree(bool lockFree)
+{
+    LLBC_Guard guard(_lock);
+    if (_threadNum > 0)
+    {
+        LLBC_SetLastError(LLBC_ERROR_INITED);
+        return LLBC_RTN_FAILED;
+    }
+
+    _msgQueueLockFree = lockFree;
+
+    return LLBC_RTN_OK;
+}
+
+ulong LLBC_BaseTask::GetMsgQueueSize() const
+{
+    return _msgQueueLockFree ? _lockFreeMsgQueue.GetSize() : _msgQueue.GetSize();
+}
+
 int LLBC_BaseTask::Wait()
 {
     return _threadManager->WaitTask(this);
@@ -130,19 +165,28 @@ int LLBC_BaseTask::Kill(int signo)
 
 int LLBC_BaseTask::Push(LLBC_MessageBlock *block)
 {
-    _msgQueue.PushBack(block);
+    if (_msgQueueLockFree)
+        _lockFreeMsgQueue.PushBack(block);
+    else
+        _msgQueue.PushBack(block);
+
     return LLBC_RTN_OK;
 }
 
 int LLBC_BaseTask::Pop(LLBC_MessageBlock *&block)
 {
-    _msgQueue.PopFront(block);
+    if (_msgQueueLockFree)
+        _lockFreeMsgQueue.PopFront(block);
+    else
+        _msgQueue.PopFront(block);
+
     return LLBC_RTN_OK;
 }
 
 int LLBC_BaseTask::TryPop(LLBC_MessageBlock *&block)
 {
-    if (_msgQueue.TryPopFront(block))
+    if (_msgQueueLockFree ?
+            _lockFreeMsgQueue.TryPopFront(block) : _msgQueue.TryPopFront(block))
         return LLBC_RTN_OK;
 
     return LLBC_RTN_FAILED;
@@ -150,7 +194,8 @@ int LLBC_BaseTask::TryPop(LLBC_MessageBlock *&block)
 
 int LLBC_BaseTask::TimedPop(LLBC_MessageBlock *&block, int interval)
 {
-    if (_msgQueue.TimedPopFront(block, interval))
+    if (_msgQueueLockFree ?
+            _lockFreeMsgQueue.TimedPopFront(block, interval) : _msgQueue.TimedPopFront(block, interval))
         return LLBC_RTN_OK;
 
     return LLBC_RTN_FAILED;
@@ -20,6 +20,8 @@
 #include "llbc/core/thread/ThreadGroupDescriptor.h"
 #include "llbc/core/thread/ThreadManager.h"
 
+#include "llbc/core/log/LogRunnable.h"
+
 __LLBC_INTERNAL_NS_BEGIN
 
 extern "C" {
@@ -73,6 +75,9 @@ static LLBC_NS LLBC_ThreadRtn __LLBC_ThreadMgr_ThreadEntry(LLBC_NS LLBC_ThreadAr
     // Notify thread manager thread terminated.
     threadMgr->OnThreadTerminate(threadHandle);
 
+    // Release thread log rings.
+    LLBC_NS LLBC_LogRunnable::ReleaseThreadRings();
+
     // Cleanup tls.
 #if LLBC_TARGET_PLATFORM_WIN32
     ::CloseHandle(tls->coreTls.nativeThreadHandle);
@@ -14,6 +14,7 @@
 
 #include "llbc/core/timer/BaseTimer.h"
 #include "llbc/core/timer/TimerData.h"
+#include "llbc/core/timer/TimingWheel.h"
 
 #include "llbc/core/timer/TimerScheduler.h"
 
@@ -29,13 +30,20 @@ LLBC_TimerScheduler::LLBC_TimerScheduler()
 : _maxTimerId(0)
 , _enabled(true)
 , _destroyed(false)
+
+, _wheel(NULL)
 {
+#if LLBC_CFG_CORE_TIMER_DFT_USE_TIMING_WHEEL
+    _wheel = LLBC_New(LLBC_TimingWheel);
+#endif
 }
 
 LLBC_TimerScheduler::~LLBC_TimerScheduler()
 {
     _destroyed = true;
 
+    LLBC_XDelete(_wheel);
+
     size_t size = _heap.GetSize();
     const _Heap::Container &elems = _heap.GetData();
     for (size_t i = 1; i <= size; i++)
@@ -87,6 +95,12 @@ void LLBC_TimerScheduler::Update()
     if (!_enabled)
         return;
 
+    if (_wheel)
+    {
+        _wheel->Update();
+        return;
+    }
+
     LLBC_TimerData *data;
     uint64 now = LLBC_GetMilliSeconds();
 
@@ -150,6 +164,21 @@ void LLBC_TimerScheduler::Update()
     }
 }
 
+sint64 LLBC_TimerScheduler::GetNextTimeout() const
+{
+    if (!_enabled)
+        return -1;
+    else if (_wheel)
+        return _wheel->GetNextTimeout();
+
+    LLBC_TimerData *data;
+    if (_heap.FindTop(data) != LLBC_RTN_OK)
+        return -1;
+
+    const uint64 now = LLBC_GetMilliSeconds();
+    return data->handle > now ? static_cast<sint64>(data->handle - now) : 0;
+}
+
 bool LLBC_TimerScheduler::IsEnabled() const
 {
     return _enabled;
@@ -160,6 +189,38 @@ void LLBC_TimerScheduler::SetEnabled(bool enabled)
     _enabled = enabled;
 }
 
+int LLBC_TimerScheduler::GetBackend() const
+{
+    return _wheel ? TimingWheelBackend : HeapBackend;
+}
+
+int LLBC_TimerScheduler::SetBackend(int backend)
+{
+    if (backend != HeapBackend && backend != TimingWheelBackend)
+    {
+        LLBC_SetLastError(LLBC_ERROR_ARG);
+        return LLBC_RTN_FAILED;
+    }
+    else if (backend == this->GetBackend())
+    {
+        return LLBC_RTN_OK;
+    }
+
+    // Can't migrate scheduling timers between backends.
+    if ((_wheel && _wheel->GetSize() > 0) || !_idxMap.empty())
+    {
+        LLBC_SetLastError(LLBC_ERROR_PERM);
+        return LLBC_RTN_FAILED;
+    }
+
+    if (backend == TimingWheelBackend)
+        _wheel = LLBC_New(LLBC_TimingWheel);
+    else
+        LLBC_XDelete(_wheel);
+
+    return LLBC_RTN_OK;
+}
+
 bool LLBC_TimerScheduler::IsDstroyed() const
 {
     return _destroyed;
@@ -167,6 +228,9 @@ bool LLBC_TimerScheduler::IsDstroyed() const
 
 int LLBC_TimerScheduler::Schedule(LLBC_BaseTimer *timer)
 {
+    if (_wheel)
+        return _wheel->Schedule(timer);
+
     LLBC_TimerData *data = new LLBC_TimerData;
     data->handle = LLBC_GetMilliSeconds() + timer->GetDueTime();
     data->timerId = ++ _maxTimerId;
@@ -187,6 +251,9 @@ int LLBC_TimerScheduler::Schedule(LLBC_BaseTimer *timer)
 
 int LLBC_TimerScheduler::Cancel(LLBC_BaseTimer *timer)
 {
+    if (_wheel)
+        return _wheel->Cancel(timer);
+
     _IdxMap::iterator iter = _idxMap.find(timer->GetTimerId());
     if (iter == _idxMap.end())
     {
@@ -0,0 +1,336 @@
+/**
+ * @file    TimingWheel.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "llbc/common/Export.h"
+#include "llbc/common/BeforeIncl.h"
+
+#include "llbc/core/os/OS_Time.h"
+
+#include "llbc/core/timer/BaseTimer.h"
+#include "llbc/core/timer/TimingWheel.h"
+
+__LLBC_INTERNAL_NS_BEGIN
+
+static const int ROOT_BITS = 8;
+static const int NODE_BITS = 6;
+static const int NODE_LEVELS = 4;
+
+static const LLBC_NS uint32 ROOT_SIZE = 1 << ROOT_BITS;
+static const LLBC_NS uint32 NODE_SIZE = 1 << NODE_BITS;
+static const LLBC_NS uint32 ROOT_MASK = ROOT_SIZE - 1;
+static const LLBC_NS uint32 NODE_MASK = NODE_SIZE - 1;
+
+// The max delay which timing wheel can hold, longer timers will be clipped and re-add when reach.
+static const LLBC_NS uint64 MAX_DELTA = (static_cast<LLBC_NS uint64>(1) << (ROOT_BITS + NODE_LEVELS * NODE_BITS)) - 1;
+
+// All levels' slots, and the work slot, hold the current tick firing timers.
+static const LLBC_NS uint32 SLOT_COUNT = ROOT_SIZE + NODE_LEVELS * NODE_SIZE;
+static const LLBC_NS uint32 WORK_SLOT = SLOT_COUNT;
+
+static const LLBC_NS uint32 INVALID_IDX = 0xffffffff;
+
+static inline LLBC_NS uint32 __NodeSlot(int level, LLBC_NS uint32 index)
+{
+    return ROOT_SIZE + (level - 1) * NODE_SIZE + index;
+}
+
+static inline LLBC_NS uint32 __NodeIndex(int level, LLBC_NS uint64 time)
+{
+    return static_cast<LLBC_NS uint32>(time >> (ROOT_BITS + (level - 1) * NODE_BITS)) & NODE_MASK;
+}
+
+__LLBC_INTERNAL_NS_END
+
+__LLBC_NS_BEGIN
+
+LLBC_TimingWheel::LLBC_TimingWheel()
+: _curTime(static_cast<uint64>(LLBC_GetMilliSeconds()))
+, _size(0)
+
+, _entries()
+, _freeHead(LLBC_INL_NS INVALID_IDX)
+
+, _heads(NULL)
+{
+    _heads = LLBC_Malloc(uint32, sizeof(uint32) * (LLBC_INL_NS SLOT_COUNT + 1));
+    ::memset(_heads, 0xff, sizeof(uint32) * (LLBC_INL_NS SLOT_COUNT + 1));
+}
+
+LLBC_TimingWheel::~LLBC_TimingWheel()
+{
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        if (_entries[i].slot == LLBC_INL_NS INVALID_IDX)
+            continue;
+
+        LLBC_BaseTimer *timer = _entries[i].timer;
+        _entries[i].slot = LLBC_INL_NS INVALID_IDX;
+
+        timer->SetScheduling(false);
+        timer->OnCancel();
+    }
+
+    LLBC_XFree(_heads);
+}
+
+void LLBC_TimingWheel::Update()
+{
+    const uint64 now = static_cast<uint64>(LLBC_GetMilliSeconds());
+    if (_size == 0)
+    {
+        // No timer, skip idle ticks directly.
+        if (_curTime <= now)
+            _curTime = now + 1;
+
+        return;
+    }
+
+    while (_curTime <= now)
+        this->Tick();
+}
+
+sint64 LLBC_TimingWheel::GetNextTimeout() const
+{
+    if (_size == 0)
+        return -1;
+    else if (_heads[LLBC_INL_NS WORK_SLOT] != LLBC_INL_NS INVALID_IDX)
+        return 0;
+
+    // Scan root wheel until next cascade boundary.
+    const uint64 now = static_cast<uint64>(LLBC_GetMilliSeconds());
+    uint64 time = _curTime;
+    for (uint32 i = 0; i < LLBC_INL_NS ROOT_SIZE; i++, time++)
+    {
+        if ((i != 0 && (time & LLBC_INL_NS ROOT_MASK) == 0) ||
+            _heads[time & LLBC_INL_NS ROOT_MASK] != LLBC_INL_NS INVALID_IDX)
+            break;
+    }
+
+    return time > now ? static_cast<sint64>(time - now) : 0;
+}
+
+size_t LLBC_TimingWheel::GetSize() const
+{
+    return _size;
+}
+
+int LLBC_TimingWheel::Schedule(LLBC_BaseTimer *timer)
+{
+    const uint64 now = static_cast<uint64>(LLBC_GetMilliSeconds());
+    if (_size == 0 && _curTime < now)
+        _curTime = now;
+
+    const uint32 idx = this->AllocEntry();
+
+    _Entry &entry = _entries[idx];
+    entry.expire = now + timer->GetDueTime();
+    entry.period = timer->GetPeriod();
+    entry.timer = timer;
+
+    timer->SetTimerId((static_cast<LLBC_TimerId>(entry.generation) << 32) | idx);
+    timer->SetScheduling(true);
+
+    this->AddEntry(idx);
+
+    return LLBC_RTN_OK;
+}
+
+int LLBC_TimingWheel::Cancel(LLBC_BaseTimer *timer)
+{
+    const LLBC_TimerId timerId = timer->GetTimerId();
+    const uint32 idx = static_cast<uint32>(timerId & 0xffffffff);
+    if (idx >= _entries.size() ||
+        _entries[idx].generation != static_cast<uint32>(timerId >> 32) ||
+        _entries[idx].slot == LLBC_INL_NS INVALID_IDX)
+    {
+        LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+        return LLBC_RTN_FAILED;
+    }
+
+    ASSERT(_entries[idx].timer == timer &&
+        "Timing wheel internal error, _Entry::timer != argument: timer!");
+
+    this->UnlinkEntry(idx);
+    this->ReleaseEntry(idx);
+
+    timer->SetScheduling(false);
+    timer->OnCancel();
+
+    return LLBC_RTN_OK;
+}
+
+uint32 LLBC_TimingWheel::AllocEntry()
+{
+    uint32 idx = _freeHead;
+    if (idx != LLBC_INL_NS INVALID_IDX)
+    {
+        _freeHead = _entries[idx].next;
+    }
+    else
+    {
+        idx = static_cast<uint32>(_entries.size());
+
+        _Entry entry;
+        entry.generation = 1;
+        _entries.push_back(entry);
+    }
+
+    _Entry &entry = _entries[idx];
+    entry.slot = LLBC_INL_NS INVALID_IDX;
+    entry.prev = entry.next = LLBC_INL_NS INVALID_IDX;
+
+    ++ _size;
+
+    return idx;
+}
+
+void LLBC_TimingWheel::ReleaseEntry(uint32 idx)
+{
+    _Entry &entry = _entries[idx];
+
+    // Generation never be 0, make sure timer Id never equal to LLBC_INVALID_TIMER_ID.
+    if (++ entry.generation == 0)
+        entry.generation = 1;
+
+    entry.timer = NULL;
+    entry.slot = LLBC_INL_NS INVALID_IDX;
+    entry.prev = LLBC_INL_NS INVALID_IDX;
+    entry.next = _freeHead;
+    _freeHead = idx;
+
+    -- _size;
+}
+
+void LLBC_TimingWheel::AddEntry(uint32 idx)
+{
+    uint64 expire = _entries[idx].expire;
+    if (expire < _curTime)
+        expire = _curTime;
+
+    uint64 delta = expire - _curTime;
+    if (delta < LLBC_INL_NS ROOT_SIZE)
+    {
+        this->LinkEntry(idx, static_cast<uint32>(expire & LLBC_INL_NS ROOT_MASK));
+        return;
+    }
+
+    // Too long timer, clip it, when reach, will re-add it.
+    if (delta > LLBC_INL_NS MAX_DELTA)
+    {
+        delta = LLBC_INL_NS MAX_DELTA;
+        expire = _curTime + delta;
+    }
+
+    int level = 1;
+    while (level < LLBC_INL_NS NODE_LEVELS &&
+           delta >= (static_cast<uint64>(1) << (LLBC_INL_NS ROOT_BITS + level * LLBC_INL_NS NODE_BITS)))
+        ++ level;
+
+    this->LinkEntry(idx, LLBC_INL_NS __NodeSlot(level, LLBC_INL_NS __NodeIndex(level, expire)));
+}
+
+void LLBC_TimingWheel::LinkEntry(uint32 idx, uint32 slot)
+{
+    _Entry &entry = _entries[idx];
+    entry.slot = slot;
+    entry.prev = LLBC_INL_NS INVALID_IDX;
+    entry.next = _heads[slot];
+
+    if (entry.next != LLBC_INL_NS INVALID_IDX)
+        _entries[entry.next].prev = idx;
+    _heads[slot] = idx;
+}
+
+void LLBC_TimingWheel::UnlinkEntry(uint32 idx)
+{
+    _Entry &entry = _entries[idx];
+    if (entry.prev != LLBC_INL_NS INVALID_IDX)
+        _entries[entry.prev].next = entry.next;
+    else
+        _heads[entry.slot] = entry.next;
+
+    if (entry.next != LLBC_INL_NS INVALID_IDX)
+        _entries[entry.next].prev = entry.prev;
+
+    entry.prev = entry.next = LLBC_INL_NS INVALID_IDX;
+}
+
+uint32 LLBC_TimingWheel::Cascade(int level, uint32 index)
+{
+    const uint32 slot = LLBC_INL_NS __NodeSlot(level, index);
+
+    uint32 idx = _heads[slot];
+    _heads[slot] = LLBC_INL_NS INVALID_IDX;
+    while (idx != LLBC_INL_NS INVALID_IDX)
+    {
+        const uint32 next = _entries[idx].next;
+        this->AddEntry(idx);
+
+        idx = next;
+    }
+
+    return index;
+}
+
+void LLBC_TimingWheel::Tick()
+{
+    // Cascade upper levels when root wheel turn around.
+    const uint32 index = static_cast<uint32>(_curTime & LLBC_INL_NS ROOT_MASK);
+    if (index == 0)
+    {
+        for (int level = 1; level <= LLBC_INL_NS NODE_LEVELS; level++)
+        {
+            if (this->Cascade(level, LLBC_INL_NS __NodeIndex(level, _curTime)) != 0)
+                break;
+        }
+    }
+
+    // Move current tick timers to work slot, timers add in firing will go to next tick.
+    uint32 idx = _heads[index];
+    _heads[index] = LLBC_INL_NS INVALID_IDX;
+    _heads[LLBC_INL_NS WORK_SLOT] = idx;
+    for (; idx != LLBC_INL_NS INVALID_IDX; idx = _entries[idx].next)
+        _entries[idx].slot = LLBC_INL_NS WORK_SLOT;
+
+    const uint64 tickTime = _curTime++;
+    while ((idx = _heads[LLBC_INL_NS WORK_SLOT]) != LLBC_INL_NS INVALID_IDX)
+    {
+        this->UnlinkEntry(idx);
+
+        // Clipped long timer, not really expired, re-add it.
+        if (_entries[idx].expire > tickTime)
+        {
+            this->AddEntry(idx);
+            continue;
+        }
+
+        // Timer callback maybe schedule new timers, don't hold entry reference.
+        LLBC_BaseTimer *timer = _entries[idx].timer;
+        _entries[idx].slot = LLBC_INL_NS INVALID_IDX;
+        timer->SetScheduling(false);
+
+        const bool reSchedule = timer->OnTimeout();
+        if (reSchedule && !timer->IsScheduling())
+        {
+            _Entry &entry = _entries[idx];
+            entry.expire = tickTime + entry.period;
+
+            timer->SetScheduling(true);
+            this->AddEntry(idx);
+        }
+        else
+        {
+            this->ReleaseEntry(idx);
+        }
+    }
+}
+
+__LLBC_NS_END
+
+#include "llbc/common/AfterIncl.h"
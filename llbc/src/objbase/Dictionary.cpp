@@ -13,6 +13,7 @@
 #include "llbc/objbase/Object.h"
 #include "llbc/objbase/ObjectFactory.h"
 #include "llbc/objbase/ObjectMacro.h"
+#include "llbc/objbase/KeyHashAlgorithm.h"
 #include "llbc/objbase/Dictionary.h"
 
 __LLBC_NS_BEGIN
@@ -25,6 +26,13 @@ LLBC_Dictionary::LLBC_Dictionary(LLBC_Dictionary::size_type bucketSize)
 , _bucketSize(bucketSize)
 , _bucket(NULL)
 
+, _oldBucketSize(0)
+, _oldBucket(NULL)
+, _rehashIdx(0)
+
+, _maxLoadFactor(LLBC_CFG_OBJBASE_DICT_DFT_MAX_LOAD_FACTOR)
+, _hashFun(*LLBC_KeyHashAlgorithmSingleton->GetAlgorithm(LLBC_CFG_OBJBASE_DICT_KEY_HASH_ALGO))
+
 , _objFactory(NULL)
 {
     _bucket = reinterpret_cast<LLBC_DictionaryElem **>(
@@ -55,6 +63,15 @@ void LLBC_Dictionary::Clear()
     _head = _tail = NULL;
 
     LLBC_MemSet(_bucket, 0, _bucketSize * sizeof(LLBC_DictionaryElem *));
+
+    // Discard the rehashing old bucket.
+    if (_oldBucket)
+    {
+        free(_oldBucket);
+        _oldBucket = NULL;
+        _oldBucketSize = 0;
+        _rehashIdx = 0;
+    }
 }
 
 LLBC_Dictionary::size_type LLBC_Dictionary::GetSize() const
@@ -75,6 +92,9 @@ int LLBC_Dictionary::SetHashBucketSize(size_type bucketSize)
         return LLBC_RTN_FAILED;
     }
 
+    // If in rehashing, finish it first.
+    this->FinishRehash();
+
     // Cancel hash.
     Iter it = this->Begin(), endIt = this->End();
     for (; it != endIt; it++)
@@ -98,6 +118,29 @@ int LLBC_Dictionary::SetHashBucketSize(size_type bucketSize)
     return LLBC_RTN_OK;
 }
 
+double LLBC_Dictionary::GetMaxLoadFactor() const
+{
+    return _maxLoadFactor;
+}
+
+int LLBC_Dictionary::SetMaxLoadFactor(double maxLoadFactor)
+{
+    if (UNLIKELY(maxLoadFactor <= 0))
+    {
+        LLBC_SetLastError(LLBC_ERROR_INVALID);
+        return LLBC_RTN_FAILED;
+    }
+
+    _maxLoadFactor = maxLoadFactor;
+
+    return LLBC_RTN_OK;
+}
+
+bool LLBC_Dictionary::IsRehashing() const
+{
+    return _oldBucket != NULL;
+}
+
 int LLBC_Dictionary::Insert(int key, LLBC_Dictionary::Obj *o)
 {
     if (UNLIKELY(!o))
@@ -112,11 +155,8 @@ int LLBC_Dictionary::Insert(int key, LLBC_Dictionary::Obj *o)
         return LLBC_RTN_FAILED;
     }
 
-    // Check bucket size and auto expand it.
-    if (_size >= _bucketSize * 100)
-    {
-        this->SetHashBucketSize(_bucketSize * 2);
-    }
+    // Check load factor and auto expand bucket, or continue incremental rehash.
+    this->ExpandIfNeed();
 
     LLBC_DictionaryElem *elem = new LLBC_DictionaryElem(key, o);
 
@@ -154,11 +194,8 @@ int LLBC_Dictionary::Insert(const LLBC_String &key, LLBC_Dictionary::Obj *o)
         return LLBC_RTN_FAILED;
     }
 
-    // Check bucket size and auto expand it.
-    if (_size >= _bucketSize * 100)
-    {
-        this->SetHashBucketSize(_bucketSize * 2);
-    }
+    // Check load factor and auto expand bucket, or continue incremental rehash.
+    this->ExpandIfNeed();
 
     LLBC_DictionaryElem *elem = new LLBC_DictionaryElem(key, o);
 
@@ -255,20 +292,18 @@ int LLBC_Dictionary::Erase(Iter it)
 
     _size -= 1;
 
+    // Continue incremental rehash.
+    if (_oldBucket)
+        this->RehashStep(LLBC_CFG_OBJBASE_DICT_REHASH_STEP);
+
     return LLBC_RTN_OK;
 }
 
 LLBC_Dictionary::Iter LLBC_Dictionary::Find(int key)
 {
-    int hash = key % _bucketSize;
-    LLBC_DictionaryElem *elem = _bucket[hash];
-    for (; elem != NULL; elem = elem->GetBucketElemNext())
-    {
-        if (elem->IsIntKey() && elem->GetIntKey() == key)
-        {
-            return Iter(elem);
-        }
-    }
+    LLBC_DictionaryElem *elem = this->FindElem(key);
+    if (elem)
+        return Iter(elem);
 
     LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
     return this->End();
@@ -276,19 +311,9 @@ LLBC_Dictionary::Iter LLBC_Dictionary::Find(int key)
 
 LLBC_Dictionary::Iter LLBC_Dictionary::Find(const LLBC_String &key)
 {
-    LLBC_KeyHashAlgorithm *hashAlgo = LLBC_KeyHashAlgorithmSingleton;
-    const LLBC_KeyHashAlgorithm::HashBase &hashFun = 
-        *hashAlgo->GetAlgorithm(LLBC_CFG_OBJBASE_DICT_KEY_HASH_ALGO);
-
-    uint32 hash = hashFun(key.c_str(), key.size()) % _bucketSize;
-    LLBC_DictionaryElem *elem = _bucket[hash];
-    for (; elem != NULL; elem = elem->GetBucketElemNext())
-    {
-        if (elem->IsStrKey() && *elem->GetStrKey() == key)
-        {
-            return Iter(elem);
-        }
-    }
+    LLBC_DictionaryElem *elem = this->FindElem(key);
+    if (elem)
+        return Iter(elem);
 
     LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
     return this->End();
@@ -296,30 +321,22 @@ LLBC_Dictionary::Iter LLBC_Dictionary::Find(const LLBC_String &key)
 
 LLBC_Dictionary::ConstIter LLBC_Dictionary::Find(int key) const
 {
-    LLBC_Dictionary *nonConstThis = 
-        const_cast<LLBC_Dictionary *>(this);
+    const LLBC_DictionaryElem *elem = this->FindElem(key);
+    if (elem)
+        return ConstIter(elem);
 
-    LLBC_Dictionary::Iter it = nonConstThis->Find(key);
-    if (it == nonConstThis->End())
-    {
-        return this->End();
-    }
-
-    return ConstIter(it.Elem());
+    LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+    return this->End();
 }
 
 LLBC_Dictionary::ConstIter LLBC_Dictionary::Find(const LLBC_String &key) const
 {
-    LLBC_Dictionary *nonConstThis = 
-        const_cast<LLBC_Dictionary *>(this);
-
-    LLBC_Dictionary::Iter it = nonConstThis->Find(key);
-    if (it == nonConstThis->End())
-    {
-        return this->End();
-    }
+    const LLBC_DictionaryElem *elem = this->FindElem(key);
+    if (elem)
+        return ConstIter(elem);
 
-    return ConstIter(it.Elem());
+    LLBC_SetLastError(LLBC_ERROR_NOT_FOUND);
+    return this->End();
 }
 
 LLBC_Dictionary::Iter LLBC_Dictionary::Begin()
@@ -562,6 +579,120 @@ void LLBC_Dictionary::RemoveFromDoublyLinkedList(LLBC_DictionaryElem *elem)
     }
 }
 
+LLBC_DictionaryElem *LLBC_Dictionary::FindElem(int key) const
+{
+    // If in rehashing, the element maybe still in old bucket.
+    const uint32 keyHash = static_cast<uint32>(key);
+    LLBC_DictionaryElem **buckets[2] = {_bucket, _oldBucket};
+    const size_type bucketSizes[2] = {_bucketSize, _oldBucketSize};
+    for (int i = 0; i < 2 && buckets[i]; i++)
+    {
+        LLBC_DictionaryElem *elem = buckets[i][keyHash % static_cast<uint32>(bucketSizes[i])];
+        for (; elem != NULL; elem = elem->GetBucketElemNext())
+        {
+            if (elem->IsIntKey() && elem->GetIntKey() == key)
+            {
+                return elem;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+LLBC_DictionaryElem *LLBC_Dictionary::FindElem(const LLBC_String &key) const
+{
+    // If in rehashing, the element maybe still in old bucket.
+    const uint32 keyHash = _hashFun(key.c_str(), key.size());
+    LLBC_DictionaryElem **buckets[2] = {_bucket, _oldBucket};
+    const size_type bucketSizes[2] = {_bucketSize, _oldBucketSize};
+    for (int i = 0; i < 2 && buckets[i]; i++)
+    {
+        LLBC_DictionaryElem *elem = buckets[i][keyHash % static_cast<uint32>(bucketSizes[i])];
+        for (; elem != NULL; elem = elem->GetBucketElemNext())
+        {
+            if (elem->IsStrKey() && *elem->GetStrKey() == key)
+            {
+                return elem;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+void LLBC_Dictionary::ExpandIfNeed()
+{
+    if (_oldBucket)
+    {
+        this->RehashStep(LLBC_CFG_OBJBASE_DICT_REHASH_STEP);
+    }
+    else if (_size + 1 > _bucketSize * _maxLoadFactor)
+    {
+        this->StartRehash(_bucketSize * 2);
+    }
+}
+
+void LLBC_Dictionary::StartRehash(size_type newBucketSize)
+{
+    this->FinishRehash();
+
+    _oldBucket = _bucket;
+    _oldBucketSize = _bucketSize;
+    _rehashIdx = 0;
+
+    _bucketSize = newBucketSize;
+    _bucket = reinterpret_cast<LLBC_DictionaryElem **>(
+        calloc(_bucketSize, sizeof(LLBC_DictionaryElem *)));
+
+    // Migrate some buckets at once, if dictionary is empty, rehash will finish immediately.
+    this->RehashStep(LLBC_CFG_OBJBASE_DICT_REHASH_STEP);
+}
+
+void LLBC_Dictionary::RehashStep(size_type step)
+{
+    // Migrate at most <step> non-empty buckets, and limit the empty buckets visit count.
+    size_type emptyVisits = step * 10;
+    while (step > 0 && _rehashIdx < _oldBucketSize)
+    {
+        LLBC_DictionaryElem *elem = _oldBucket[_rehashIdx];
+        if (!elem)
+        {
+            _rehashIdx += 1;
+            if (--emptyVisits == 0)
+                break;
+
+            continue;
+        }
+
+        while (elem)
+        {
+            LLBC_DictionaryElem *next = elem->GetBucketElemNext();
+            elem->Hash(_bucket, _bucketSize);
+
+            elem = next;
+        }
+
+        _oldBucket[_rehashIdx++] = NULL;
+        step -= 1;
+    }
+
+    // All buckets migrated, free the old bucket.
+    if (_rehashIdx == _oldBucketSize)
+    {
+        free(_oldBucket);
+        _oldBucket = NULL;
+        _oldBucketSize = 0;
+        _rehashIdx = 0;
+    }
+}
+
+void LLBC_Dictionary::FinishRehash()
+{
+    if (_oldBucket)
+        this->RehashStep(_oldBucketSize);
+}
+
 __LLBC_NS_END
 
 #include "llbc/common/AfterIncl.h"
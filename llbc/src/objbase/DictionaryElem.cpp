@@ -19,6 +19,7 @@ __LLBC_NS_BEGIN
 LLBC_DictionaryElem::LLBC_DictionaryElem(int key, LLBC_Object *o)
 : _intKey(key)
 , _strKey(NULL)
+, _keyHash(static_cast<uint32>(key))
 , _hash(0)
 
 , _obj(o)
@@ -40,6 +41,7 @@ LLBC_DictionaryElem::LLBC_DictionaryElem(int key, LLBC_Object *o)
 LLBC_DictionaryElem::LLBC_DictionaryElem(const LLBC_String &key, LLBC_Object *o)
 : _intKey(0)
 , _strKey(new LLBC_String(key))
+, _keyHash(0)
 , _hash(0)
 
 , _obj(o)
@@ -55,6 +57,9 @@ LLBC_DictionaryElem::LLBC_DictionaryElem(const LLBC_String &key, LLBC_Object *o)
 
 , _hashFun(*LLBC_KeyHashAlgorithmSingleton->GetAlgorithm(LLBC_CFG_OBJBASE_DICT_KEY_HASH_ALGO))
 {
+    // String key hash value only calculate once, rehash will reuse it.
+    _keyHash = _hashFun(_strKey->c_str(), _strKey->size());
+
     o->Retain();
 }
 
@@ -105,15 +110,7 @@ void LLBC_DictionaryElem::Hash(LLBC_DictionaryElem **bucket, size_t bucketSize)
     _bucketSize = bucketSize;
 
     // Generate hash key.
-    if(this->IsIntKey())
-    {
-        _hash = _intKey % _bucketSize;
-    }
-    else
-    {
-        _hash = _hashFun(_strKey->c_str(), 
-            _strKey->size()) % static_cast<uint32>(_bucketSize);
-    }
+    _hash = _keyHash % static_cast<uint32>(_bucketSize);
 
     // Link to hash bucket.
     this->SetBucketElemPrev(NULL);
@@ -50,8 +50,11 @@ int TestSuite_Main(int argc, char *argv[])
     // test = new TestCase_Core_Thread_Tls;
     // test = new TestCase_Core_Thread_ThreadMgr;
     // test = new TestCase_Core_Thread_Task;
+    // test = new TestCase_Core_Thread_MsgQueueContention;
+    // test = new TestCase_Core_Thread_MsgBuffer;
     // test = new TestCase_Core_Random;
     // test = new TestCase_Core_Log;
+    // test = new TestCase_Core_LogPerf;
     // test = new TestCase_Core_Entity;
     // test = new TestCase_Core_Transcoder;
     // test = new TestCase_Core_Library;
@@ -76,6 +79,25 @@ int TestSuite_Main(int argc, char *argv[])
     // test = new TestCase_Comm_ExternalDriveSvc;
     // test = new TestCase_Comm_LazyTask;
     // test = new TestCase_Comm_CustomHeaderSvc;
+    // test = new TestCase_Comm_PollerLatency;
+    // test = new TestCase_Comm_Compress;
+    // test = new TestCase_Comm_Broadcast;
+    // test = new TestCase_Comm_ConcurrentSend;
+    // test = new TestCase_Comm_EventDrivenSvc;
+    // test = new TestCase_Comm_SendCoalesce;
+    // test = new TestCase_Comm_ReusePortAccept;
+    // test = new TestCase_Comm_PollerDecode;
+    // test = new TestCase_Comm_TimingWheel;
+    // test = new TestCase_Comm_PacketPool;
+    // test = new TestCase_Comm_HeaderLayout;
+    // test = new TestCase_Comm_UnixSocket;
+    // test = new TestCase_Comm_LocalChannel;
+    // test = new TestCase_Comm_ShmChannel;
+    // test = new TestCase_Comm_GatherSend;
+    // test = new TestCase_Comm_RecvBlockPool;
+    // test = new TestCase_Comm_DataArrival;
+    // test = new TestCase_Comm_DispatchTable;
+    // test = new TestCase_Comm_SvcMetrics;
 
     int ret = LLBC_RTN_FAILED;
     if (test)
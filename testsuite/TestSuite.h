@@ -42,8 +42,11 @@
 #include "core/thread/TestCase_Core_Thread_Tls.h"
 #include "core/thread/TestCase_Core_Thread_ThreadMgr.h"
 #include "core/thread/TestCase_Core_Thread_Task.h"
+#include "core/thread/TestCase_Core_Thread_MsgQueueContention.h"
+#include "core/thread/TestCase_Core_Thread_MsgBuffer.h"
 #include "core/random/TestCase_Core_Random.h"
 #include "core/log/TestCase_Core_Log.h"
+#include "core/log/TestCase_Core_LogPerf.h"
 #include "core/entity/TestCase_Core_Entity.h"
 #include "core/transcoder/TestCase_Core_Transcoder.h"
 #include "core/library/TestCase_Core_Library.h"
@@ -65,6 +68,25 @@
 #include "comm/TestCase_Comm_ExternalDriveSvc.h"
 #include "comm/TestCase_Comm_LazyTask.h"
 #include "comm/TestCase_Comm_CustomHeaderSvc.h"
+#include "comm/TestCase_Comm_PollerLatency.h"
+#include "comm/TestCase_Comm_Compress.h"
+#include "comm/TestCase_Comm_Broadcast.h"
+#include "comm/TestCase_Comm_ConcurrentSend.h"
+#include "comm/TestCase_Comm_EventDrivenSvc.h"
+#include "comm/TestCase_Comm_SendCoalesce.h"
+#include "comm/TestCase_Comm_ReusePortAccept.h"
+#include "comm/TestCase_Comm_PollerDecode.h"
+#include "comm/TestCase_Comm_TimingWheel.h"
+#include "comm/TestCase_Comm_PacketPool.h"
+#include "comm/TestCase_Comm_HeaderLayout.h"
+#include "comm/TestCase_Comm_UnixSocket.h"
+#include "comm/TestCase_Comm_LocalChannel.h"
+#include "comm/TestCase_Comm_ShmChannel.h"
+#include "comm/TestCase_Comm_GatherSend.h"
+#include "comm/TestCase_Comm_RecvBlockPool.h"
+#include "comm/TestCase_Comm_DataArrival.h"
+#include "comm/TestCase_Comm_DispatchTable.h"
+#include "comm/TestCase_Comm_SvcMetrics.h"
 
 extern int TestSuite_Main(int argc, char *argv[]);
 
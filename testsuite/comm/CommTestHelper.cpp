@@ -0,0 +1,374 @@
+/**
+ * @file    CommTestHelper.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+
+namespace
+{
+    const size_t __payloadHeadSize = sizeof(uint32) * 2;
+
+    inline uint8 __PatternByte(int seq, size_t idx)
+    {
+        return static_cast<uint8>(seq * 131 + idx * 7);
+    }
+
+    struct __TcpAddr
+    {
+        const char *ip;
+        int port;
+    };
+
+    int __ConnectTcp(LLBC_IService *server, LLBC_IService *client, const void *arg)
+    {
+        const __TcpAddr *addr = static_cast<const __TcpAddr *>(arg);
+        if (CommTestHelper::ListenAndStart(server, addr->ip, addr->port) == 0)
+            return 0;
+
+        return CommTestHelper::ConnectAndStart(client, addr->ip, addr->port);
+    }
+}
+
+CommTestHelper::SessionFacade::SessionFacade()
+: _sessionId(0)
+, _createdCount(0)
+, _destroyedCount(0)
+{
+}
+
+void CommTestHelper::SessionFacade::OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+{
+    if (sessionInfo.IsListenSession())
+        return;
+
+    _sessionId = sessionInfo.GetSessionId();
+    _createdCount += 1;
+}
+
+void CommTestHelper::SessionFacade::OnSessionDestroy(int sessionId)
+{
+    _destroyedCount += 1;
+}
+
+int CommTestHelper::SessionFacade::GetSessionId() const
+{
+    return _sessionId;
+}
+
+int CommTestHelper::SessionFacade::GetCreatedCount() const
+{
+    return _createdCount;
+}
+
+int CommTestHelper::SessionFacade::GetDestroyedCount() const
+{
+    return _destroyedCount;
+}
+
+CommTestHelper::EchoFacade::EchoFacade()
+: _recvCount(0)
+{
+}
+
+void CommTestHelper::EchoFacade::OnRecv(LLBC_Packet &packet)
+{
+    _recvCount += 1;
+
+    LLBC_Packet *resPacket = LLBC_New(LLBC_Packet);
+    resPacket->SetHeader(packet, packet.GetOpcode(), packet.GetStatus());
+    resPacket->Write(packet.GetPayload(), packet.GetPayloadLength());
+
+    this->GetService()->Send(resPacket);
+}
+
+int CommTestHelper::EchoFacade::GetRecvCount() const
+{
+    return _recvCount;
+}
+
+CommTestHelper::RecvFacade::RecvFacade()
+: _recvCount(0)
+, _matchedCount(0)
+{
+}
+
+void CommTestHelper::RecvFacade::OnRecv(LLBC_Packet &packet)
+{
+    int &nextSeq = _nextSeqs[packet.GetSessionId()];
+    if (CommTestHelper::VerifyPayload(packet.GetPayload(), packet.GetPayloadLength()) == nextSeq)
+        _matchedCount += 1;
+
+    nextSeq += 1;
+    _recvCount += 1;
+}
+
+int CommTestHelper::RecvFacade::GetRecvCount() const
+{
+    return _recvCount;
+}
+
+int CommTestHelper::RecvFacade::GetMatchedCount() const
+{
+    return _matchedCount;
+}
+
+CommTestHelper::PingFacade::PingFacade(int opcode, int pingTimes)
+: _opcode(opcode)
+, _pingTimes(pingTimes)
+, _finished(false)
+{
+    _rtts.reserve(pingTimes);
+}
+
+void CommTestHelper::PingFacade::OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+{
+    SessionFacade::OnSessionCreate(sessionInfo);
+    if (!sessionInfo.IsListenSession())
+        this->Ping(sessionInfo.GetSessionId());
+}
+
+void CommTestHelper::PingFacade::OnRecv(LLBC_Packet &packet)
+{
+    sint64 sendTime;
+    packet.Read(sendTime);
+
+    const sint64 now =
+        static_cast<sint64>(LLBC_CPUTime::Current().ToMicroSeconds());
+    _rtts.push_back(now - sendTime);
+
+    if (static_cast<int>(_rtts.size()) < _pingTimes)
+        this->Ping(packet.GetSessionId());
+    else
+        _finished = true;
+}
+
+bool CommTestHelper::PingFacade::IsFinished() const
+{
+    return _finished;
+}
+
+std::vector<sint64> &CommTestHelper::PingFacade::GetRTTs()
+{
+    return _rtts;
+}
+
+void CommTestHelper::PingFacade::Ping(int sessionId)
+{
+    LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+    packet->SetHeader(sessionId, _opcode, 0);
+    packet->Write(static_cast<sint64>(LLBC_CPUTime::Current().ToMicroSeconds()));
+
+    this->GetService()->Send(packet);
+}
+
+void CommTestHelper::BuildPayload(int seq, size_t size, LLBC_MessageBlock &payload)
+{
+    size = MAX(size, __payloadHeadSize);
+
+    const uint32 head[2] = {static_cast<uint32>(seq), static_cast<uint32>(size)};
+    payload.Write(head, sizeof(head));
+    for (size_t i = __payloadHeadSize; i < size; i++)
+    {
+        const uint8 b = __PatternByte(seq, i);
+        payload.Write(&b, sizeof(b));
+    }
+}
+
+int CommTestHelper::VerifyPayload(const void *data, size_t len)
+{
+    if (data == NULL || len < __payloadHeadSize)
+        return -1;
+
+    uint32 head[2];
+    LLBC_MemCpy(head, data, sizeof(head));
+    if (head[1] != len)
+        return -1;
+
+    const int seq = static_cast<int>(head[0]);
+    const uint8 *bytes = reinterpret_cast<const uint8 *>(data);
+    for (size_t i = __payloadHeadSize; i < len; i++)
+    {
+        if (bytes[i] != __PatternByte(seq, i))
+            return -1;
+    }
+
+    return seq;
+}
+
+size_t CommTestHelper::GetPayloadSize(int seq, size_t maxSize)
+{
+    maxSize = MAX(maxSize, __payloadHeadSize);
+    return __payloadHeadSize + (static_cast<size_t>(seq) * 2654435761u) % (maxSize - __payloadHeadSize + 1);
+}
+
+int CommTestHelper::SendPayloads(LLBC_IService *svc, int sessionId, int opcode, int count, size_t maxSize, int firstSeq)
+{
+    for (int seq = firstSeq; seq < firstSeq + count; seq++)
+    {
+        LLBC_MessageBlock payload;
+        BuildPayload(seq, GetPayloadSize(seq, maxSize), payload);
+
+        LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+        packet->SetHeader(sessionId, opcode, 0);
+        packet->Write(payload.GetData(), payload.GetWritePos());
+
+        if (svc->Send(packet) != LLBC_RTN_OK)
+        {
+            LLBC_FilePrintLine(stderr, "Send payload %d failed, err: %s", seq, LLBC_FormatLastError());
+            return LLBC_RTN_FAILED;
+        }
+    }
+
+    return LLBC_RTN_OK;
+}
+
+int CommTestHelper::ListenAndStart(LLBC_IService *svc, const char *ip, int port)
+{
+    const int sessionId = svc->Listen(ip, port);
+    if (sessionId == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Listen on %s:%d failed, err: %s",
+            ip, port, LLBC_FormatLastError());
+        return 0;
+    }
+
+    if (!svc->IsStarted() && svc->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start service failed, err: %s", LLBC_FormatLastError());
+        return 0;
+    }
+
+    return sessionId;
+}
+
+int CommTestHelper::ConnectAndStart(LLBC_IService *svc, const char *ip, int port)
+{
+    const int sessionId = svc->Connect(ip, port);
+    if (sessionId == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Connect to %s:%d failed, err: %s",
+            ip, port, LLBC_FormatLastError());
+        return 0;
+    }
+
+    if (!svc->IsStarted() && svc->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start service failed, err: %s", LLBC_FormatLastError());
+        return 0;
+    }
+
+    return sessionId;
+}
+
+int CommTestHelper::RunEchoCheck(const char *tag,
+                                 LLBC_IService *server,
+                                 LLBC_IService *client,
+                                 Connector connector,
+                                 const void *arg,
+                                 int opcode,
+                                 int packetCount,
+                                 size_t maxPayloadSize)
+{
+    EchoFacade *echoFacade = LLBC_New(EchoFacade);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(opcode, echoFacade, &EchoFacade::OnRecv);
+
+    RecvFacade *recvFacade = LLBC_New(RecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(opcode, recvFacade, &RecvFacade::OnRecv);
+
+    server->SetId(1);
+    client->SetId(2);
+
+    const int sessionId = (*connector)(server, client, arg);
+    if (sessionId == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Pattern payloads echo back intact and in order.
+    WaitFor(echoFacade, &SessionFacade::GetCreatedCount, 1);
+    bool passed = SendPayloads(client, sessionId, opcode, packetCount, maxPayloadSize) == LLBC_RTN_OK;
+
+    WaitFor(recvFacade, &RecvFacade::GetRecvCount, packetCount);
+    passed = Check(passed && echoFacade->GetCreatedCount() == 1 && recvFacade->GetMatchedCount() == packetCount,
+        "[%s] accepted %d, echo %d packets(payload <= %lu bytes), recv %d, matched %d",
+        tag, echoFacade->GetCreatedCount(), packetCount, static_cast<ulong>(maxPayloadSize),
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount());
+
+    // Client remove session, both sides sessions destroyed.
+    client->RemoveSession(sessionId);
+    WaitFor(echoFacade, &SessionFacade::GetDestroyedCount, 1);
+    WaitFor(recvFacade, &SessionFacade::GetDestroyedCount, 1);
+    passed = Check(echoFacade->GetDestroyedCount() == 1 && recvFacade->GetDestroyedCount() == 1,
+        "[%s] client remove session, server destroyed %d, client destroyed %d",
+        tag, echoFacade->GetDestroyedCount(), recvFacade->GetDestroyedCount()) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int CommTestHelper::RunEchoCheck(const char *tag,
+                                 LLBC_IService *server,
+                                 LLBC_IService *client,
+                                 const char *ip,
+                                 int port,
+                                 int opcode,
+                                 int packetCount,
+                                 size_t maxPayloadSize)
+{
+    __TcpAddr addr;
+    addr.ip = ip;
+    addr.port = port;
+
+    return RunEchoCheck(tag, server, client, &__ConnectTcp, &addr, opcode, packetCount, maxPayloadSize);
+}
+
+bool CommTestHelper::Check(bool cond, const char *fmt, ...)
+{
+    char buf[512];
+
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+
+    LLBC_PrintLine("%s %s", cond ? "[PASS]" : "[FAIL]", buf);
+
+    return cond;
+}
+
+void CommTestHelper::PrintRTTs(const char *tag, std::vector<sint64> &rtts, sint64 usedTime)
+{
+    if (rtts.empty())
+    {
+        LLBC_PrintLine("[%s] no round trip", tag);
+        return;
+    }
+
+    std::sort(rtts.begin(), rtts.end());
+
+    sint64 totalRtt = 0;
+    for (size_t i = 0; i < rtts.size(); i++)
+        totalRtt += rtts[i];
+
+    LLBC_PrintLine("[%s] %d round trips used %lld ms, rtt(us): avg %lld, min %lld, p50 %lld, p99 %lld, max %lld",
+        tag,
+        static_cast<int>(rtts.size()),
+        usedTime,
+        totalRtt / static_cast<sint64>(rtts.size()),
+        rtts.front(),
+        rtts[rtts.size() / 2],
+        rtts[rtts.size() * 99 / 100],
+        rtts.back());
+}
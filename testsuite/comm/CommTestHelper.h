@@ -0,0 +1,234 @@
+/**
+ * @file    CommTestHelper.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The communication module testcases shared scaffold(facades, payload verify, check helpers).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_TEST_HELPER_H__
+#define __LLBC_TEST_CASE_COMM_TEST_HELPER_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+/**
+ * \brief The communication testcases helper class encapsulation.
+ *
+ *        Pattern payload layout: [uint32 seq][uint32 length][pattern bytes...],
+ *        the pattern bytes derived from seq, so receiver can verify payload without any context.
+ */
+class CommTestHelper
+{
+public:
+    /**
+     * Session facade, record session create/destroy count, and the last connected session Id.
+     */
+    class SessionFacade : public LLBC_IFacade
+    {
+    public:
+        SessionFacade();
+
+    public:
+        virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo);
+        virtual void OnSessionDestroy(int sessionId);
+
+    public:
+        int GetSessionId() const;
+        int GetCreatedCount() const;
+        int GetDestroyedCount() const;
+
+    private:
+        volatile int _sessionId;
+        volatile int _createdCount;
+        volatile int _destroyedCount;
+    };
+
+    /**
+     * Echo facade, echo every subscribed packet back to sender, keep opcode, status and payload.
+     */
+    class EchoFacade : public SessionFacade
+    {
+    public:
+        EchoFacade();
+
+    public:
+        void OnRecv(LLBC_Packet &packet);
+
+    public:
+        int GetRecvCount() const;
+
+    private:
+        volatile int _recvCount;
+    };
+
+    /**
+     * Recv facade, verify received pattern payloads, a payload matched only when it intact and
+     * in order(per session, every session sequence start from 0).
+     */
+    class RecvFacade : public SessionFacade
+    {
+    public:
+        RecvFacade();
+
+    public:
+        void OnRecv(LLBC_Packet &packet);
+
+    public:
+        int GetRecvCount() const;
+        int GetMatchedCount() const;
+
+    private:
+        volatile int _recvCount;
+        volatile int _matchedCount;
+
+        std::map<int, int> _nextSeqs;
+    };
+
+    /**
+     * Ping facade, ping-pong timestamp packets with peer and collect round trip times(in micro-seconds),
+     * the first ping will send when connected session created.
+     */
+    class PingFacade : public SessionFacade
+    {
+    public:
+        PingFacade(int opcode, int pingTimes);
+
+    public:
+        virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo);
+        void OnRecv(LLBC_Packet &packet);
+
+    public:
+        bool IsFinished() const;
+        std::vector<sint64> &GetRTTs();
+
+    private:
+        void Ping(int sessionId);
+
+    private:
+        int _opcode;
+        int _pingTimes;
+        volatile bool _finished;
+
+        std::vector<sint64> _rtts;
+    };
+
+public:
+    /**
+     * Build pattern payload.
+     * @param[in]  seq     - the payload sequence.
+     * @param[in]  size    - the payload size, at least 8 bytes.
+     * @param[out] payload - the payload.
+     */
+    static void BuildPayload(int seq, size_t size, LLBC_MessageBlock &payload);
+
+    /**
+     * Verify pattern payload.
+     * @param[in] data - the payload data.
+     * @param[in] len  - the payload length.
+     * @return int - the payload sequence, if payload broken, return -1.
+     */
+    static int VerifyPayload(const void *data, size_t len);
+
+    /**
+     * Get the pattern payload size of given sequence, size vary from 8 bytes to maxSize bytes.
+     */
+    static size_t GetPayloadSize(int seq, size_t maxSize);
+
+    /**
+     * Send pattern payloads, sequence from firstSeq to firstSeq + count - 1.
+     * @return int - return 0 if success, otherwise return -1.
+     */
+    static int SendPayloads(LLBC_IService *svc, int sessionId, int opcode, int count, size_t maxSize, int firstSeq = 0);
+
+public:
+    /**
+     * Listen and start service.
+     * @return int - the listen session Id, if failed, return 0.
+     */
+    static int ListenAndStart(LLBC_IService *svc, const char *ip, int port);
+
+    /**
+     * Connect to server and start service(if not start).
+     * @return int - the connected session Id, if failed, return 0.
+     */
+    static int ConnectAndStart(LLBC_IService *svc, const char *ip, int port);
+
+    /**
+     * Listen on server and connect from client, both services must be started when return.
+     * @return int - the client connected session Id, if failed, return 0.
+     */
+    typedef int (*Connector)(LLBC_IService *server, LLBC_IService *client, const void *arg);
+
+    /**
+     * Run echo round trip check, the parameterised case shared by transports and service modes:
+     * server echo client sent pattern payloads, client verify echoed payloads intact and in order,
+     * then client remove session, both sides sessions must be destroyed.
+     * @param[in] tag            - the check tag, print as check result prefix.
+     * @param[in] server         - the configured, not started server service, deleted when check finished.
+     * @param[in] client         - the configured, not started client service, deleted when check finished.
+     * @param[in] connector      - the listen and connect function.
+     * @param[in] arg            - the connector argument.
+     * @param[in] opcode         - the payload packets opcode.
+     * @param[in] packetCount    - the payload packets count.
+     * @param[in] maxPayloadSize - the max payload size.
+     * @return int - return 0 if all checks passed, otherwise return -1.
+     */
+    static int RunEchoCheck(const char *tag,
+                            LLBC_IService *server,
+                            LLBC_IService *client,
+                            Connector connector,
+                            const void *arg,
+                            int opcode,
+                            int packetCount,
+                            size_t maxPayloadSize);
+
+    /**
+     * Run echo round trip check on tcp transport, server listen on ip:port.
+     */
+    static int RunEchoCheck(const char *tag,
+                            LLBC_IService *server,
+                            LLBC_IService *client,
+                            const char *ip,
+                            int port,
+                            int opcode,
+                            int packetCount,
+                            size_t maxPayloadSize);
+
+    /**
+     * Wait until condition satisfied or timeout.
+     * @return bool - return true if condition satisfied, otherwise return false.
+     */
+    template <typename ObjType, typename GetterObjType>
+    static bool WaitFor(const ObjType *obj, int (GetterObjType::*getter)() const, int expected, int timeout = 5000)
+    {
+        const sint64 timeoutTime = LLBC_GetMilliSeconds() + timeout;
+        while ((obj->*getter)() < expected && LLBC_GetMilliSeconds() < timeoutTime)
+            LLBC_Sleep(1);
+
+        return (obj->*getter)() >= expected;
+    }
+
+    template <typename ObjType, typename CondObjType>
+    static bool WaitFor(const ObjType *obj, bool (CondObjType::*cond)() const, int timeout = 5000)
+    {
+        const sint64 timeoutTime = LLBC_GetMilliSeconds() + timeout;
+        while (!(obj->*cond)() && LLBC_GetMilliSeconds() < timeoutTime)
+            LLBC_Sleep(1);
+
+        return (obj->*cond)();
+    }
+
+    /**
+     * Print check result, format: [PASS] xxx or [FAIL] xxx.
+     * @return bool - the check result.
+     */
+    static bool Check(bool cond, const char *fmt, ...);
+
+    /**
+     * Print round trip times statistics.
+     */
+    static void PrintRTTs(const char *tag, std::vector<sint64> &rtts, sint64 usedTime);
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_TEST_HELPER_H__
@@ -0,0 +1,398 @@
+/**
+ * @file    TestCase_Comm_Broadcast.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_Broadcast.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+const int STATUS = 3;
+
+const int CHECK_SESSION_COUNT = 20;
+const int CHECK_PACKET_COUNT = 50;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 8192;
+
+class ServerFacade : public LLBC_IFacade
+{
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        if (!sessionInfo.IsListenSession())
+        {
+            LLBC_Guard guard(_lock);
+            _sessionIds.push_back(sessionInfo.GetSessionId());
+        }
+    }
+
+public:
+    LLBC_SessionIdList GetSessionIds()
+    {
+        LLBC_Guard guard(_lock);
+        return _sessionIds;
+    }
+
+private:
+    LLBC_SpinLock _lock;
+    LLBC_SessionIdList _sessionIds;
+};
+
+class ClientFacade : public LLBC_IFacade
+{
+public:
+    ClientFacade()
+    : _recvCount(0)
+    , _recvBytes(0)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        _recvCount += 1;
+        _recvBytes += static_cast<sint64>(packet.GetPayloadLength());
+    }
+
+public:
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    sint64 GetRecvBytes() const
+    {
+        return _recvBytes;
+    }
+
+private:
+    volatile int _recvCount;
+    volatile sint64 _recvBytes;
+};
+
+/**
+ * Pattern recv facade, verify every session received pattern payloads intact and in order.
+ */
+class PatternRecvFacade : public LLBC_IFacade
+{
+public:
+    PatternRecvFacade()
+    : _recvCount(0)
+    , _matchedCount(0)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        _recvCount += 1;
+
+        int &nextSeq = _nextSeqs[packet.GetSessionId()];
+        if (CommTestHelper::VerifyPayload(packet.GetPayload(), packet.GetPayloadLength()) == nextSeq &&
+            packet.GetOpcode() == OPCODE && packet.GetStatus() == STATUS)
+            _matchedCount += 1;
+
+        nextSeq += 1;
+    }
+
+public:
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    int GetMatchedCount() const
+    {
+        return _matchedCount;
+    }
+
+private:
+    volatile int _recvCount;
+    volatile int _matchedCount;
+
+    std::map<int, int> _nextSeqs;
+};
+
+/**
+ * Wait client received specific packets count, return used time, in microseconds.
+ */
+sint64 WaitRecv(ClientFacade *facade, int count, sint64 begTime)
+{
+    while (facade->GetRecvCount() < count)
+    {
+        if (LLBC_CPUTime::Current().ToMicroSeconds() - begTime > 30 * 1000000)
+            return -1;
+
+        LLBC_ThreadManager::Sleep(1);
+    }
+
+    return LLBC_CPUTime::Current().ToMicroSeconds() - begTime;
+}
+
+}
+
+TestCase_Comm_Broadcast::TestCase_Comm_Broadcast()
+: _server(NULL)
+, _client(NULL)
+, _serverFacade(NULL)
+, _clientFacade(NULL)
+
+, _runIp("127.0.0.1")
+, _runPort(7788)
+, _maxSessionCount(5000)
+, _payloadSize(4096)
+, _loopTimes(10)
+{
+}
+
+TestCase_Comm_Broadcast::~TestCase_Comm_Broadcast()
+{
+}
+
+int TestCase_Comm_Broadcast::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Broadcast cost benchmark:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _maxSessionCount = MAX(1, LLBC_Str2Int32(argv[3]));
+    if (argc >= 5)
+        _payloadSize = MAX(1, LLBC_Str2Int32(argv[4]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [maxSessionCount=5000] [payloadSize=4096]");
+    LLBC_PrintLine("Run on %s:%d, max sessions: %d, payload size: %d, loop times: %d",
+        _runIp.c_str(), _runPort, _maxSessionCount, _payloadSize, _loopTimes);
+
+    if (this->RunShareCheck() != LLBC_RTN_OK ||
+        this->RunBroadcastCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_IService *server = _server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = _client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    ServerFacade *serverFacade = LLBC_New(ServerFacade);
+    server->RegisterFacade(_serverFacade = serverFacade);
+
+    ClientFacade *clientFacade = LLBC_New(ClientFacade);
+    client->RegisterFacade(_clientFacade = clientFacade);
+    client->Subscribe(OPCODE, clientFacade, &ClientFacade::OnRecv);
+
+    if (server->Listen(_runIp.c_str(), _runPort) == 0 ||
+        server->Start() != LLBC_RTN_OK ||
+        client->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start services failed, err: %s", LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    int ret = LLBC_RTN_OK;
+    int sessionCount = 10;
+    for (; sessionCount < _maxSessionCount; sessionCount *= 10)
+    {
+        if ((ret = this->RunBenchmark(sessionCount)) != LLBC_RTN_OK)
+            break;
+    }
+
+    if (ret == LLBC_RTN_OK)
+        ret = this->RunBenchmark(_maxSessionCount);
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_Broadcast::RunShareCheck()
+{
+    const char data[] = "llbc shared payload";
+
+    LLBC_MessageBlock *block = LLBC_New(LLBC_MessageBlock);
+    block->Write(data, sizeof(data));
+
+    LLBC_MessageBlock *view = block->Share();
+    bool passed = CommTestHelper::Check(block->IsShared() && view->IsShared() &&
+        view->GetData() == block->GetData() && view->GetWritePos() == sizeof(data),
+        "Share block: both blocks shared, same buffer, write pos %lu",
+        static_cast<ulong>(view->GetWritePos()));
+
+    const bool writeRejected = view->Write(data, sizeof(data)) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_PERM;
+    const bool allocRejected = block->Allocate(1024) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_PERM;
+    passed = CommTestHelper::Check(writeRejected && allocRejected && view->GetWritePos() == sizeof(data),
+        "Shared blocks read only: Write rejected %s, Allocate rejected %s",
+        writeRejected ? "true" : "false", allocRejected ? "true" : "false") && passed;
+
+    // Delete the original block, the view still hold the buffer.
+    LLBC_Delete(block);
+    passed = CommTestHelper::Check(memcmp(view->GetData(), data, sizeof(data)) == 0,
+        "Shared buffer alive after original block deleted") && passed;
+
+    LLBC_Delete(view);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_Broadcast::RunBroadcastCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    ServerFacade *serverFacade = LLBC_New(ServerFacade);
+    server->RegisterFacade(serverFacade);
+
+    PatternRecvFacade *recvFacade = LLBC_New(PatternRecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(OPCODE, recvFacade, &PatternRecvFacade::OnRecv);
+
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    for (int i = 1; i < CHECK_SESSION_COUNT; i++)
+        client->Connect(_runIp.c_str(), _runPort);
+
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 5000;
+    while (static_cast<int>(serverFacade->GetSessionIds().size()) < CHECK_SESSION_COUNT &&
+           LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+
+    const LLBC_SessionIdList sessionIds = serverFacade->GetSessionIds();
+    bool passed = CommTestHelper::Check(static_cast<int>(sessionIds.size()) == CHECK_SESSION_COUNT,
+        "Connect %d sessions, server accepted %lu",
+        CHECK_SESSION_COUNT, static_cast<ulong>(sessionIds.size()));
+
+    // Broadcast, every session receive all shared payloads, intact and in order.
+    for (int seq = 0; seq < CHECK_PACKET_COUNT; seq++)
+    {
+        LLBC_MessageBlock payload;
+        CommTestHelper::BuildPayload(seq, CommTestHelper::GetPayloadSize(seq, CHECK_MAX_PAYLOAD_SIZE), payload);
+        passed = (server->Broadcast(OPCODE, payload.GetData(), payload.GetWritePos(), STATUS) == LLBC_RTN_OK) && passed;
+    }
+
+    int expectCount = static_cast<int>(sessionIds.size()) * CHECK_PACKET_COUNT;
+    CommTestHelper::WaitFor(recvFacade, &PatternRecvFacade::GetRecvCount, expectCount);
+    passed = CommTestHelper::Check(recvFacade->GetRecvCount() == expectCount &&
+        recvFacade->GetMatchedCount() == expectCount,
+        "Broadcast %d packets to %lu sessions, recv %d, matched %d, expect %d",
+        CHECK_PACKET_COUNT, static_cast<ulong>(sessionIds.size()),
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount(), expectCount) && passed;
+
+    // Multicast to half sessions, the other sessions receive nothing.
+    const LLBC_SessionIdList halfSessionIds(sessionIds.begin(), sessionIds.begin() + sessionIds.size() / 2);
+    for (int seq = CHECK_PACKET_COUNT; seq < CHECK_PACKET_COUNT * 2; seq++)
+    {
+        LLBC_MessageBlock payload;
+        CommTestHelper::BuildPayload(seq, CommTestHelper::GetPayloadSize(seq, CHECK_MAX_PAYLOAD_SIZE), payload);
+        passed = (server->Multicast(halfSessionIds, OPCODE, payload.GetData(), payload.GetWritePos(), STATUS) == LLBC_RTN_OK) && passed;
+    }
+
+    expectCount += static_cast<int>(halfSessionIds.size()) * CHECK_PACKET_COUNT;
+    CommTestHelper::WaitFor(recvFacade, &PatternRecvFacade::GetRecvCount, expectCount);
+    LLBC_Sleep(100);
+    passed = CommTestHelper::Check(recvFacade->GetRecvCount() == expectCount &&
+        recvFacade->GetMatchedCount() == expectCount,
+        "Multicast %d packets to %lu sessions, total recv %d, matched %d, expect %d",
+        CHECK_PACKET_COUNT, static_cast<ulong>(halfSessionIds.size()),
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount(), expectCount) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_Broadcast::RunBenchmark(int sessionCount)
+{
+    ServerFacade *serverFacade = static_cast<ServerFacade *>(_serverFacade);
+    ClientFacade *clientFacade = static_cast<ClientFacade *>(_clientFacade);
+
+    // Connect to specific session count, and wait server accept all sessions.
+    for (int i = static_cast<int>(serverFacade->GetSessionIds().size()); i < sessionCount; i++)
+    {
+        if (_client->Connect(_runIp.c_str(), _runPort) == 0)
+        {
+            LLBC_FilePrintLine(stderr, "Connect to %s:%d failed, err: %s",
+                _runIp.c_str(), _runPort, LLBC_FormatLastError());
+            return LLBC_RTN_FAILED;
+        }
+    }
+
+    while (static_cast<int>(serverFacade->GetSessionIds().size()) < sessionCount)
+        LLBC_ThreadManager::Sleep(1);
+
+    const LLBC_SessionIdList sessionIds = serverFacade->GetSessionIds();
+    LLBC_String payload(_payloadSize, 'x');
+
+    // Shared payload broadcast.
+    sint64 callTime = 0;
+    int expectRecvCount = clientFacade->GetRecvCount();
+    sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        const sint64 callBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        _server->Broadcast(OPCODE, payload.data(), payload.size(), 0);
+        callTime += LLBC_CPUTime::Current().ToMicroSeconds() - callBegTime;
+    }
+
+    expectRecvCount += static_cast<int>(sessionIds.size()) * _loopTimes;
+    const sint64 sharedUsedTime = WaitRecv(clientFacade, expectRecvCount, begTime);
+    const sint64 sharedCallTime = callTime;
+
+    // Per-session copy send.
+    callTime = 0;
+    begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        const sint64 callBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        for (size_t j = 0; j < sessionIds.size(); j++)
+            _server->Send(sessionIds[j], OPCODE, payload.data(), payload.size(), 0);
+        callTime += LLBC_CPUTime::Current().ToMicroSeconds() - callBegTime;
+    }
+
+    expectRecvCount += static_cast<int>(sessionIds.size()) * _loopTimes;
+    const sint64 copyUsedTime = WaitRecv(clientFacade, expectRecvCount, begTime);
+    const sint64 copyCallTime = callTime;
+
+    if (sharedUsedTime < 0 || copyUsedTime < 0)
+    {
+        LLBC_FilePrintLine(stderr, "Wait broadcast packets timeout, sessions: %d", sessionCount);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_PrintLine("[sessions %5lu] shared broadcast: call %8lld us(%5lld ns/session), deliver %6lld ms; "
+                   "per-session copy: call %8lld us(%5lld ns/session), deliver %6lld ms",
+        static_cast<ulong>(sessionIds.size()),
+        sharedCallTime / _loopTimes,
+        sharedCallTime * 1000 / _loopTimes / static_cast<sint64>(sessionIds.size()),
+        sharedUsedTime / 1000,
+        copyCallTime / _loopTimes,
+        copyCallTime * 1000 / _loopTimes / static_cast<sint64>(sessionIds.size()),
+        copyUsedTime / 1000);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file    TestCase_Comm_Broadcast.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library broadcast testcase, check shared payload broadcast/multicast delivery,
+ *          and benchmark broadcast cost(shared payload vs per-session copy).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_BROADCAST_H__
+#define __LLBC_TEST_CASE_COMM_BROADCAST_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_Broadcast : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_Broadcast();
+    virtual ~TestCase_Comm_Broadcast();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunShareCheck();
+    int RunBroadcastCheck();
+
+    int RunBenchmark(int sessionCount);
+
+private:
+    LLBC_IService *_server;
+    LLBC_IService *_client;
+    LLBC_IFacade *_serverFacade;
+    LLBC_IFacade *_clientFacade;
+
+    LLBC_String _runIp;
+    int _runPort;
+    int _maxSessionCount;
+    int _payloadSize;
+    int _loopTimes;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_BROADCAST_H__
@@ -0,0 +1,309 @@
+/**
+ * @file    TestCase_Comm_Compress.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_Compress.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+const int USER_FLAGS = 0x7ffe;
+// Full width flags, include the highest bit(sign extended when get).
+const int FULL_FLAGS = -1;
+
+const int LOOPBACK_PACKET_COUNT = 200;
+const size_t LOOPBACK_MAX_PAYLOAD_SIZE = 32 * 1024;
+
+const size_t PAYLOAD_SIZES[] = {64, 256, 1024, 4096, 16384, 65536};
+const int PAYLOAD_SIZE_COUNT = sizeof(PAYLOAD_SIZES) / sizeof(PAYLOAD_SIZES[0]);
+
+/**
+ * Build representative payload, simulate the entity state sync packet:
+ * entity id, entity type, position and a name pick from small dictionary.
+ */
+void BuildPayload(size_t size, LLBC_MessageBlock &payload)
+{
+    static const char *names[] = {"player", "monster", "npc", "pet", "bullet", "item"};
+
+    uint32 seed = 1024;
+    for (uint32 id = 10000; payload.GetWritePos() < size; id++)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        const uint16 type = static_cast<uint16>(seed % 6);
+        const float pos[3] = {static_cast<float>(seed % 1000),
+                              static_cast<float>((seed >> 8) % 1000),
+                              static_cast<float>((seed >> 16) % 64)};
+
+        payload.Write(&id, sizeof(id));
+        payload.Write(&type, sizeof(type));
+        payload.Write(pos, sizeof(pos));
+        payload.Write(names[type], LLBC_StrLen(names[type]));
+    }
+
+    payload.SetWritePos(size);
+}
+
+/**
+ * Echo packets, check packets flags are sender's flags.
+ */
+class FlagsEchoFacade : public CommTestHelper::EchoFacade
+{
+public:
+    FlagsEchoFacade(int flags)
+    : _flags(flags)
+    , _flagsMatchedCount(0)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        if (packet.GetFlags() == _flags)
+            _flagsMatchedCount += 1;
+
+        EchoFacade::OnRecv(packet);
+    }
+
+public:
+    int GetFlagsMatchedCount() const
+    {
+        return _flagsMatchedCount;
+    }
+
+private:
+    const int _flags;
+    volatile int _flagsMatchedCount;
+};
+
+}
+
+TestCase_Comm_Compress::TestCase_Comm_Compress()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _loopTimes(10000)
+{
+}
+
+TestCase_Comm_Compress::~TestCase_Comm_Compress()
+{
+}
+
+int TestCase_Comm_Compress::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Packet payload compress test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _loopTimes = MAX(1, LLBC_Str2Int32(argv[3]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [loopTimes=10000]");
+    LLBC_PrintLine("Run on %s:%d, loop times: %d", _runIp.c_str(), _runPort, _loopTimes);
+
+    if (this->RunCompressorCheck() != LLBC_RTN_OK ||
+        this->RunFlagsCheck() != LLBC_RTN_OK ||
+        this->RunLoopbackCheck(false) != LLBC_RTN_OK ||
+        this->RunLoopbackCheck(true) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Compressor benchmark:");
+    const int levels[] = {1, 6};
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        for (int j = 0; j < PAYLOAD_SIZE_COUNT; j++)
+        {
+            if (this->RunCompressorBenchmark(levels[i], PAYLOAD_SIZES[j]) != LLBC_RTN_OK)
+                return LLBC_RTN_FAILED;
+        }
+    }
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_Compress::RunCompressorCheck()
+{
+    LLBC_ZlibCompressor compressor;
+
+    bool passed = true;
+    for (int i = 0; i < PAYLOAD_SIZE_COUNT; i++)
+    {
+        LLBC_MessageBlock payload;
+        BuildPayload(PAYLOAD_SIZES[i], payload);
+
+        LLBC_MessageBlock compressed, decompressed;
+        const bool roundTrip =
+            compressor.Compress(payload.GetData(), payload.GetWritePos(), compressed) == LLBC_RTN_OK &&
+            compressor.Decompress(compressed.GetData(), compressed.GetWritePos(), decompressed) == LLBC_RTN_OK &&
+            decompressed.GetWritePos() == payload.GetWritePos() &&
+            ::memcmp(decompressed.GetData(), payload.GetData(), payload.GetWritePos()) == 0;
+
+        passed = CommTestHelper::Check(roundTrip,
+            "Compress round trip, payload %lu bytes -> %lu bytes",
+            static_cast<ulong>(payload.GetWritePos()), static_cast<ulong>(compressed.GetWritePos())) && passed;
+    }
+
+    // Malformed compressed data must be rejected.
+    LLBC_MessageBlock payload, compressed, decompressed;
+    BuildPayload(4096, payload);
+    compressor.Compress(payload.GetData(), payload.GetWritePos(), compressed);
+
+    const char garbage[] = {0x00, 0x00, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    passed = CommTestHelper::Check(
+        compressor.Decompress(compressed.GetData(), 2, decompressed) != LLBC_RTN_OK &&
+        compressor.Decompress(compressed.GetData(), compressed.GetWritePos() / 2, decompressed) != LLBC_RTN_OK &&
+        compressor.Decompress(garbage, sizeof(garbage), decompressed) != LLBC_RTN_OK,
+        "Decompress malformed data failed") && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_Compress::RunFlagsCheck()
+{
+    LLBC_Packet packet;
+
+    // Packet flags are full width, compressed mark only reserved by the service which set compressor.
+    packet.SetFlags(FULL_FLAGS);
+    bool passed = CommTestHelper::Check(packet.GetFlags() == FULL_FLAGS,
+        "Set full width flags, get flags: 0x%x", packet.GetFlags());
+
+    // Compressed mark is the highest flag bit, set/clear it not affect other flags.
+    packet.SetFlags(USER_FLAGS);
+    packet.SetPayloadCompressed(true);
+    passed = CommTestHelper::Check(packet.IsPayloadCompressed() && packet.HasFlags(USER_FLAGS),
+        "Set compressed mark, flags: 0x%x", packet.GetFlags()) && passed;
+
+    packet.SetPayloadCompressed(false);
+    passed = CommTestHelper::Check(packet.GetFlags() == USER_FLAGS && !packet.IsPayloadCompressed(),
+        "Clear compressed mark, flags: 0x%x", packet.GetFlags()) && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_Compress::RunLoopbackCheck(bool compress)
+{
+    // Compression off, full width flags must pass through, otherwise the highest flag bit reserved.
+    const int flags = compress ? USER_FLAGS : FULL_FLAGS;
+
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    FlagsEchoFacade *echoFacade = LLBC_New1(FlagsEchoFacade, flags);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(OPCODE, echoFacade, &FlagsEchoFacade::OnRecv);
+
+    CommTestHelper::RecvFacade *recvFacade = LLBC_New(CommTestHelper::RecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(OPCODE, recvFacade, &CommTestHelper::RecvFacade::OnRecv);
+
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        if (compress)
+            svcs[i]->SetCompressor(LLBC_New(LLBC_ZlibCompressorFactory));
+    }
+
+    int sessionId = 0;
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        (sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort)) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    bool passed = true;
+    for (int seq = 0; seq < LOOPBACK_PACKET_COUNT; seq++)
+    {
+        LLBC_MessageBlock payload;
+        CommTestHelper::BuildPayload(
+            seq, CommTestHelper::GetPayloadSize(seq, LOOPBACK_MAX_PAYLOAD_SIZE), payload);
+
+        LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+        packet->SetHeader(sessionId, OPCODE, 0);
+        packet->SetFlags(flags);
+        packet->Write(payload.GetData(), payload.GetWritePos());
+
+        passed = (client->Send(packet) == LLBC_RTN_OK) && passed;
+    }
+
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::RecvFacade::GetRecvCount, LOOPBACK_PACKET_COUNT);
+    passed = CommTestHelper::Check(recvFacade->GetMatchedCount() == LOOPBACK_PACKET_COUNT,
+        "%s echo %d packets, recv %d, matched %d", compress ? "Compressed" : "Uncompressed",
+        LOOPBACK_PACKET_COUNT, recvFacade->GetRecvCount(), recvFacade->GetMatchedCount()) && passed;
+    passed = CommTestHelper::Check(echoFacade->GetFlagsMatchedCount() == LOOPBACK_PACKET_COUNT,
+        "%s echo flags 0x%x kept in %d packets", compress ? "Compressed" : "Uncompressed",
+        flags, echoFacade->GetFlagsMatchedCount()) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_Compress::RunCompressorBenchmark(int level, size_t payloadSize)
+{
+    LLBC_MessageBlock payload;
+    BuildPayload(payloadSize, payload);
+
+    LLBC_ZlibCompressor compressor(level);
+    LLBC_MessageBlock compressed;
+    LLBC_MessageBlock decompressed;
+
+    // Compress.
+    const sint64 compBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        compressed.SetWritePos(0);
+        if (compressor.Compress(payload.GetData(), payloadSize, compressed) != LLBC_RTN_OK)
+        {
+            LLBC_FilePrintLine(stderr, "Compress failed, err: %s", LLBC_FormatLastError());
+            return LLBC_RTN_FAILED;
+        }
+    }
+    const sint64 compUsedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - compBegTime);
+
+    // Decompress.
+    const sint64 decompBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        decompressed.SetWritePos(0);
+        if (compressor.Decompress(compressed.GetData(), compressed.GetWritePos(), decompressed) != LLBC_RTN_OK)
+        {
+            LLBC_FilePrintLine(stderr, "Decompress failed, err: %s", LLBC_FormatLastError());
+            return LLBC_RTN_FAILED;
+        }
+    }
+    const sint64 decompUsedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - decompBegTime);
+
+    if (decompressed.GetWritePos() != payloadSize ||
+        ::memcmp(decompressed.GetData(), payload.GetData(), payloadSize) != 0)
+    {
+        LLBC_FilePrintLine(stderr, "Decompressed data mismatch, payload size: %lu", static_cast<ulong>(payloadSize));
+        return LLBC_RTN_FAILED;
+    }
+
+    const double totalMB = static_cast<double>(payloadSize) * _loopTimes / (1024 * 1024);
+    LLBC_PrintLine("[zlib level %d] payload %6lu bytes -> %6lu bytes, ratio %.3f, compress %.1f MB/s, decompress %.1f MB/s",
+        level,
+        static_cast<ulong>(payloadSize),
+        static_cast<ulong>(compressed.GetWritePos()),
+        static_cast<double>(compressed.GetWritePos()) / payloadSize,
+        totalMB * 1000000 / compUsedTime,
+        totalMB * 1000000 / decompUsedTime);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file    TestCase_Comm_Compress.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library packet payload compress testcase, check compressor round trip,
+ *          the reserved compressed flag bit and compressed loopback echo, and then benchmark
+ *          compressor throughput/ratio.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_COMPRESS_H__
+#define __LLBC_TEST_CASE_COMM_COMPRESS_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_Compress : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_Compress();
+    virtual ~TestCase_Comm_Compress();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunCompressorCheck();
+    int RunFlagsCheck();
+    int RunLoopbackCheck(bool compress);
+
+    int RunCompressorBenchmark(int level, size_t payloadSize);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _loopTimes;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_COMPRESS_H__
@@ -0,0 +1,548 @@
+/**
+ * @file    TestCase_Comm_ConcurrentSend.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_ConcurrentSend.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+const int MAX_THREAD_NUM = 16;
+
+const int CHECK_THREAD_NUM = 4;
+const int CHECK_PACKETS_PER_THREAD = 2000;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 1024;
+
+/**
+ * \brief The sync data coder, simulate the entity state sync packet, encode cost is not ignorable.
+ */
+struct SyncData : public LLBC_ICoder
+{
+    sint32 entityId;
+    sint32 attrs[32];
+    LLBC_String name;
+
+    virtual void Encode(LLBC_Packet &packet)
+    {
+        packet <<entityId;
+        for (int i = 0; i < 32; i++)
+            packet <<attrs[i];
+        packet <<name;
+    }
+
+    virtual void Decode(LLBC_Packet &packet)
+    {
+        packet >>entityId;
+        for (int i = 0; i < 32; i++)
+            packet >>attrs[i];
+        packet >>name;
+    }
+};
+
+class RecvFacade : public LLBC_IFacade
+{
+public:
+    RecvFacade()
+    : _recvCount(0)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        _recvCount += 1;
+    }
+
+public:
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+private:
+    volatile int _recvCount;
+};
+
+/**
+ * \brief The stop facade, stop its service in service thread when recv packet.
+ */
+class StopFacade : public LLBC_IFacade
+{
+public:
+    StopFacade()
+    : _stopReturned(false)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        GetService()->Stop();
+        _stopReturned = true;
+    }
+
+public:
+    bool IsStopReturned() const
+    {
+        return _stopReturned;
+    }
+
+private:
+    volatile bool _stopReturned;
+};
+
+/**
+ * \brief The sender task, all threads wait start flag, then send packets to itself session.
+ *        In serialized mode, all send calls guard by one lock, simulate service-wide lock send path.
+ */
+class SenderTask : public LLBC_BaseTask
+{
+public:
+    SenderTask(LLBC_IService *svc, const LLBC_SessionIdList &sessionIds, int threadNum, int packetsPerThread, bool serialized)
+    : _svc(svc)
+    , _sessionIds(sessionIds)
+    , _threadNum(threadNum)
+    , _packetsPerThread(packetsPerThread)
+    , _serialized(serialized)
+
+    , _nextSender(0)
+    , _started(false)
+    , _finishedCount(0)
+    , _finishTime(0)
+    , _cleanuped(false)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        const int senderIdx = LLBC_AtomicFetchAndAdd(&_nextSender, 1);
+        const int sessionId = _sessionIds[senderIdx % _sessionIds.size()];
+
+        while (!_started)
+            LLBC_ThreadManager::CPURelax();
+
+        for (int i = 0; i < _packetsPerThread; i++)
+        {
+            SyncData *data = LLBC_New(SyncData);
+            data->entityId = i;
+            for (int j = 0; j < 32; j++)
+                data->attrs[j] = i * j;
+            data->name = "entity";
+
+            if (_serialized)
+            {
+                LLBC_Guard guard(_lock);
+                _svc->Send(sessionId, OPCODE, data, 0);
+            }
+            else
+            {
+                _svc->Send(sessionId, OPCODE, data, 0);
+            }
+        }
+
+        if (LLBC_AtomicFetchAndAdd(&_finishedCount, 1) + 1 == _threadNum)
+            _finishTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    }
+
+    virtual void Cleanup()
+    {
+        _cleanuped = true;
+    }
+
+public:
+    void WaitReady()
+    {
+        while (_nextSender < _threadNum)
+            LLBC_ThreadManager::Sleep(1);
+    }
+
+    void Start()
+    {
+        _started = true;
+    }
+
+    /**
+     * Wait all sender threads stopped, Cleanup() called by the last stopped thread.
+     */
+    void WaitStopped()
+    {
+        this->Wait();
+        while (!_cleanuped)
+            LLBC_ThreadManager::Sleep(1);
+    }
+
+    sint64 GetFinishTime() const
+    {
+        return _finishTime;
+    }
+
+private:
+    LLBC_IService *_svc;
+    const LLBC_SessionIdList &_sessionIds;
+    int _threadNum;
+    int _packetsPerThread;
+    bool _serialized;
+
+    volatile sint32 _nextSender;
+    volatile bool _started;
+    volatile sint32 _finishedCount;
+    volatile sint64 _finishTime;
+    volatile bool _cleanuped;
+
+    LLBC_RecursiveLock _lock;
+};
+
+/**
+ * \brief The check sender task, every thread send pattern payloads to itself session.
+ *        If packets count is -1, keep sending until send failed(service stopped).
+ */
+class CheckSenderTask : public LLBC_BaseTask
+{
+public:
+    CheckSenderTask(LLBC_IService *svc, const LLBC_SessionIdList &sessionIds, int packetsPerThread)
+    : _svc(svc)
+    , _sessionIds(sessionIds)
+    , _packetsPerThread(packetsPerThread)
+
+    , _nextSender(0)
+    , _failedCount(0)
+    , _unexpectedErrCount(0)
+    , _finishedCount(0)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        const int senderIdx = LLBC_AtomicFetchAndAdd(&_nextSender, 1);
+        const int sessionId = _sessionIds[senderIdx % _sessionIds.size()];
+
+        if (_packetsPerThread >= 0)
+        {
+            if (CommTestHelper::SendPayloads(_svc, sessionId, OPCODE,
+                    _packetsPerThread, CHECK_MAX_PAYLOAD_SIZE) != LLBC_RTN_OK)
+                LLBC_AtomicFetchAndAdd(&_failedCount, 1);
+        }
+        else
+        {
+            // Send until service stopped, send calls during stopping must fail cleanly.
+            while (_svc->Send(sessionId, OPCODE, "stopping", 8, 0) == LLBC_RTN_OK)
+                ;
+
+            LLBC_AtomicFetchAndAdd(&_failedCount, 1);
+            const int err = LLBC_GetLastError();
+            if (err != LLBC_ERROR_NOT_INIT && err != LLBC_ERROR_NOT_FOUND)
+                LLBC_AtomicFetchAndAdd(&_unexpectedErrCount, 1);
+        }
+
+        LLBC_AtomicFetchAndAdd(&_finishedCount, 1);
+    }
+
+    virtual void Cleanup()
+    {
+    }
+
+public:
+    int GetFailedCount() const
+    {
+        return _failedCount;
+    }
+
+    int GetUnexpectedErrCount() const
+    {
+        return _unexpectedErrCount;
+    }
+
+    int GetFinishedCount() const
+    {
+        return _finishedCount;
+    }
+
+private:
+    LLBC_IService *_svc;
+    const LLBC_SessionIdList &_sessionIds;
+    int _packetsPerThread;
+
+    volatile sint32 _nextSender;
+    volatile sint32 _failedCount;
+    volatile sint32 _unexpectedErrCount;
+    volatile sint32 _finishedCount;
+};
+
+/**
+ * Create server/client services, and connect sessions.
+ */
+int StartServices(const LLBC_String &ip,
+                  int port,
+                  int sessionCount,
+                  LLBC_IService *&server,
+                  LLBC_IService *&client,
+                  CommTestHelper::RecvFacade *&recvFacade,
+                  LLBC_SessionIdList &sessionIds)
+{
+    server = LLBC_IService::Create(LLBC_IService::Normal);
+    client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    recvFacade = LLBC_New(CommTestHelper::RecvFacade);
+    server->RegisterFacade(recvFacade);
+    server->Subscribe(OPCODE, recvFacade, &CommTestHelper::RecvFacade::OnRecv);
+
+    if (CommTestHelper::ListenAndStart(server, ip.c_str(), port) == 0)
+        return LLBC_RTN_FAILED;
+
+    for (int i = 0; i < sessionCount; i++)
+    {
+        const int sessionId = CommTestHelper::ConnectAndStart(client, ip.c_str(), port);
+        if (sessionId == 0)
+            return LLBC_RTN_FAILED;
+
+        sessionIds.push_back(sessionId);
+    }
+
+    return LLBC_RTN_OK;
+}
+
+}
+
+TestCase_Comm_ConcurrentSend::TestCase_Comm_ConcurrentSend()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _packetsPerThread(100000)
+
+, _server(NULL)
+, _client(NULL)
+, _recvFacade(NULL)
+, _sessionIds()
+{
+}
+
+TestCase_Comm_ConcurrentSend::~TestCase_Comm_ConcurrentSend()
+{
+}
+
+int TestCase_Comm_ConcurrentSend::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Multi threads concurrent send test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _packetsPerThread = MAX(1, LLBC_Str2Int32(argv[3]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [packetsPerThread=100000]");
+    LLBC_PrintLine("Run on %s:%d, packets per thread: %d", _runIp.c_str(), _runPort, _packetsPerThread);
+
+    if (this->RunOrderCheck() != LLBC_RTN_OK ||
+        this->RunStopCheck() != LLBC_RTN_OK ||
+        this->RunStopInSvcThreadCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    _server = LLBC_IService::Create(LLBC_IService::Normal);
+    _client = LLBC_IService::Create(LLBC_IService::Normal);
+    _server->SetId(1);
+    _client->SetId(2);
+
+    RecvFacade *recvFacade = LLBC_New(RecvFacade);
+    _server->RegisterFacade(_recvFacade = recvFacade);
+    _server->Subscribe(OPCODE, recvFacade, &RecvFacade::OnRecv);
+
+    int ret = LLBC_RTN_OK;
+    if (_server->Listen(_runIp.c_str(), _runPort) == 0 ||
+        _server->Start() != LLBC_RTN_OK ||
+        _client->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start services failed, err: %s", LLBC_FormatLastError());
+        ret = LLBC_RTN_FAILED;
+    }
+
+    // Every sender thread use itself session.
+    for (int i = 0; ret == LLBC_RTN_OK && i < MAX_THREAD_NUM; i++)
+    {
+        const int sessionId = _client->Connect(_runIp.c_str(), _runPort);
+        if (sessionId == 0)
+        {
+            LLBC_FilePrintLine(stderr, "Connect to %s:%d failed, err: %s",
+                _runIp.c_str(), _runPort, LLBC_FormatLastError());
+            ret = LLBC_RTN_FAILED;
+        }
+
+        _sessionIds.push_back(sessionId);
+    }
+
+    const int threadNums[] = {1, 4, 16};
+    for (size_t i = 0; ret == LLBC_RTN_OK && i < sizeof(threadNums) / sizeof(threadNums[0]); i++)
+    {
+        if (this->RunBenchmark(true, threadNums[i]) != LLBC_RTN_OK ||
+            this->RunBenchmark(false, threadNums[i]) != LLBC_RTN_OK)
+            ret = LLBC_RTN_FAILED;
+    }
+
+    LLBC_Delete(_client);
+    LLBC_Delete(_server);
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return ret;
+}
+
+int TestCase_Comm_ConcurrentSend::RunOrderCheck()
+{
+    LLBC_IService *server = NULL, *client = NULL;
+    CommTestHelper::RecvFacade *recvFacade = NULL;
+    LLBC_SessionIdList sessionIds;
+    if (StartServices(_runIp, _runPort, CHECK_THREAD_NUM, server, client, recvFacade, sessionIds) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Concurrent send through one service, every session's packets intact and in order.
+    CheckSenderTask sender(client, sessionIds, CHECK_PACKETS_PER_THREAD);
+    sender.Activate(CHECK_THREAD_NUM);
+    sender.Wait();
+
+    const int expectCount = CHECK_THREAD_NUM * CHECK_PACKETS_PER_THREAD;
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::RecvFacade::GetRecvCount, expectCount, 10000);
+    const bool passed = CommTestHelper::Check(sender.GetFailedCount() == 0 &&
+        recvFacade->GetRecvCount() == expectCount &&
+        recvFacade->GetMatchedCount() == expectCount,
+        "%d threads concurrent send %d packets each, send failed threads %d, recv %d, matched %d",
+        CHECK_THREAD_NUM, CHECK_PACKETS_PER_THREAD, sender.GetFailedCount(),
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount());
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_ConcurrentSend::RunStopCheck()
+{
+    LLBC_IService *server = NULL, *client = NULL;
+    CommTestHelper::RecvFacade *recvFacade = NULL;
+    LLBC_SessionIdList sessionIds;
+    if (StartServices(_runIp, _runPort, CHECK_THREAD_NUM, server, client, recvFacade, sessionIds) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Stop service while other threads sending, all in-flight sends finished, later sends fail.
+    CheckSenderTask sender(client, sessionIds, -1);
+    sender.Activate(CHECK_THREAD_NUM);
+
+    LLBC_Sleep(50);
+    client->Stop();
+    sender.Wait();
+
+    const bool sendAfterStopFailed = client->Send(sessionIds[0], OPCODE, "stopped", 7, 0) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_NOT_INIT;
+    const bool passed = CommTestHelper::Check(sender.GetFinishedCount() == CHECK_THREAD_NUM &&
+        sender.GetUnexpectedErrCount() == 0 && sendAfterStopFailed,
+        "Stop while %d threads sending, finished threads %d, unexpected errors %d, send after stop failed %s",
+        CHECK_THREAD_NUM, sender.GetFinishedCount(), sender.GetUnexpectedErrCount(),
+        sendAfterStopFailed ? "true" : "false");
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_ConcurrentSend::RunStopInSvcThreadCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    StopFacade *stopFacade = LLBC_New(StopFacade);
+    server->RegisterFacade(stopFacade);
+    server->Subscribe(OPCODE, stopFacade, &StopFacade::OnRecv);
+
+    int sessionId = 0;
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        (sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort)) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Stop in service thread(facade callback) must return at once, service thread exit loop later.
+    client->Send(sessionId, OPCODE, "stop", 4, 0);
+    CommTestHelper::WaitFor(stopFacade, &StopFacade::IsStopReturned);
+    for (int waited = 0; server->IsStarted() && waited < 5000; waited += 10)
+        LLBC_Sleep(10);
+
+    const bool passed = CommTestHelper::Check(stopFacade->IsStopReturned() && !server->IsStarted(),
+        "Stop in service thread, stop returned %s, service stopped %s",
+        stopFacade->IsStopReturned() ? "true" : "false", !server->IsStarted() ? "true" : "false");
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_ConcurrentSend::RunBenchmark(bool serialized, int threadNum)
+{
+    RecvFacade *recvFacade = static_cast<RecvFacade *>(_recvFacade);
+
+    const int totalPackets = threadNum * _packetsPerThread;
+    const int expectRecvCount = recvFacade->GetRecvCount() + totalPackets;
+
+    SenderTask sender(_client, _sessionIds, threadNum, _packetsPerThread, serialized);
+    if (sender.Activate(threadNum) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Activate sender task failed, err: %s", LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+
+    sender.WaitReady();
+
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    sender.Start();
+    sender.WaitStopped();
+
+    const sint64 sendUsedTime = MAX(1, sender.GetFinishTime() - begTime);
+    while (recvFacade->GetRecvCount() < expectRecvCount)
+    {
+        if (LLBC_CPUTime::Current().ToMicroSeconds() - begTime > 60 * 1000000)
+        {
+            LLBC_FilePrintLine(stderr, "Wait packets timeout, recv: %d/%d",
+                recvFacade->GetRecvCount(), expectRecvCount);
+            return LLBC_RTN_FAILED;
+        }
+
+        LLBC_ThreadManager::Sleep(1);
+    }
+
+    const sint64 deliverUsedTime = LLBC_CPUTime::Current().ToMicroSeconds() - begTime;
+    LLBC_PrintLine("[%-10s] threads: %2d, packets: %8d, send: %8lld us(%.2f Mpkts/s), deliver: %6lld ms",
+        serialized ? "serialized" : "concurrent",
+        threadNum,
+        totalPackets,
+        sendUsedTime,
+        static_cast<double>(totalPackets) / sendUsedTime,
+        deliverUsedTime / 1000);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file    TestCase_Comm_ConcurrentSend.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library multi threads concurrent send testcase, check per-session ordering
+ *          and stop while sending, then benchmark concurrent send.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_CONCURRENT_SEND_H__
+#define __LLBC_TEST_CASE_COMM_CONCURRENT_SEND_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_ConcurrentSend : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_ConcurrentSend();
+    virtual ~TestCase_Comm_ConcurrentSend();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunOrderCheck();
+    int RunStopCheck();
+    int RunStopInSvcThreadCheck();
+
+    int RunBenchmark(bool serialized, int threadNum);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _packetsPerThread;
+
+    LLBC_IService *_server;
+    LLBC_IService *_client;
+    LLBC_IFacade *_recvFacade;
+    LLBC_SessionIdList _sessionIds;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_CONCURRENT_SEND_H__
@@ -0,0 +1,162 @@
+/**
+ * @file    TestCase_Comm_DataArrival.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_DataArrival.h"
+
+namespace
+{
+    const int OPCODE = 1;
+
+    const int PACKET_COUNT = 500;
+    const size_t MAX_PAYLOAD_SIZE = 32;
+
+    /**
+     * Remove session when specific sequence packet received, record packets dispatched after removed.
+     */
+    class RemoveFacade : public CommTestHelper::SessionFacade
+    {
+    public:
+        RemoveFacade(int removeSeq)
+        : _removeSeq(removeSeq)
+        , _recvCount(0)
+        , _removed(false)
+        , _recvAfterRemoved(0)
+        {
+        }
+
+    public:
+        void OnRecv(LLBC_Packet &packet)
+        {
+            _recvCount += 1;
+            if (_removed)
+            {
+                _recvAfterRemoved += 1;
+                return;
+            }
+
+            if (CommTestHelper::VerifyPayload(packet.GetPayload(), packet.GetPayloadLength()) == _removeSeq)
+            {
+                this->GetService()->RemoveSession(packet.GetSessionId());
+                _removed = true;
+            }
+        }
+
+    public:
+        int GetRecvCount() const
+        {
+            return _recvCount;
+        }
+
+        bool IsRemoved() const
+        {
+            return _removed;
+        }
+
+        int GetRecvAfterRemoved() const
+        {
+            return _recvAfterRemoved;
+        }
+
+    private:
+        int _removeSeq;
+
+        volatile int _recvCount;
+        volatile bool _removed;
+        volatile int _recvAfterRemoved;
+    };
+}
+
+TestCase_Comm_DataArrival::TestCase_Comm_DataArrival()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+{
+}
+
+TestCase_Comm_DataArrival::~TestCase_Comm_DataArrival()
+{
+}
+
+int TestCase_Comm_DataArrival::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Data arrival batch dispatch test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788]");
+    LLBC_PrintLine("Run on %s:%d", _runIp.c_str(), _runPort);
+
+    if (this->RunBatchCheck() != LLBC_RTN_OK ||
+        this->RunRemoveInBatchCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_DataArrival::RunBatchCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    // All packets of one batch dispatched in order, so echoed back in order.
+    return CommTestHelper::RunEchoCheck("Batch", server, client, _runIp.c_str(), _runPort,
+        OPCODE, PACKET_COUNT, MAX_PAYLOAD_SIZE);
+}
+
+int TestCase_Comm_DataArrival::RunRemoveInBatchCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    const int removeSeq = 10;
+    RemoveFacade *removeFacade = LLBC_New1(RemoveFacade, removeSeq);
+    server->RegisterFacade(removeFacade);
+    server->Subscribe(OPCODE, removeFacade, &RemoveFacade::OnRecv);
+
+    CommTestHelper::SessionFacade *clientFacade = LLBC_New(CommTestHelper::SessionFacade);
+    client->RegisterFacade(clientFacade);
+
+    server->SetId(1);
+    client->SetId(2);
+
+    int sessionId = 0;
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        (sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort)) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Handler remove session in the middle of batch, the remain packets must be dropped.
+    bool passed = CommTestHelper::SendPayloads(client, sessionId, OPCODE,
+        PACKET_COUNT, MAX_PAYLOAD_SIZE) == LLBC_RTN_OK;
+
+    CommTestHelper::WaitFor(removeFacade, &RemoveFacade::IsRemoved);
+    CommTestHelper::WaitFor(clientFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, 1);
+    CommTestHelper::WaitFor(removeFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, 1);
+    passed = CommTestHelper::Check(removeFacade->IsRemoved() && removeFacade->GetRecvAfterRemoved() == 0,
+        "Remove session at packet %d, recv %d, recv after removed %d",
+        removeSeq, removeFacade->GetRecvCount(), removeFacade->GetRecvAfterRemoved()) && passed;
+
+    passed = CommTestHelper::Check(removeFacade->GetDestroyedCount() == 1 && clientFacade->GetDestroyedCount() == 1,
+        "Session destroyed, server destroy %d, client destroy %d",
+        removeFacade->GetDestroyedCount(), clientFacade->GetDestroyedCount()) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
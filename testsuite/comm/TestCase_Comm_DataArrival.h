@@ -0,0 +1,34 @@
+/**
+ * @file    TestCase_Comm_DataArrival.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The data arrival event batch dispatch testcase, check the remain packets of
+ *          one batch not dispatched after session removed by handler.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_DATA_ARRIVAL_H__
+#define __LLBC_TEST_CASE_COMM_DATA_ARRIVAL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_DataArrival : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_DataArrival();
+    virtual ~TestCase_Comm_DataArrival();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBatchCheck();
+    int RunRemoveInBatchCheck();
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_DATA_ARRIVAL_H__
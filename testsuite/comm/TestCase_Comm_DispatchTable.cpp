@@ -0,0 +1,300 @@
+/**
+ * @file    TestCase_Comm_DispatchTable.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_DispatchTable.h"
+
+namespace
+{
+    const int OPCODE = 1;
+    const int SPARSE_OPCODE = 30000;
+    const int UNHANDLED_OPCODE = 2;
+
+    const int STATUS = 7;
+    const char *STATUS_DESC = "dispatch table test status";
+
+    const int PACKET_COUNT = 100;
+
+    /**
+     * Dispatch facade, count every handler/pre-handler/status handler invoke times.
+     */
+    class DispatchFacade : public CommTestHelper::SessionFacade
+    {
+    public:
+        DispatchFacade()
+        : _handled(0)
+        , _sparseHandled(0)
+        , _statusHandled(0)
+        , _statusDescMatched(0)
+        , _preHandled(0)
+        , _unifyPreHandled(0)
+        , _unhandled(0)
+        {
+        }
+
+    public:
+        void OnRecv(LLBC_Packet &packet)
+        {
+            _handled += 1;
+        }
+
+        void OnSparseRecv(LLBC_Packet &packet)
+        {
+            _sparseHandled += 1;
+        }
+
+        void OnStatusRecv(LLBC_Packet &packet)
+        {
+            _statusHandled += 1;
+            if (packet.GetStatusDesc() == STATUS_DESC)
+                _statusDescMatched += 1;
+        }
+
+        void *OnPreRecv(LLBC_Packet &packet)
+        {
+            _preHandled += 1;
+            return this;
+        }
+
+        void *OnUnifyPreRecv(LLBC_Packet &packet)
+        {
+            _unifyPreHandled += 1;
+            return this;
+        }
+
+        virtual void OnUnHandledPacket(int opcode)
+        {
+            _unhandled += 1;
+        }
+
+    public:
+        int GetHandled() const { return _handled; }
+        int GetSparseHandled() const { return _sparseHandled; }
+        int GetStatusHandled() const { return _statusHandled; }
+        int GetStatusDescMatched() const { return _statusDescMatched; }
+        int GetPreHandled() const { return _preHandled; }
+        int GetUnifyPreHandled() const { return _unifyPreHandled; }
+        int GetUnhandled() const { return _unhandled; }
+
+    private:
+        volatile int _handled;
+        volatile int _sparseHandled;
+        volatile int _statusHandled;
+        volatile int _statusDescMatched;
+        volatile int _preHandled;
+        volatile int _unifyPreHandled;
+        volatile int _unhandled;
+    };
+
+    int SendPackets(LLBC_IService *svc, int sessionId, int opcode, int status, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+            packet->SetHeader(sessionId, opcode, status);
+            packet->Write(i);
+
+            if (svc->Send(packet) != LLBC_RTN_OK)
+                return LLBC_RTN_FAILED;
+        }
+
+        return LLBC_RTN_OK;
+    }
+
+    template <typename _Key>
+    bool CheckTable(const char *name, const std::vector<_Key> &keys, const std::vector<_Key> &absentKeys, bool expectDirect)
+    {
+        std::map<_Key, int *> src;
+        std::vector<int> values(keys.size());
+        for (size_t i = 0; i < keys.size(); i++)
+            src.insert(std::make_pair(keys[i], &values[i]));
+
+        LLBC_DispatchTable<_Key, int> table;
+        table.Build(src);
+
+        int foundCount = 0;
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            if (table.Find(keys[i]) == &values[i])
+                foundCount += 1;
+        }
+
+        int absentCount = 0;
+        for (size_t i = 0; i < absentKeys.size(); i++)
+        {
+            if (table.Find(absentKeys[i]) == NULL)
+                absentCount += 1;
+        }
+
+        return CommTestHelper::Check(table.IsDirectIndexed() == expectDirect &&
+            table.GetSize() == keys.size() &&
+            foundCount == static_cast<int>(keys.size()) &&
+            absentCount == static_cast<int>(absentKeys.size()),
+            "%s table(%s): %d/%d keys found, %d/%d absent keys not found",
+            name, table.IsDirectIndexed() ? "direct" : "hash",
+            foundCount, static_cast<int>(keys.size()), absentCount, static_cast<int>(absentKeys.size()));
+    }
+}
+
+TestCase_Comm_DispatchTable::TestCase_Comm_DispatchTable()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+{
+}
+
+TestCase_Comm_DispatchTable::~TestCase_Comm_DispatchTable()
+{
+}
+
+int TestCase_Comm_DispatchTable::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service dispatch table test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788]");
+    LLBC_PrintLine("Run on %s:%d", _runIp.c_str(), _runPort);
+
+    if (this->RunTableCheck() != LLBC_RTN_OK ||
+        this->RunDispatchCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_DispatchTable::RunTableCheck()
+{
+    // Dense keys(include negative keys), use direct-indexed array.
+    std::vector<int> denseKeys, denseAbsentKeys;
+    for (int key = -50; key <= 50; key += 2)
+        denseKeys.push_back(key);
+    denseAbsentKeys.push_back(-51);
+    denseAbsentKeys.push_back(-49);
+    denseAbsentKeys.push_back(51);
+    denseAbsentKeys.push_back(INT_MIN);
+    denseAbsentKeys.push_back(INT_MAX);
+
+    bool passed = CheckTable("Dense", denseKeys, denseAbsentKeys, true);
+
+    // Sparse keys, use open-addressing hash table.
+    std::vector<int> sparseKeys, sparseAbsentKeys;
+    for (int i = 0; i < 1000; i++)
+    {
+        sparseKeys.push_back(i * 100003);
+        sparseAbsentKeys.push_back(i * 100003 + 1);
+    }
+    sparseKeys.push_back(INT_MIN);
+    sparseKeys.push_back(INT_MAX);
+    sparseKeys.push_back(-1);
+    sparseAbsentKeys.push_back(-2);
+
+    passed = CheckTable("Sparse", sparseKeys, sparseAbsentKeys, false) && passed;
+
+    // Status handler keys, (opcode << 32 | status), opcode/status may be negative.
+    std::vector<sint64> statusKeys, statusAbsentKeys;
+    const int opcodes[] = {-2, -1, 0, 1, 60000};
+    const int statuses[] = {-7, 0, 7};
+    for (size_t i = 0; i < sizeof(opcodes) / sizeof(opcodes[0]); i++)
+    {
+        for (size_t j = 0; j < sizeof(statuses) / sizeof(statuses[0]); j++)
+        {
+            const uint64 key = (static_cast<uint64>(static_cast<uint32>(opcodes[i])) << 32) |
+                static_cast<uint32>(statuses[j]);
+            statusKeys.push_back(static_cast<sint64>(key));
+            statusAbsentKeys.push_back(static_cast<sint64>(key + 1));
+        }
+    }
+
+    passed = CheckTable("Status key", statusKeys, statusAbsentKeys, false) && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_DispatchTable::RunDispatchCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    DispatchFacade *facade = LLBC_New(DispatchFacade);
+    server->RegisterFacade(facade);
+    server->Subscribe(OPCODE, facade, &DispatchFacade::OnRecv);
+    server->Subscribe(SPARSE_OPCODE, facade, &DispatchFacade::OnSparseRecv);
+    server->PreSubscribe(SPARSE_OPCODE, facade, &DispatchFacade::OnPreRecv);
+    server->UnifyPreSubscribe(facade, &DispatchFacade::OnUnifyPreRecv);
+    server->SubscribeStatus(OPCODE, STATUS, facade, &DispatchFacade::OnStatusRecv);
+    server->RegisterStatusDesc(STATUS, STATUS_DESC);
+
+    server->SetId(1);
+    client->SetId(2);
+
+    int sessionId = 0;
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        (sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort)) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // After Start(), dispatch tables frozen, all registrations must fail.
+    const bool subRejected = server->Subscribe(UNHANDLED_OPCODE, facade, &DispatchFacade::OnRecv) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_INITED;
+    const bool preSubRejected = server->PreSubscribe(OPCODE, facade, &DispatchFacade::OnPreRecv) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_INITED;
+    const bool unifyPreSubRejected = server->UnifyPreSubscribe(facade, &DispatchFacade::OnPreRecv) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_INITED;
+    const bool statusSubRejected = server->SubscribeStatus(SPARSE_OPCODE, STATUS, facade, &DispatchFacade::OnStatusRecv) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_INITED;
+    const bool statusDescRejected = server->RegisterStatusDesc(STATUS + 1, STATUS_DESC) != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_INITED;
+
+    bool passed = CommTestHelper::Check(subRejected && preSubRejected &&
+        unifyPreSubRejected && statusSubRejected && statusDescRejected,
+        "Register after Start() rejected: Subscribe %s, PreSubscribe %s, UnifyPreSubscribe %s, SubscribeStatus %s, RegisterStatusDesc %s",
+        subRejected ? "true" : "false", preSubRejected ? "true" : "false",
+        unifyPreSubRejected ? "true" : "false", statusSubRejected ? "true" : "false",
+        statusDescRejected ? "true" : "false");
+
+    // Dispatch through frozen tables, late registrations take no effect.
+    passed = (SendPackets(client, sessionId, OPCODE, 0, PACKET_COUNT) == LLBC_RTN_OK &&
+        SendPackets(client, sessionId, OPCODE, STATUS, PACKET_COUNT) == LLBC_RTN_OK &&
+        SendPackets(client, sessionId, SPARSE_OPCODE, 0, PACKET_COUNT) == LLBC_RTN_OK &&
+        SendPackets(client, sessionId, UNHANDLED_OPCODE, 0, PACKET_COUNT) == LLBC_RTN_OK) && passed;
+
+    CommTestHelper::WaitFor(facade, &DispatchFacade::GetUnhandled, PACKET_COUNT);
+    LLBC_Sleep(100);
+
+    passed = CommTestHelper::Check(facade->GetHandled() == PACKET_COUNT &&
+        facade->GetSparseHandled() == PACKET_COUNT &&
+        facade->GetUnhandled() == PACKET_COUNT,
+        "Handlers: opcode %d handled %d, sparse opcode %d handled %d, unsubscribed opcode %d unhandled %d, expect %d",
+        OPCODE, facade->GetHandled(), SPARSE_OPCODE, facade->GetSparseHandled(),
+        UNHANDLED_OPCODE, facade->GetUnhandled(), PACKET_COUNT) && passed;
+
+    passed = CommTestHelper::Check(facade->GetStatusHandled() == PACKET_COUNT &&
+        facade->GetStatusDescMatched() == PACKET_COUNT,
+        "Status handler: status %d handled %d, status desc matched %d, expect %d",
+        STATUS, facade->GetStatusHandled(), facade->GetStatusDescMatched(), PACKET_COUNT) && passed;
+
+    passed = CommTestHelper::Check(facade->GetPreHandled() == PACKET_COUNT &&
+        facade->GetUnifyPreHandled() == PACKET_COUNT * 2,
+        "Pre-handlers: pre-handled %d(expect %d), unify pre-handled %d(expect %d)",
+        facade->GetPreHandled(), PACKET_COUNT, facade->GetUnifyPreHandled(), PACKET_COUNT * 2) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
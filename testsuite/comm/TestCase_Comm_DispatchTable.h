@@ -0,0 +1,34 @@
+/**
+ * @file    TestCase_Comm_DispatchTable.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The service dispatch table testcase, check table lookup, subscribe after Start()
+ *          rejected and packets dispatch through frozen tables.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_DISPATCH_TABLE_H__
+#define __LLBC_TEST_CASE_COMM_DISPATCH_TABLE_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_DispatchTable : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_DispatchTable();
+    virtual ~TestCase_Comm_DispatchTable();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunTableCheck();
+    int RunDispatchCheck();
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_DISPATCH_TABLE_H__
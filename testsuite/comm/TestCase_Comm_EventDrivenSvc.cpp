@@ -0,0 +1,284 @@
+/**
+ * @file    TestCase_Comm_EventDrivenSvc.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_EventDrivenSvc.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+
+const int CHECK_PACKET_COUNT = 200;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 4096;
+
+const int POST_TIMES = 20;
+
+/**
+ * Post task, record the latency from Post() called to task executed in service thread.
+ */
+class PostTask
+{
+public:
+    PostTask()
+    : _postTime(0)
+    , _executedTimes(0)
+    , _maxLatency(0)
+    {
+    }
+
+public:
+    int Post(LLBC_IService *svc)
+    {
+        _postTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        return svc->Post(this, &PostTask::Execute);
+    }
+
+    void Execute(LLBC_IService *svc)
+    {
+        const sint64 latency = static_cast<sint64>(LLBC_CPUTime::Current().ToMicroSeconds() - _postTime);
+        _maxLatency = MAX(_maxLatency, latency);
+
+        _executedTimes += 1;
+    }
+
+public:
+    int GetExecutedTimes() const
+    {
+        return _executedTimes;
+    }
+
+    sint64 GetMaxLatency() const
+    {
+        return _maxLatency;
+    }
+
+private:
+    volatile LLBC_CPUTime::CPUTimeCount _postTime;
+    volatile int _executedTimes;
+    volatile sint64 _maxLatency;
+};
+
+/**
+ * Update facade, count OnUpdate() ticks.
+ */
+class UpdateFacade : public LLBC_IFacade
+{
+public:
+    UpdateFacade()
+    : _updateTimes(0)
+    {
+    }
+
+public:
+    virtual void OnUpdate()
+    {
+        _updateTimes += 1;
+    }
+
+public:
+    int GetUpdateTimes() const
+    {
+        return _updateTimes;
+    }
+
+private:
+    volatile int _updateTimes;
+};
+
+}
+
+TestCase_Comm_EventDrivenSvc::TestCase_Comm_EventDrivenSvc()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _requestTimes(200)
+{
+}
+
+TestCase_Comm_EventDrivenSvc::~TestCase_Comm_EventDrivenSvc()
+{
+}
+
+int TestCase_Comm_EventDrivenSvc::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service event-driven wakeup test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _requestTimes = MAX(1, LLBC_Str2Int32(argv[3]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [requestTimes=200]");
+    LLBC_PrintLine("Run on %s:%d, request times: %d", _runIp.c_str(), _runPort, _requestTimes);
+
+    if (this->RunEchoCheck() != LLBC_RTN_OK ||
+        this->RunPostWakeupCheck() != LLBC_RTN_OK ||
+        this->RunRestartCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (this->RunBenchmark(false, LLBC_CFG_COMM_DFT_SERVICE_FPS, _runPort) != LLBC_RTN_OK ||
+        this->RunBenchmark(false, LLBC_CFG_COMM_MAX_SERVICE_FPS, _runPort + 1) != LLBC_RTN_OK ||
+        this->RunBenchmark(true, LLBC_CFG_COMM_DFT_SERVICE_FPS, _runPort + 2) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_EventDrivenSvc::RunEchoCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetEventDriven(true);
+    client->SetEventDriven(true);
+
+    // Data arrival and session destroy events both wakeup service.
+    return CommTestHelper::RunEchoCheck("EventDriven", server, client, _runIp.c_str(), _runPort,
+        OPCODE, CHECK_PACKET_COUNT, CHECK_MAX_PAYLOAD_SIZE);
+}
+
+int TestCase_Comm_EventDrivenSvc::RunPostWakeupCheck()
+{
+    // No facades update, no timers, service only wakeup by events or max wait time.
+    LLBC_IService *svc = LLBC_IService::Create(LLBC_IService::Normal);
+    svc->SetId(1);
+    svc->SetEventDriven(true, false);
+
+    if (svc->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start service failed, err: %s", LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Post from main thread must wakeup the waiting service thread, not wait max wait time.
+    PostTask task;
+    bool passed = true;
+    for (int i = 0; i < POST_TIMES; i++)
+    {
+        LLBC_Sleep(10);
+        passed = (task.Post(svc) == LLBC_RTN_OK) && passed;
+        CommTestHelper::WaitFor(&task, &PostTask::GetExecutedTimes, i + 1);
+    }
+
+    passed = CommTestHelper::Check(task.GetExecutedTimes() == POST_TIMES &&
+        task.GetMaxLatency() < LLBC_CFG_COMM_EVENT_DRIVEN_MAX_WAIT_TIME * 1000 / 2,
+        "Post %d tasks from other thread, executed %d, max latency %lld us(max wait time %d ms)",
+        POST_TIMES, task.GetExecutedTimes(), task.GetMaxLatency(),
+        LLBC_CFG_COMM_EVENT_DRIVEN_MAX_WAIT_TIME) && passed;
+
+    LLBC_Delete(svc);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_EventDrivenSvc::RunRestartCheck()
+{
+    LLBC_IService *svc = LLBC_IService::Create(LLBC_IService::Normal);
+    svc->SetId(1);
+    svc->SetEventDriven(true);
+
+    UpdateFacade *facade = LLBC_New(UpdateFacade);
+    svc->RegisterFacade(facade);
+
+    // Run with 1 fps, next frame boundary far away(1 second) when stopped.
+    svc->SetFPS(1);
+    if (svc->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start service failed, err: %s", LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::WaitFor(facade, &UpdateFacade::GetUpdateTimes, 1);
+    svc->Stop();
+
+    // Restart with high fps, facades update must restart from first frame.
+    const int fps = 100;
+    const int runTime = 300;
+    svc->SetFPS(fps);
+    const int updateTimesBeforeRestart = facade->GetUpdateTimes();
+    if (svc->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Restart service failed, err: %s", LLBC_FormatLastError());
+        LLBC_Delete(svc);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_Sleep(runTime);
+    const int updateTimes = facade->GetUpdateTimes() - updateTimesBeforeRestart;
+    const bool passed = CommTestHelper::Check(updateTimes >= fps * runTime / 1000 / 3,
+        "Restart with fps %d, facades updated %d times in %d ms", fps, updateTimes, runTime);
+
+    LLBC_Delete(svc);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_EventDrivenSvc::RunBenchmark(bool eventDriven, int fps, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    CommTestHelper::EchoFacade *echoFacade = LLBC_New(CommTestHelper::EchoFacade);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(OPCODE, echoFacade, &CommTestHelper::EchoFacade::OnRecv);
+
+    CommTestHelper::PingFacade *pingFacade = LLBC_New2(CommTestHelper::PingFacade, OPCODE, _requestTimes);
+    client->RegisterFacade(pingFacade);
+    client->Subscribe(OPCODE, pingFacade, &CommTestHelper::PingFacade::OnRecv);
+
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        svcs[i]->SetFPS(fps);
+        svcs[i]->SetEventDriven(eventDriven);
+    }
+
+    // Measure idle cpu usage at first, then connect to start request/response.
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), port) == 0 ||
+        client->Start() != LLBC_RTN_OK)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    const clock_t idleBegClock = clock();
+    LLBC_Sleep(1000);
+    const double idleCpu = static_cast<double>(clock() - idleBegClock) * 100 / CLOCKS_PER_SEC;
+
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    if (CommTestHelper::ConnectAndStart(client, _runIp.c_str(), port) == 0 ||
+        !CommTestHelper::WaitFor(pingFacade, &CommTestHelper::PingFacade::IsFinished, 60000))
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_PrintLine("[%-11s fps %3d] idle cpu %5.1f%%",
+        eventDriven ? "EventDriven" : "FixedFPS", fps, idleCpu);
+    CommTestHelper::PrintRTTs(eventDriven ? "EventDriven" : "FixedFPS",
+        pingFacade->GetRTTs(), LLBC_GetMilliSeconds() - begTime);
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file    TestCase_Comm_EventDrivenSvc.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library service event-driven wakeup mode testcase, check echo, cross-thread
+ *          Post() wakeup and restart frame ticks, then benchmark request/response latency.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_EVENT_DRIVEN_SVC_H__
+#define __LLBC_TEST_CASE_COMM_EVENT_DRIVEN_SVC_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_EventDrivenSvc : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_EventDrivenSvc();
+    virtual ~TestCase_Comm_EventDrivenSvc();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunEchoCheck();
+    int RunPostWakeupCheck();
+    int RunRestartCheck();
+
+    int RunBenchmark(bool eventDriven, int fps, int port);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _requestTimes;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_EVENT_DRIVEN_SVC_H__
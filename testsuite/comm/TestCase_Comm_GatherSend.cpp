@@ -0,0 +1,160 @@
+/**
+ * @file    TestCase_Comm_GatherSend.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_GatherSend.h"
+
+namespace
+{
+    const int OPCODE = 1;
+
+    const size_t BIG_PAYLOAD_SIZE = 64 * 1024;
+    const size_t SMALL_PAYLOAD_SIZE = 16;
+
+    /**
+     * Send all pattern payloads when peer connected, raw service payload not framed,
+     * so peer will receive the payloads bytes stream directly.
+     * The big payloads fill up socket send buffer first, so the small payloads pile up in send queue.
+     */
+    class BurstFacade : public CommTestHelper::SessionFacade
+    {
+    public:
+        BurstFacade(int bigCount, int smallCount)
+        : _bigCount(bigCount)
+        , _smallCount(smallCount)
+        {
+        }
+
+    public:
+        virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+        {
+            SessionFacade::OnSessionCreate(sessionInfo);
+            if (sessionInfo.IsListenSession())
+                return;
+
+            LLBC_IService *svc = this->GetService();
+            CommTestHelper::SendPayloads(svc, sessionInfo.GetSessionId(), OPCODE, _bigCount, BIG_PAYLOAD_SIZE);
+            CommTestHelper::SendPayloads(svc, sessionInfo.GetSessionId(), OPCODE, _smallCount, SMALL_PAYLOAD_SIZE, _bigCount);
+        }
+
+    private:
+        int _bigCount;
+        int _smallCount;
+    };
+}
+
+TestCase_Comm_GatherSend::TestCase_Comm_GatherSend()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+{
+}
+
+TestCase_Comm_GatherSend::~TestCase_Comm_GatherSend()
+{
+}
+
+int TestCase_Comm_GatherSend::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Socket gather send test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788]");
+    LLBC_PrintLine("Run on %s:%d, IOV_MAX: %d", _runIp.c_str(), _runPort, LLBC_IOV_MAX);
+
+    // Big packets only: the send queue far exceed socket send buffer, writev() partial writes.
+    // Big packets + small packets: one writev() can not cover the whole piled up send queue.
+    if (this->RunCheck(256, 0) != LLBC_RTN_OK ||
+        this->RunCheck(256, LLBC_IOV_MAX * 4 + 7) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_GatherSend::RunCheck(int bigCount, int smallCount)
+{
+    const int packetCount = bigCount + smallCount;
+
+    LLBC_MessageBlock expected;
+    for (int seq = 0; seq < packetCount; seq++)
+        CommTestHelper::BuildPayload(seq, CommTestHelper::GetPayloadSize(
+            seq, seq < bigCount ? BIG_PAYLOAD_SIZE : SMALL_PAYLOAD_SIZE), expected);
+
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Raw);
+    server->RegisterFacade(LLBC_New2(BurstFacade, bigCount, smallCount));
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0)
+    {
+        LLBC_Delete(server);
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_SocketHandle handle = LLBC_CreateTcpSocket();
+    if (LLBC_ConnectToPeer(handle, LLBC_SockAddr_IN(_runIp.c_str(), _runPort)) != LLBC_RTN_OK ||
+        LLBC_SetNonBlocking(handle) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Connect to %s:%d failed, err: %s",
+            _runIp.c_str(), _runPort, LLBC_FormatLastError());
+
+        LLBC_CloseSocket(handle);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Not read for a while, let server send queue pile up.
+    LLBC_Sleep(300);
+
+    LLBC_MessageBlock recved;
+    RecvAll(handle, recved, expected.GetWritePos(), 10000);
+    LLBC_CloseSocket(handle);
+
+    uint64 sentPackets, sendSyscalls;
+    server->GetSendStats(sentPackets, sendSyscalls);
+    LLBC_Delete(server);
+
+    bool passed = CommTestHelper::Check(recved.GetWritePos() == expected.GetWritePos() &&
+        ::memcmp(recved.GetData(), expected.GetData(), expected.GetWritePos()) == 0,
+        "[%d big + %d small] expect %lu bytes, recv %lu bytes, bytes stream intact",
+        bigCount,
+        smallCount,
+        static_cast<ulong>(expected.GetWritePos()),
+        static_cast<ulong>(recved.GetWritePos()));
+
+    passed = CommTestHelper::Check(sentPackets == static_cast<uint64>(packetCount) &&
+        sendSyscalls > 0 && sendSyscalls < sentPackets,
+        "[%d big + %d small] sent %llu packets in %llu send syscalls",
+        bigCount, smallCount, sentPackets, sendSyscalls) && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+size_t TestCase_Comm_GatherSend::RecvAll(LLBC_SocketHandle handle, LLBC_MessageBlock &recved, size_t expected, int timeout)
+{
+    char buf[65536];
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + timeout;
+    while (recved.GetWritePos() < expected && LLBC_GetMilliSeconds() < timeoutTime)
+    {
+        const int len = LLBC_Recv(handle, buf, sizeof(buf), 0);
+        if (len > 0)
+            recved.Write(buf, len);
+        else if (len == 0)
+            break;
+        else if (LLBC_GetLastError() == LLBC_ERROR_WBLOCK || LLBC_GetLastError() == LLBC_ERROR_AGAIN)
+            LLBC_Sleep(1);
+        else
+            break;
+    }
+
+    return recved.GetWritePos();
+}
@@ -0,0 +1,38 @@
+/**
+ * @file    TestCase_Comm_GatherSend.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library socket gather send testcase, check partial writes and
+ *          send queues longer than LLBC_IOV_MAX blocks keep the bytes stream intact.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_GATHER_SEND_H__
+#define __LLBC_TEST_CASE_COMM_GATHER_SEND_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_GatherSend : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_GatherSend();
+    virtual ~TestCase_Comm_GatherSend();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunCheck(int bigCount, int smallCount);
+
+    /**
+     * Recv bytes from non-blocking raw socket, until recv expected bytes, peer closed or timeout.
+     */
+    static size_t RecvAll(LLBC_SocketHandle handle, LLBC_MessageBlock &recved, size_t expected, int timeout);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_GATHER_SEND_H__
@@ -0,0 +1,139 @@
+/**
+ * @file    TestCase_Comm_HeaderLayout.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_HeaderLayout.h"
+
+namespace
+{
+    // Header parts serial numbers, see LLBC_LibPacketHeaderDescFactory.
+    const int LengthPartNo = 0;
+    const int OpcodePartNo = 1;
+    const int StatusPartNo = 2;
+    const int ServiceIdPartNo = 3;
+    const int FlagsPartNo = 4;
+
+    // Every loop access header parts count.
+    const int PartsPerLoop = 5;
+
+    typedef LLBC_LibPacketHeaderLayout _Layout;
+}
+
+TestCase_Comm_HeaderLayout::TestCase_Comm_HeaderLayout()
+: _loopTimes(10000000)
+{
+}
+
+TestCase_Comm_HeaderLayout::~TestCase_Comm_HeaderLayout()
+{
+}
+
+int TestCase_Comm_HeaderLayout::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Packet header layout benchmark:");
+    if (argc >= 2)
+        _loopTimes = MAX(1, LLBC_Str2Int32(argv[1]));
+
+    LLBC_PrintLine("Usage: ./a [loopTimes=10000000]");
+    LLBC_PrintLine("Loop times: %d, static header layout enabled: %s",
+        _loopTimes, LLBC_CFG_COMM_ENABLE_STATIC_HEADER_LAYOUT ? "true" : "false");
+
+    LLBC_Packet packet;
+    packet.SetHeader(3, 1, 1024, 5);
+    packet.SetFlags(0x0a);
+    packet.Write("Hello World", 12);
+    packet.SetHeaderPartVal(LengthPartNo, static_cast<sint32>(_Layout::HeaderLen + packet.GetPayloadLength()));
+
+    // Make sure the compile-time layout decode same values as runtime describe.
+    const char *header = reinterpret_cast<const char *>(packet.GetPayload()) - _Layout::HeaderLen;
+    LLBC_PrintLine("Runtime describe: length: %d, opcode: %d, status: %d, serviceId: %d, flags: %d",
+        packet.GetHeaderPartAsSInt32(LengthPartNo),
+        packet.GetHeaderPartAsSInt32(OpcodePartNo),
+        packet.GetHeaderPartAsSInt32(StatusPartNo),
+        packet.GetHeaderPartAsSInt32(ServiceIdPartNo),
+        packet.GetHeaderPartAsSInt32(FlagsPartNo));
+    LLBC_PrintLine("Static layout   : length: %d, opcode: %d, status: %d, serviceId: %d, flags: %d",
+        _Layout::LenPart::Get(header),
+        _Layout::OpcodePart::Get(header),
+        _Layout::StatusPart::Get(header),
+        _Layout::ServiceIdPart::Get(header),
+        _Layout::FlagsPart::Get(header));
+
+    this->RunSerialNoBenchmark(packet);
+    this->RunPacketGetterBenchmark(packet);
+    this->RunStaticLayoutBenchmark(packet);
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+void TestCase_Comm_HeaderLayout::RunSerialNoBenchmark(const LLBC_Packet &packet)
+{
+    sint64 sum = 0;
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        sum += packet.GetHeaderPartAsSInt32(LengthPartNo);
+        sum += packet.GetHeaderPartAsSInt32(OpcodePartNo);
+        sum += packet.GetHeaderPartAsSInt32(StatusPartNo);
+        sum += packet.GetHeaderPartAsSInt32(ServiceIdPartNo);
+        sum += packet.GetHeaderPartAsSInt32(FlagsPartNo);
+    }
+
+    this->PrintResult("By serial no", LLBC_CPUTime::Current().ToMicroSeconds() - begTime, sum);
+}
+
+void TestCase_Comm_HeaderLayout::RunPacketGetterBenchmark(const LLBC_Packet &packet)
+{
+    sint64 sum = 0;
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        sum += packet.GetLength();
+        sum += packet.GetOpcode();
+        sum += packet.GetStatus();
+        sum += packet.GetServiceId();
+        sum += packet.GetFlags();
+    }
+
+    this->PrintResult("Packet getter", LLBC_CPUTime::Current().ToMicroSeconds() - begTime, sum);
+}
+
+void TestCase_Comm_HeaderLayout::RunStaticLayoutBenchmark(const LLBC_Packet &packet)
+{
+    // Packet header just before the payload.
+    const void * volatile header = reinterpret_cast<const char *>(
+        packet.GetPayload()) - _Layout::HeaderLen;
+
+    sint64 sum = 0;
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        const void *buf = header;
+        sum += _Layout::LenPart::Get(buf);
+        sum += _Layout::OpcodePart::Get(buf);
+        sum += _Layout::StatusPart::Get(buf);
+        sum += _Layout::ServiceIdPart::Get(buf);
+        sum += _Layout::FlagsPart::Get(buf);
+    }
+
+    this->PrintResult("Static layout", LLBC_CPUTime::Current().ToMicroSeconds() - begTime, sum);
+}
+
+void TestCase_Comm_HeaderLayout::PrintResult(const char *name, sint64 usedTime, sint64 sum)
+{
+    usedTime = MAX(1, usedTime);
+    LLBC_PrintLine("[%-13s] %d loops used %7lld us, %6.2f ns/field, checksum: %lld",
+        name,
+        _loopTimes,
+        usedTime,
+        static_cast<double>(usedTime) * 1000 / (static_cast<double>(_loopTimes) * PartsPerLoop),
+        sum);
+}
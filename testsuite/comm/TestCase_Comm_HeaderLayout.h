@@ -0,0 +1,35 @@
+/**
+ * @file    TestCase_Comm_HeaderLayout.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library packet header parts access benchmark(runtime describe/compile-time layout).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_HEADER_LAYOUT_H__
+#define __LLBC_TEST_CASE_COMM_HEADER_LAYOUT_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_HeaderLayout : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_HeaderLayout();
+    virtual ~TestCase_Comm_HeaderLayout();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    void RunSerialNoBenchmark(const LLBC_Packet &packet);
+    void RunPacketGetterBenchmark(const LLBC_Packet &packet);
+    void RunStaticLayoutBenchmark(const LLBC_Packet &packet);
+
+    void PrintResult(const char *name, sint64 usedTime, sint64 sum);
+
+private:
+    int _loopTimes;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_HEADER_LAYOUT_H__
@@ -0,0 +1,595 @@
+/**
+ * @file    TestCase_Comm_LocalChannel.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_LocalChannel.h"
+
+namespace
+{
+
+const int PING_OPCODE = 1;
+const int STREAM_OPCODE = 2;
+const int DATA_OPCODE = 3;
+
+// Stream window size, client request next window after received whole window.
+const int STREAM_WINDOW = 1000;
+
+const int CHECK_PACKET_COUNT = 200;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 4096;
+
+const uint32 OTHER_DATA_MAGIC = 0x4f746872;
+
+/**
+ * \brief The stream data coder, local channel hand over it to client service as decoder.
+ */
+struct StreamData : public LLBC_ICoder
+{
+    sint32 seq;
+    LLBC_String payload;
+
+    virtual void Encode(LLBC_Packet &packet)
+    {
+        packet <<seq <<payload;
+    }
+
+    virtual void Decode(LLBC_Packet &packet)
+    {
+        packet >>seq >>payload;
+    }
+};
+
+class StreamDataFactory : public LLBC_ICoderFactory
+{
+public:
+    virtual LLBC_ICoder *Create() const
+    {
+        return LLBC_New(StreamData);
+    }
+};
+
+/**
+ * \brief The other coder class, same wire format as stream data but different layout,
+ *        receiver registered it must decode packet by itself, not take over sender's encoder.
+ */
+struct OtherData : public LLBC_ICoder
+{
+    uint32 magic;
+    LLBC_String payload;
+    sint32 seq;
+
+    OtherData()
+    : magic(OTHER_DATA_MAGIC)
+    , seq(0)
+    {
+    }
+
+    virtual void Encode(LLBC_Packet &packet)
+    {
+        packet <<seq <<payload;
+    }
+
+    virtual void Decode(LLBC_Packet &packet)
+    {
+        packet >>seq >>payload;
+    }
+};
+
+class OtherDataFactory : public LLBC_ICoderFactory
+{
+public:
+    virtual LLBC_ICoder *Create() const
+    {
+        return LLBC_New(OtherData);
+    }
+};
+
+/**
+ * Coder check facade, verify received stream data packets by the receiver's coder mode.
+ */
+class CoderCheckFacade : public CommTestHelper::SessionFacade
+{
+public:
+    enum Mode
+    {
+        SameCoder,
+        NoCoder,
+        OtherCoder
+    };
+
+public:
+    CoderCheckFacade(Mode mode, size_t payloadSize)
+    : _mode(mode)
+    , _payload(payloadSize, 'a')
+    , _headerLen(0)
+    , _lenNotIncludedLen(0)
+    , _recvCount(0)
+    , _matchedCount(0)
+    {
+        // Test use llbc library default header describe.
+        LLBC_PacketHeaderDesc *headerDesc = LLBC_LibPacketHeaderDescFactory().Create();
+        _headerLen = headerDesc->GetHeaderLen();
+        _lenNotIncludedLen = headerDesc->GetLenPartNotIncludedLen();
+        LLBC_Delete(headerDesc);
+    }
+
+public:
+    void OnData(LLBC_Packet &packet)
+    {
+        sint32 seq = -1;
+        LLBC_String payload;
+        if (_mode == SameCoder)
+        {
+            StreamData *data = static_cast<StreamData *>(packet.GetDecoder());
+            if (data)
+            {
+                seq = data->seq;
+                payload = data->payload;
+            }
+        }
+        else if (_mode == OtherCoder)
+        {
+            OtherData *data = static_cast<OtherData *>(packet.GetDecoder());
+            if (data && data->magic == OTHER_DATA_MAGIC)
+            {
+                seq = data->seq;
+                payload = data->payload;
+            }
+        }
+        else
+        {
+            packet >>seq >>payload;
+        }
+
+        // Length part must match the packet data, no matter packet encoded by which side.
+        const size_t expectLen = _headerLen + packet.GetPayloadLength() - _lenNotIncludedLen;
+
+        if (seq == _recvCount && payload == _payload &&
+            static_cast<size_t>(packet.GetLength()) == expectLen)
+            _matchedCount += 1;
+
+        _recvCount += 1;
+    }
+
+public:
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    int GetMatchedCount() const
+    {
+        return _matchedCount;
+    }
+
+private:
+    Mode _mode;
+    LLBC_String _payload;
+    size_t _headerLen;
+    size_t _lenNotIncludedLen;
+
+    volatile int _recvCount;
+    volatile int _matchedCount;
+};
+
+/**
+ * Connect to local service.
+ * @return int - the session Id, if failed, return 0.
+ */
+int __ConnectLocal(LLBC_IService *client, int svcId)
+{
+    // Service add to service manager in service thread, retry until peer service found.
+    int sessionId;
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 5000;
+    while ((sessionId = client->ConnectLocal(svcId)) == 0)
+    {
+        if (LLBC_GetLastError() != LLBC_ERROR_NOT_FOUND || LLBC_GetMilliSeconds() >= timeoutTime)
+        {
+            LLBC_FilePrintLine(stderr, "Connect to local service %d failed, err: %s", svcId, LLBC_FormatLastError());
+            return 0;
+        }
+
+        LLBC_Sleep(1);
+    }
+
+    return sessionId;
+}
+
+/**
+ * Start both services and connect local, the shared echo check connector.
+ */
+int __StartAndConnectLocal(LLBC_IService *server, LLBC_IService *client, const void *arg)
+{
+    if (server->Start() != LLBC_RTN_OK ||
+        client->Start() != LLBC_RTN_OK)
+        return 0;
+
+    return __ConnectLocal(client, server->GetId());
+}
+
+/**
+ * Server side: echo ping packets, send a window of stream data when client request.
+ */
+class ServerFacade : public LLBC_IFacade
+{
+public:
+    ServerFacade(int totalPackets, size_t payloadSize)
+    : _totalPackets(totalPackets)
+    , _payload(payloadSize, 'a')
+    , _sentCount(0)
+    {
+    }
+
+public:
+    void OnPing(LLBC_Packet &packet)
+    {
+        LLBC_Packet *resPacket = LLBC_New(LLBC_Packet);
+        resPacket->SetHeader(packet, PING_OPCODE, 0);
+        resPacket->Write(packet.GetPayload(), packet.GetPayloadLength());
+
+        this->GetService()->Send(resPacket);
+    }
+
+    void OnRequestStream(LLBC_Packet &packet)
+    {
+        const int sessionId = packet.GetSessionId();
+        for (int i = 0; i < STREAM_WINDOW && _sentCount < _totalPackets; i++, _sentCount++)
+        {
+            StreamData *data = LLBC_New(StreamData);
+            data->seq = _sentCount;
+            data->payload = _payload;
+
+            // Cast to coder, otherwise will match the Send<T>() template method.
+            this->GetService()->Send(sessionId, DATA_OPCODE, static_cast<LLBC_ICoder *>(data), 0);
+        }
+    }
+
+private:
+    int _totalPackets;
+    LLBC_String _payload;
+    int _sentCount;
+};
+
+/**
+ * Client side: ping-pong first, after all pings finished, request server to stream data.
+ */
+class ClientFacade : public LLBC_IFacade
+{
+public:
+    ClientFacade(int pingTimes, int totalPackets)
+    : _pingTimes(pingTimes)
+    , _totalPackets(totalPackets)
+    , _sessionId(0)
+    , _pingFinished(false)
+    , _pingBegTime(0)
+
+    , _streamBegTime(0)
+    , _recvCount(0)
+    , _recvBytes(0)
+    , _badCount(0)
+    {
+        _rtts.reserve(pingTimes);
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        if (sessionInfo.IsListenSession())
+            return;
+
+        _sessionId = sessionInfo.GetSessionId();
+        _pingBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        this->Ping(_sessionId);
+    }
+
+    void OnPong(LLBC_Packet &packet)
+    {
+        sint64 sendTime;
+        packet.Read(sendTime);
+
+        _rtts.push_back(LLBC_CPUTime::Current().ToMicroSeconds() - sendTime);
+        if (static_cast<int>(_rtts.size()) < _pingTimes)
+        {
+            this->Ping(packet.GetSessionId());
+            return;
+        }
+
+        _streamBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        _pingFinished = true;
+
+        this->GetService()->Send(packet.GetSessionId(), STREAM_OPCODE, "", 0, 0);
+    }
+
+    void OnData(LLBC_Packet &packet)
+    {
+        StreamData *data = static_cast<StreamData *>(packet.GetDecoder());
+        if (!data || data->seq != _recvCount)
+            _badCount += 1;
+        else
+            _recvBytes += data->payload.size();
+
+        _recvCount += 1;
+        if (_recvCount % STREAM_WINDOW == 0 && _recvCount < _totalPackets)
+            this->GetService()->Send(packet.GetSessionId(), STREAM_OPCODE, "", 0, 0);
+    }
+
+public:
+    int GetSessionId() const
+    {
+        return _sessionId;
+    }
+
+    bool IsPingFinished() const
+    {
+        return _pingFinished;
+    }
+
+    std::vector<sint64> &GetRTTs()
+    {
+        return _rtts;
+    }
+
+    sint64 GetPingBeginTime() const
+    {
+        return _pingBegTime;
+    }
+
+    sint64 GetStreamBeginTime() const
+    {
+        return _streamBegTime;
+    }
+
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    sint64 GetRecvBytes() const
+    {
+        return _recvBytes;
+    }
+
+    int GetBadCount() const
+    {
+        return _badCount;
+    }
+
+private:
+    void Ping(int sessionId)
+    {
+        LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+        packet->SetHeader(sessionId, PING_OPCODE, 0);
+        packet->Write(static_cast<sint64>(LLBC_CPUTime::Current().ToMicroSeconds()));
+
+        this->GetService()->Send(packet);
+    }
+
+private:
+    int _pingTimes;
+    int _totalPackets;
+    volatile int _sessionId;
+    volatile bool _pingFinished;
+    sint64 _pingBegTime;
+    std::vector<sint64> _rtts;
+
+    sint64 _streamBegTime;
+    volatile int _recvCount;
+    sint64 _recvBytes;
+    int _badCount;
+};
+
+}
+
+TestCase_Comm_LocalChannel::TestCase_Comm_LocalChannel()
+: _tcpPort(7799)
+, _pingTimes(10000)
+, _totalPackets(200000)
+, _payloadSize(512)
+{
+}
+
+TestCase_Comm_LocalChannel::~TestCase_Comm_LocalChannel()
+{
+}
+
+int TestCase_Comm_LocalChannel::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("In-process local channel test:");
+    if (argc >= 2)
+        _tcpPort = LLBC_Str2Int32(argv[1]);
+    if (argc >= 3)
+        _pingTimes = MAX(1, LLBC_Str2Int32(argv[2]));
+    if (argc >= 4)
+        _totalPackets = MAX(1, LLBC_Str2Int32(argv[3]));
+    if (argc >= 5)
+        _payloadSize = static_cast<size_t>(MAX(0, LLBC_Str2Int32(argv[4])));
+
+    LLBC_PrintLine("Usage: ./a [tcpPort=7799] [pingTimes=10000] [totalPackets=200000] [payloadSize=512]");
+    LLBC_PrintLine("Tcp: 127.0.0.1:%d, ping times: %d, stream packets: %d, payload size: %lu",
+        _tcpPort, _pingTimes, _totalPackets, static_cast<ulong>(_payloadSize));
+
+    if (this->RunPayloadCheck() != LLBC_RTN_OK ||
+        this->RunCoderCheck(CoderCheckFacade::SameCoder) != LLBC_RTN_OK ||
+        this->RunCoderCheck(CoderCheckFacade::NoCoder) != LLBC_RTN_OK ||
+        this->RunCoderCheck(CoderCheckFacade::OtherCoder) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (this->RunBenchmark(false) != LLBC_RTN_OK ||
+        this->RunBenchmark(true) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_LocalChannel::RunPayloadCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    // Remove session on one side, both sides sessions destroyed.
+    return CommTestHelper::RunEchoCheck("LocalChannel", server, client, &__StartAndConnectLocal, NULL,
+        DATA_OPCODE, CHECK_PACKET_COUNT, CHECK_MAX_PAYLOAD_SIZE);
+}
+
+int TestCase_Comm_LocalChannel::RunCoderCheck(int mode)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    // Sender always registered stream data coder, receiver coder decided by check mode.
+    CoderCheckFacade *checkFacade = LLBC_New2(CoderCheckFacade, static_cast<CoderCheckFacade::Mode>(mode), _payloadSize);
+    server->RegisterFacade(LLBC_New(CommTestHelper::SessionFacade));
+    server->RegisterCoder(DATA_OPCODE, LLBC_New(StreamDataFactory));
+    client->RegisterFacade(checkFacade);
+    if (mode == CoderCheckFacade::SameCoder)
+        client->RegisterCoder(DATA_OPCODE, LLBC_New(StreamDataFactory));
+    else if (mode == CoderCheckFacade::OtherCoder)
+        client->RegisterCoder(DATA_OPCODE, LLBC_New(OtherDataFactory));
+    client->Subscribe(DATA_OPCODE, checkFacade, &CoderCheckFacade::OnData);
+
+    int sessionId = 0;
+    if (server->Start() != LLBC_RTN_OK ||
+        client->Start() != LLBC_RTN_OK ||
+        (sessionId = __ConnectLocal(server, client->GetId())) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    const LLBC_String payload(_payloadSize, 'a');
+    for (int i = 0; i < CHECK_PACKET_COUNT; i++)
+    {
+        StreamData *data = LLBC_New(StreamData);
+        data->seq = i;
+        data->payload = payload;
+
+        // Cast to coder, otherwise will match the Send<T>() template method.
+        server->Send(sessionId, DATA_OPCODE, static_cast<LLBC_ICoder *>(data), 0);
+    }
+
+    const char *modeDescs[] = {"same coder class", "no coder", "other coder class"};
+    CommTestHelper::WaitFor(checkFacade, &CoderCheckFacade::GetRecvCount, CHECK_PACKET_COUNT);
+    const bool passed = CommTestHelper::Check(checkFacade->GetMatchedCount() == CHECK_PACKET_COUNT,
+        "Local channel receiver %s, send %d coder packets, recv %d, matched(data and length) %d",
+        modeDescs[mode], CHECK_PACKET_COUNT, checkFacade->GetRecvCount(), checkFacade->GetMatchedCount());
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_LocalChannel::RunBenchmark(bool local)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    ServerFacade *serverFacade = LLBC_New2(ServerFacade, _totalPackets, _payloadSize);
+    server->RegisterFacade(serverFacade);
+    server->RegisterCoder(DATA_OPCODE, LLBC_New(StreamDataFactory));
+    server->Subscribe(PING_OPCODE, serverFacade, &ServerFacade::OnPing);
+    server->Subscribe(STREAM_OPCODE, serverFacade, &ServerFacade::OnRequestStream);
+
+    ClientFacade *clientFacade = LLBC_New2(ClientFacade, _pingTimes, _totalPackets);
+    client->RegisterFacade(clientFacade);
+    client->RegisterCoder(DATA_OPCODE, LLBC_New(StreamDataFactory));
+    client->Subscribe(PING_OPCODE, clientFacade, &ClientFacade::OnPong);
+    client->Subscribe(DATA_OPCODE, clientFacade, &ClientFacade::OnData);
+
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        svcs[i]->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+        // Don't let service frame interval hide the transport cost.
+        svcs[i]->SetEventDriven(true);
+        svcs[i]->SetPollerIntegratedLoop(true);
+    }
+
+    if (this->Connect(server, client, local) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    const char *transport = local ? "Local" : "Tcp  ";
+
+    // Ping-pong.
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 60000;
+    while (!clientFacade->IsPingFinished() && LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+
+    std::vector<sint64> &rtts = clientFacade->GetRTTs();
+    if (!clientFacade->IsPingFinished() || rtts.empty())
+    {
+        LLBC_FilePrintLine(stderr, "[%-5s] ping-pong timeout", transport);
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::PrintRTTs(transport, rtts,
+        (clientFacade->GetStreamBeginTime() - clientFacade->GetPingBeginTime()) / 1000);
+
+    // Stream.
+    while (clientFacade->GetRecvCount() < _totalPackets && LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - clientFacade->GetStreamBeginTime());
+
+    LLBC_PrintLine("[%-5s] stream recv %d/%d coder packets used %6lld ms, %8.0f packets/s, %7.2f MB/s, bad: %d",
+        transport,
+        clientFacade->GetRecvCount(),
+        _totalPackets,
+        usedTime / 1000,
+        static_cast<double>(clientFacade->GetRecvCount()) * 1000000 / usedTime,
+        static_cast<double>(clientFacade->GetRecvBytes()) / usedTime,
+        clientFacade->GetBadCount());
+
+    const bool succeed = clientFacade->GetRecvCount() == _totalPackets && clientFacade->GetBadCount() == 0;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return succeed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_LocalChannel::Connect(LLBC_IService *server, LLBC_IService *client, bool local)
+{
+    if (!local && server->Listen("127.0.0.1", _tcpPort) == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Listen on 127.0.0.1:%d failed, err: %s", _tcpPort, LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+
+    server->Start();
+    client->Start();
+
+    if (!local)
+    {
+        if (client->Connect("127.0.0.1", _tcpPort) == 0)
+        {
+            LLBC_FilePrintLine(stderr, "Connect to 127.0.0.1:%d failed, err: %s", _tcpPort, LLBC_FormatLastError());
+            return LLBC_RTN_FAILED;
+        }
+
+        return LLBC_RTN_OK;
+    }
+
+    return __ConnectLocal(client, server->GetId()) != 0 ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file    TestCase_Comm_LocalChannel.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library in-process local channel test and benchmark(compare with tcp loopback).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_LOCAL_CHANNEL_H__
+#define __LLBC_TEST_CASE_COMM_LOCAL_CHANNEL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_LocalChannel : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_LocalChannel();
+    virtual ~TestCase_Comm_LocalChannel();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunPayloadCheck();
+    int RunCoderCheck(int mode);
+
+    int RunBenchmark(bool local);
+
+    int Connect(LLBC_IService *server, LLBC_IService *client, bool local);
+
+private:
+    int _tcpPort;
+    int _pingTimes;
+    int _totalPackets;
+    size_t _payloadSize;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_LOCAL_CHANNEL_H__
@@ -0,0 +1,200 @@
+/**
+ * @file    TestCase_Comm_PacketPool.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_PacketPool.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+
+/**
+ * \brief The release task, simulate service thread: release packets which created by poller thread.
+ */
+class ReleaseTask : public LLBC_BaseTask
+{
+public:
+    ReleaseTask(bool pooled, int totalPackets)
+    : _pooled(pooled)
+    , _totalPackets(totalPackets)
+
+    , _foreignReleaseCount(0)
+    , _returnBatchCount(0)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        LLBC_PacketPool *pool = _pooled ? LLBC_PacketPool::Attach() : NULL;
+
+        LLBC_Packet *packet;
+        LLBC_MessageBlock *block;
+        for (int i = 0; i < _totalPackets; i++)
+        {
+            this->Pop(block);
+            block->Read(&packet, sizeof(packet));
+            LLBC_Delete(block);
+
+            if (_pooled)
+                LLBC_PacketPool::Release(packet);
+            else
+                LLBC_Delete(packet);
+        }
+
+        if (pool)
+        {
+            LLBC_PacketPool::FlushReturns();
+
+            _foreignReleaseCount = pool->GetForeignReleaseCount();
+            _returnBatchCount = pool->GetReturnBatchCount();
+
+            LLBC_PacketPool::Detach();
+        }
+    }
+
+    virtual void Cleanup()
+    {
+    }
+
+public:
+    uint64 GetForeignReleaseCount() const
+    {
+        return _foreignReleaseCount;
+    }
+
+    uint64 GetReturnBatchCount() const
+    {
+        return _returnBatchCount;
+    }
+
+private:
+    bool _pooled;
+    int _totalPackets;
+
+    uint64 _foreignReleaseCount;
+    uint64 _returnBatchCount;
+};
+
+}
+
+TestCase_Comm_PacketPool::TestCase_Comm_PacketPool()
+: _loopTimes(1000000)
+, _payloadSize(64)
+{
+}
+
+TestCase_Comm_PacketPool::~TestCase_Comm_PacketPool()
+{
+}
+
+int TestCase_Comm_PacketPool::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Packet pool benchmark:");
+    if (argc >= 2)
+        _loopTimes = MAX(1, LLBC_Str2Int32(argv[1]));
+    if (argc >= 3)
+        _payloadSize = static_cast<size_t>(MAX(0, LLBC_Str2Int32(argv[2])));
+
+    LLBC_PrintLine("Usage: ./a [loopTimes=1000000] [payloadSize=64]");
+    LLBC_PrintLine("Loop times: %d, payload size: %lu", _loopTimes, static_cast<ulong>(_payloadSize));
+
+    this->RunSameThreadBenchmark(false);
+    this->RunSameThreadBenchmark(true);
+
+    if (this->RunCrossThreadBenchmark(false) != LLBC_RTN_OK ||
+        this->RunCrossThreadBenchmark(true) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+void TestCase_Comm_PacketPool::RunSameThreadBenchmark(bool pooled)
+{
+    LLBC_PacketPool *pool = pooled ? LLBC_PacketPool::Attach() : NULL;
+    std::vector<char> payload(_payloadSize + 1, 'a');
+
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        LLBC_Packet *packet = pooled ? LLBC_PacketPool::Acquire() : LLBC_New(LLBC_Packet);
+        packet->SetHeader(i, OPCODE, 0);
+        packet->Write(&payload[0], _payloadSize);
+
+        if (pooled)
+            LLBC_PacketPool::Release(packet);
+        else
+            LLBC_Delete(packet);
+    }
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+
+    LLBC_PrintLine("[Same thread ] [%-7s] %d packets used %6lld us, %6.1f ns/packet, hit rate: %.4f",
+        pooled ? "Pooled" : "New/Del",
+        _loopTimes,
+        usedTime,
+        static_cast<double>(usedTime) * 1000 / _loopTimes,
+        pool ? pool->GetHitRate() : 0.0);
+
+    if (pool)
+        LLBC_PacketPool::Detach();
+}
+
+int TestCase_Comm_PacketPool::RunCrossThreadBenchmark(bool pooled)
+{
+    LLBC_PacketPool *pool = pooled ? LLBC_PacketPool::Attach() : NULL;
+    std::vector<char> payload(_payloadSize + 1, 'a');
+
+    ReleaseTask *task = new ReleaseTask(pooled, _loopTimes);
+    if (task->Activate(1) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Activate release task failed, err: %s", LLBC_FormatLastError());
+        delete task;
+
+        if (pool)
+            LLBC_PacketPool::Detach();
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Main thread simulate poller thread: create packets and deliver them to release task.
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _loopTimes; i++)
+    {
+        LLBC_Packet *packet = pooled ? LLBC_PacketPool::Acquire() : LLBC_New(LLBC_Packet);
+        packet->SetHeader(i, OPCODE, 0);
+        packet->Write(&payload[0], _payloadSize);
+
+        LLBC_MessageBlock *block = LLBC_New1(LLBC_MessageBlock, sizeof(packet));
+        block->Write(&packet, sizeof(packet));
+        task->Push(block);
+    }
+
+    task->Wait();
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+
+    LLBC_PrintLine("[Cross thread] [%-7s] %d packets used %6lld us, %6.1f ns/packet, hit rate: %.4f, "
+                   "foreign released: %llu, return batches: %llu",
+        pooled ? "Pooled" : "New/Del",
+        _loopTimes,
+        usedTime,
+        static_cast<double>(usedTime) * 1000 / _loopTimes,
+        pool ? pool->GetHitRate() : 0.0,
+        task->GetForeignReleaseCount(),
+        task->GetReturnBatchCount());
+
+    delete task;
+
+    if (pool)
+        LLBC_PacketPool::Detach();
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file    TestCase_Comm_PacketPool.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library packet pool benchmark(same thread/cross thread acquire and release).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_PACKET_POOL_H__
+#define __LLBC_TEST_CASE_COMM_PACKET_POOL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_PacketPool : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_PacketPool();
+    virtual ~TestCase_Comm_PacketPool();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    void RunSameThreadBenchmark(bool pooled);
+    int RunCrossThreadBenchmark(bool pooled);
+
+private:
+    int _loopTimes;
+    size_t _payloadSize;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_PACKET_POOL_H__
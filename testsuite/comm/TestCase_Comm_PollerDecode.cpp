@@ -0,0 +1,463 @@
+/**
+ * @file    TestCase_Comm_PollerDecode.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_PollerDecode.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+const int ATTR_COUNT = 64;
+
+const int CHECK_POLLER_COUNT = 2;
+const int CHECK_SESSION_COUNT = 4;
+const int CHECK_PACKETS_PER_SESSION = 500;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 2048;
+const int CHECK_GOOD_PACKETS_BEFORE_BROKEN = 5;
+
+/**
+ * \brief The pattern payload coder, override TryDecode() to report broken payload.
+ */
+struct PatternData : public LLBC_ICoder
+{
+    int seq;
+    LLBC_NativeThreadHandle decodeThread;
+
+    virtual void Encode(LLBC_Packet &packet)
+    {
+    }
+
+    virtual void Decode(LLBC_Packet &packet)
+    {
+        seq = CommTestHelper::VerifyPayload(packet.GetPayload(), packet.GetPayloadLength());
+        decodeThread = LLBC_GetCurrentThread();
+    }
+
+    virtual bool TryDecode(LLBC_Packet &packet)
+    {
+        this->Decode(packet);
+        return seq >= 0;
+    }
+};
+
+class PatternDataFactory : public LLBC_ICoderFactory
+{
+public:
+    virtual LLBC_ICoder *Create() const
+    {
+        return LLBC_New(PatternData);
+    }
+};
+
+/**
+ * Pattern recv facade, check decoded sequence in order per session, and count packets decoded in service thread.
+ */
+class PatternRecvFacade : public CommTestHelper::SessionFacade
+{
+public:
+    PatternRecvFacade()
+    : _recvCount(0)
+    , _matchedCount(0)
+    , _svcThreadDecodeCount(0)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        int &nextSeq = _nextSeqs[packet.GetSessionId()];
+
+        PatternData *data = static_cast<PatternData *>(packet.GetDecoder());
+        if (data && data->seq == nextSeq)
+        {
+            _matchedCount += 1;
+            if (data->decodeThread == LLBC_GetCurrentThread())
+                _svcThreadDecodeCount += 1;
+        }
+
+        nextSeq += 1;
+        _recvCount += 1;
+    }
+
+public:
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    int GetMatchedCount() const
+    {
+        return _matchedCount;
+    }
+
+    int GetSvcThreadDecodeCount() const
+    {
+        return _svcThreadDecodeCount;
+    }
+
+private:
+    volatile int _recvCount;
+    volatile int _matchedCount;
+    int _svcThreadDecodeCount;
+
+    std::map<int, int> _nextSeqs;
+};
+
+/**
+ * \brief The decode heavy coder, simulate the entity full state packet,
+ *        decode need parse many fields and verify checksum.
+ */
+struct EntityData : public LLBC_ICoder
+{
+    sint32 entityId;
+    sint32 attrs[ATTR_COUNT];
+    LLBC_String name;
+    uint32 checksum;
+
+    LLBC_NativeThreadHandle decodeThread;
+
+    virtual void Encode(LLBC_Packet &packet)
+    {
+        packet <<entityId;
+        for (int i = 0; i < ATTR_COUNT; i++)
+            packet <<attrs[i];
+        packet <<name;
+        packet <<CalcChecksum();
+    }
+
+    virtual void Decode(LLBC_Packet &packet)
+    {
+        packet >>entityId;
+        for (int i = 0; i < ATTR_COUNT; i++)
+            packet >>attrs[i];
+        packet >>name;
+        packet >>checksum;
+
+        decodeThread = LLBC_GetCurrentThread();
+    }
+
+    uint32 CalcChecksum() const
+    {
+        uint32 sum = static_cast<uint32>(entityId);
+        for (int round = 0; round < 8; round++)
+        {
+            for (int i = 0; i < ATTR_COUNT; i++)
+                sum = sum * 31 + static_cast<uint32>(attrs[i]);
+            for (size_t i = 0; i < name.size(); i++)
+                sum = sum * 131 + static_cast<uint8>(name[i]);
+        }
+
+        return sum;
+    }
+};
+
+class EntityDataFactory : public LLBC_ICoderFactory
+{
+public:
+    virtual LLBC_ICoder *Create() const
+    {
+        return LLBC_New(EntityData);
+    }
+};
+
+class RecvFacade : public LLBC_IFacade
+{
+public:
+    RecvFacade()
+    : _recvCount(0)
+    , _badCount(0)
+    , _svcThreadDecodeCount(0)
+    {
+    }
+
+public:
+    void OnRecv(LLBC_Packet &packet)
+    {
+        EntityData *data = static_cast<EntityData *>(packet.GetDecoder());
+        if (!data || data->CalcChecksum() != data->checksum)
+            _badCount += 1;
+        else if (data->decodeThread == LLBC_GetCurrentThread())
+            _svcThreadDecodeCount += 1;
+
+        _recvCount += 1;
+    }
+
+public:
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    int GetBadCount() const
+    {
+        return _badCount;
+    }
+
+    int GetSvcThreadDecodeCount() const
+    {
+        return _svcThreadDecodeCount;
+    }
+
+private:
+    volatile int _recvCount;
+    int _badCount;
+    int _svcThreadDecodeCount;
+};
+
+}
+
+TestCase_Comm_PollerDecode::TestCase_Comm_PollerDecode()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _sessionCount(8)
+, _packetCount(100000)
+{
+}
+
+TestCase_Comm_PollerDecode::~TestCase_Comm_PollerDecode()
+{
+}
+
+int TestCase_Comm_PollerDecode::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Poller threads packet decode test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _sessionCount = MAX(1, LLBC_Str2Int32(argv[3]));
+    if (argc >= 5)
+        _packetCount = MAX(1, LLBC_Str2Int32(argv[4]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [sessionCount=8] [packetCount=100000]");
+    LLBC_PrintLine("Run on %s:%d, sessions: %d, packets: %d",
+        _runIp.c_str(), _runPort, _sessionCount, _packetCount);
+
+    int port = _runPort;
+    if (this->RunDecodeCheck(false, port++) != LLBC_RTN_OK ||
+        this->RunDecodeCheck(true, port++) != LLBC_RTN_OK ||
+        this->RunDecodeFailCheck(false, port++) != LLBC_RTN_OK ||
+        this->RunDecodeFailCheck(true, port++) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    const int pollerCounts[] = {1, 2, 4};
+    for (size_t i = 0; i < sizeof(pollerCounts) / sizeof(pollerCounts[0]); i++)
+    {
+        if (this->RunBenchmark(false, pollerCounts[i], port++) != LLBC_RTN_OK ||
+            this->RunBenchmark(true, pollerCounts[i], port++) != LLBC_RTN_OK)
+            return LLBC_RTN_FAILED;
+    }
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_PollerDecode::RunDecodeCheck(bool pollerDecode, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    server->RegisterCoder(OPCODE, LLBC_New(PatternDataFactory));
+    server->SetPollerDecode(pollerDecode);
+
+    PatternRecvFacade *recvFacade = LLBC_New(PatternRecvFacade);
+    server->RegisterFacade(recvFacade);
+    server->Subscribe(OPCODE, recvFacade, &PatternRecvFacade::OnRecv);
+
+    if (server->Listen(_runIp.c_str(), port) == 0 ||
+        server->Start(CHECK_POLLER_COUNT) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start server failed, err: %s", LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    bool passed = true;
+    for (int i = 0; i < CHECK_SESSION_COUNT; i++)
+    {
+        const int sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), port);
+        passed = sessionId != 0 &&
+            CommTestHelper::SendPayloads(client, sessionId, OPCODE,
+                CHECK_PACKETS_PER_SESSION, CHECK_MAX_PAYLOAD_SIZE) == LLBC_RTN_OK && passed;
+    }
+
+    // Decoded payload must equal to sent payload, and decoded in expected thread.
+    const int expectCount = CHECK_SESSION_COUNT * CHECK_PACKETS_PER_SESSION;
+    CommTestHelper::WaitFor(recvFacade, &PatternRecvFacade::GetRecvCount, expectCount);
+    passed = CommTestHelper::Check(recvFacade->GetMatchedCount() == expectCount,
+        "[%s] Decode %d packets, recv %d, matched %d",
+        pollerDecode ? "PollerDecode " : "ServiceDecode",
+        expectCount, recvFacade->GetRecvCount(), recvFacade->GetMatchedCount()) && passed;
+
+    const int expectSvcThreadCount = pollerDecode ? 0 : expectCount;
+    passed = CommTestHelper::Check(recvFacade->GetSvcThreadDecodeCount() == expectSvcThreadCount,
+        "[%s] Decoded in service thread %d, expect %d",
+        pollerDecode ? "PollerDecode " : "ServiceDecode",
+        recvFacade->GetSvcThreadDecodeCount(), expectSvcThreadCount) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_PollerDecode::RunDecodeFailCheck(bool pollerDecode, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    server->RegisterCoder(OPCODE, LLBC_New(PatternDataFactory));
+    server->SetPollerDecode(pollerDecode);
+
+    PatternRecvFacade *recvFacade = LLBC_New(PatternRecvFacade);
+    server->RegisterFacade(recvFacade);
+    server->Subscribe(OPCODE, recvFacade, &PatternRecvFacade::OnRecv);
+
+    CommTestHelper::SessionFacade *clientFacade = LLBC_New(CommTestHelper::SessionFacade);
+    client->RegisterFacade(clientFacade);
+
+    int sessionId = 0;
+    if (server->Listen(_runIp.c_str(), port) == 0 ||
+        server->Start(CHECK_POLLER_COUNT) != LLBC_RTN_OK ||
+        (sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), port)) == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Start services failed, err: %s", LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::SendPayloads(client, sessionId, OPCODE,
+        CHECK_GOOD_PACKETS_BEFORE_BROKEN, CHECK_MAX_PAYLOAD_SIZE);
+    CommTestHelper::WaitFor(recvFacade, &PatternRecvFacade::GetRecvCount, CHECK_GOOD_PACKETS_BEFORE_BROKEN);
+
+    // Send broken payload, then the good payloads, decode failed session must be removed,
+    // no packet dispatch after broken one.
+    const char broken[] = "broken";
+    client->Send(sessionId, OPCODE, broken, sizeof(broken), 0);
+    CommTestHelper::SendPayloads(client, sessionId, OPCODE,
+        CHECK_PACKETS_PER_SESSION, CHECK_MAX_PAYLOAD_SIZE, CHECK_GOOD_PACKETS_BEFORE_BROKEN);
+
+    CommTestHelper::WaitFor(clientFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, 1);
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, 1);
+    LLBC_Sleep(50);
+
+    bool passed = CommTestHelper::Check(
+        recvFacade->GetDestroyedCount() == 1 && clientFacade->GetDestroyedCount() == 1,
+        "[%s] Decode broken payload, server session destroyed %d, client session destroyed %d",
+        pollerDecode ? "PollerDecode " : "ServiceDecode",
+        recvFacade->GetDestroyedCount(), clientFacade->GetDestroyedCount());
+
+    passed = CommTestHelper::Check(recvFacade->GetRecvCount() == CHECK_GOOD_PACKETS_BEFORE_BROKEN &&
+        recvFacade->GetMatchedCount() == CHECK_GOOD_PACKETS_BEFORE_BROKEN,
+        "[%s] Decode broken payload, recv %d(matched %d), expect %d",
+        pollerDecode ? "PollerDecode " : "ServiceDecode",
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount(), CHECK_GOOD_PACKETS_BEFORE_BROKEN) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_PollerDecode::RunBenchmark(bool pollerDecode, int pollerCount, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    server->RegisterCoder(OPCODE, LLBC_New(EntityDataFactory));
+    server->SetPollerDecode(pollerDecode);
+
+    RecvFacade *recvFacade = LLBC_New(RecvFacade);
+    server->RegisterFacade(recvFacade);
+    server->Subscribe(OPCODE, recvFacade, &RecvFacade::OnRecv);
+
+    if (server->Listen(_runIp.c_str(), port) == 0 ||
+        server->Start(pollerCount) != LLBC_RTN_OK ||
+        client->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start services failed, err: %s", LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_SessionIdList sessionIds;
+    for (int i = 0; i < _sessionCount; i++)
+    {
+        const int sessionId = client->Connect(_runIp.c_str(), port);
+        if (sessionId == 0)
+        {
+            LLBC_FilePrintLine(stderr, "Connect to %s:%d failed, err: %s",
+                _runIp.c_str(), port, LLBC_FormatLastError());
+
+            LLBC_Delete(client);
+            LLBC_Delete(server);
+
+            return LLBC_RTN_FAILED;
+        }
+
+        sessionIds.push_back(sessionId);
+    }
+
+    // Encode payload once, client only send bytes, make server decode the bottleneck.
+    EntityData data;
+    data.entityId = 10001;
+    for (int i = 0; i < ATTR_COUNT; i++)
+        data.attrs[i] = i * 7919;
+    data.name = "entity_full_state_sync";
+
+    LLBC_Packet encoded;
+    data.Encode(encoded);
+
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _packetCount; i++)
+        client->Send(sessionIds[i % sessionIds.size()], OPCODE, encoded.GetPayload(), encoded.GetPayloadLength(), 0);
+
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 60000;
+    while (recvFacade->GetRecvCount() < _packetCount &&
+           LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+
+    LLBC_PrintLine("[%-13s pollers %d] recv %d/%d packets(bad: %d) used %5lld ms, %8.0f packets/s, decoded in service thread: %d",
+        pollerDecode ? "PollerDecode" : "ServiceDecode",
+        pollerCount,
+        recvFacade->GetRecvCount(),
+        _packetCount,
+        recvFacade->GetBadCount(),
+        usedTime / 1000,
+        static_cast<double>(recvFacade->GetRecvCount()) * 1000000 / usedTime,
+        recvFacade->GetSvcThreadDecodeCount());
+
+    const bool allRecved = recvFacade->GetRecvCount() == _packetCount &&
+        recvFacade->GetBadCount() == 0;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return allRecved ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
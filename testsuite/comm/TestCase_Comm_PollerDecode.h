@@ -0,0 +1,38 @@
+/**
+ * @file    TestCase_Comm_PollerDecode.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library poller threads packet decode testcase, check decoded payloads and
+ *          decode failed session removed, then benchmark decode throughput.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_POLLER_DECODE_H__
+#define __LLBC_TEST_CASE_COMM_POLLER_DECODE_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_PollerDecode : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_PollerDecode();
+    virtual ~TestCase_Comm_PollerDecode();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunDecodeCheck(bool pollerDecode, int port);
+    int RunDecodeFailCheck(bool pollerDecode, int port);
+
+    int RunBenchmark(bool pollerDecode, int pollerCount, int port);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _sessionCount;
+    int _packetCount;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_POLLER_DECODE_H__
@@ -0,0 +1,113 @@
+/**
+ * @file    TestCase_Comm_PollerLatency.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_PollerLatency.h"
+
+namespace
+{
+    const int OPCODE = 1;
+
+    const int CHECK_PACKET_COUNT = 200;
+    const size_t CHECK_MAX_PAYLOAD_SIZE = 64 * 1024;
+}
+
+TestCase_Comm_PollerLatency::TestCase_Comm_PollerLatency()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _pingTimes(1000)
+{
+}
+
+TestCase_Comm_PollerLatency::~TestCase_Comm_PollerLatency()
+{
+}
+
+int TestCase_Comm_PollerLatency::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Poller event loop test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _pingTimes = MAX(1, LLBC_Str2Int32(argv[3]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [pingTimes=1000]");
+    LLBC_PrintLine("Run on %s:%d, ping times: %d", _runIp.c_str(), _runPort, _pingTimes);
+
+    if (this->RunCheck(false, _runPort) != LLBC_RTN_OK ||
+        this->RunCheck(true, _runPort + 1) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Latency benchmark:");
+    if (this->RunBenchmark(false, _runPort + 2) != LLBC_RTN_OK ||
+        this->RunBenchmark(true, _runPort + 3) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_PollerLatency::RunCheck(bool integrated, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetPollerIntegratedLoop(integrated);
+    client->SetPollerIntegratedLoop(integrated);
+
+    // Data and peer close must be detected by the poller, whichever loop mode used.
+    return CommTestHelper::RunEchoCheck(integrated ? "IntegratedLoop" : "MonitorThread",
+        server, client, _runIp.c_str(), port, OPCODE, CHECK_PACKET_COUNT, CHECK_MAX_PAYLOAD_SIZE);
+}
+
+int TestCase_Comm_PollerLatency::RunBenchmark(bool integrated, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    CommTestHelper::EchoFacade *echoFacade = LLBC_New(CommTestHelper::EchoFacade);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(OPCODE, echoFacade, &CommTestHelper::EchoFacade::OnRecv);
+
+    CommTestHelper::PingFacade *pingFacade = LLBC_New2(CommTestHelper::PingFacade, OPCODE, _pingTimes);
+    client->RegisterFacade(pingFacade);
+    client->Subscribe(OPCODE, pingFacade, &CommTestHelper::PingFacade::OnRecv);
+
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        svcs[i]->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+        svcs[i]->SetPollerIntegratedLoop(integrated);
+    }
+
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), port) == 0 ||
+        CommTestHelper::ConnectAndStart(client, _runIp.c_str(), port) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    const bool finished = CommTestHelper::WaitFor(
+        pingFacade, &CommTestHelper::PingFacade::IsFinished, 30000);
+
+    CommTestHelper::PrintRTTs(integrated ? "IntegratedLoop" : "MonitorThread",
+        pingFacade->GetRTTs(), LLBC_GetMilliSeconds() - begTime);
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return finished ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file    TestCase_Comm_PollerLatency.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library poller event loop testcase, check echo integrity and peer close
+ *          in both loop modes, and then benchmark latency(monitor thread vs integrated loop).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_POLLER_LATENCY_H__
+#define __LLBC_TEST_CASE_COMM_POLLER_LATENCY_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_PollerLatency : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_PollerLatency();
+    virtual ~TestCase_Comm_PollerLatency();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunCheck(bool integrated, int port);
+    int RunBenchmark(bool integrated, int port);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _pingTimes;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_POLLER_LATENCY_H__
@@ -0,0 +1,192 @@
+/**
+ * @file    TestCase_Comm_RecvBlockPool.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_RecvBlockPool.h"
+
+namespace
+{
+    const int OPCODE = 1;
+    const int EMPTY_OPCODE = 2;
+
+    const int EMPTY_PING_TIMES = 100;
+    const int SPAN_PACKET_COUNT = 100;
+
+    /**
+     * Ping-pong empty payload packets, next ping only send after pong received,
+     * so every empty packet header exactly end at the received blocks chain end.
+     */
+    class EmptyPingFacade : public CommTestHelper::SessionFacade
+    {
+    public:
+        EmptyPingFacade()
+        : _pongTimes(0)
+        {
+        }
+
+    public:
+        virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+        {
+            SessionFacade::OnSessionCreate(sessionInfo);
+            if (!sessionInfo.IsListenSession())
+                this->Ping(sessionInfo.GetSessionId());
+        }
+
+        void OnRecv(LLBC_Packet &packet)
+        {
+            if (packet.GetPayloadLength() != 0)
+                return;
+
+            if (++_pongTimes < EMPTY_PING_TIMES)
+                this->Ping(packet.GetSessionId());
+        }
+
+    public:
+        int GetPongTimes() const
+        {
+            return _pongTimes;
+        }
+
+    private:
+        void Ping(int sessionId)
+        {
+            LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+            packet->SetHeader(sessionId, EMPTY_OPCODE, 0);
+
+            this->GetService()->Send(packet);
+        }
+
+    private:
+        volatile int _pongTimes;
+    };
+}
+
+TestCase_Comm_RecvBlockPool::TestCase_Comm_RecvBlockPool()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+{
+}
+
+TestCase_Comm_RecvBlockPool::~TestCase_Comm_RecvBlockPool()
+{
+}
+
+int TestCase_Comm_RecvBlockPool::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Poller receive block pool test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788]");
+    LLBC_PrintLine("Run on %s:%d", _runIp.c_str(), _runPort);
+
+    if (this->RunPoolCheck() != LLBC_RTN_OK ||
+        this->RunEmptyPacketCheck() != LLBC_RTN_OK ||
+        this->RunSpanBlocksCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_RecvBlockPool::RunPoolCheck()
+{
+    const size_t blockSize = 1024;
+    const size_t maxIdle = 4;
+    LLBC_MessageBlockPool pool(blockSize, maxIdle);
+
+    // Empty pool, all acquires allocate.
+    LLBC_MessageBlock *blocks[6];
+    for (int i = 0; i < 6; i++)
+    {
+        blocks[i] = pool.Acquire();
+        blocks[i]->Write("llbc", 4);
+    }
+
+    bool passed = CommTestHelper::Check(pool.GetAcquireCount() == 6 && pool.GetAllocCount() == 6 &&
+        pool.GetIdleCount() == 0 && blocks[0]->GetSize() == blockSize,
+        "Acquire from empty pool: acquire %llu, alloc %llu, idle %lu",
+        pool.GetAcquireCount(), pool.GetAllocCount(), static_cast<ulong>(pool.GetIdleCount()));
+
+    // Release 6 blocks, only maxIdle blocks kept, others freed.
+    for (int i = 0; i < 6; i++)
+        pool.Release(blocks[i]);
+
+    passed = CommTestHelper::Check(pool.GetIdleCount() == maxIdle && pool.GetFreeCount() == 2,
+        "Release over max idle: idle %lu, free %llu",
+        static_cast<ulong>(pool.GetIdleCount()), pool.GetFreeCount()) && passed;
+
+    // Reuse idle blocks, reused blocks must be reset.
+    LLBC_MessageBlock *reused = pool.Acquire();
+    passed = CommTestHelper::Check(pool.GetAllocCount() == 6 && pool.GetIdleCount() == maxIdle - 1 &&
+        reused->GetReadPos() == 0 && reused->GetWritePos() == 0 && reused->GetNext() == NULL,
+        "Acquire from idle pool: alloc %llu, idle %lu, reused block reset",
+        pool.GetAllocCount(), static_cast<ulong>(pool.GetIdleCount())) && passed;
+
+    // Release chain, the block not pool size will be freed.
+    LLBC_MessageBlock *foreign = LLBC_New1(LLBC_MessageBlock, blockSize * 2);
+    reused->SetNext(foreign);
+    pool.ReleaseChain(reused);
+
+    passed = CommTestHelper::Check(pool.GetIdleCount() == maxIdle && pool.GetFreeCount() == 3,
+        "Release chain with foreign size block: idle %lu, free %llu",
+        static_cast<ulong>(pool.GetIdleCount()), pool.GetFreeCount()) && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_RecvBlockPool::RunEmptyPacketCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    CommTestHelper::EchoFacade *echoFacade = LLBC_New(CommTestHelper::EchoFacade);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(EMPTY_OPCODE, echoFacade, &CommTestHelper::EchoFacade::OnRecv);
+
+    EmptyPingFacade *pingFacade = LLBC_New(EmptyPingFacade);
+    client->RegisterFacade(pingFacade);
+    client->Subscribe(EMPTY_OPCODE, pingFacade, &EmptyPingFacade::OnRecv);
+
+    server->SetId(1);
+    client->SetId(2);
+
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Empty payload packets delivered as soon as header received.
+    CommTestHelper::WaitFor(pingFacade, &EmptyPingFacade::GetPongTimes, EMPTY_PING_TIMES);
+    const bool passed = CommTestHelper::Check(pingFacade->GetPongTimes() == EMPTY_PING_TIMES,
+        "Empty payload ping-pong %d times, pong %d times", EMPTY_PING_TIMES, pingFacade->GetPongTimes());
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_RecvBlockPool::RunSpanBlocksCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    // Payloads up to several receive blocks size, packets span pooled blocks chain.
+    return CommTestHelper::RunEchoCheck("SpanBlocks", server, client, _runIp.c_str(), _runPort + 1,
+        OPCODE, SPAN_PACKET_COUNT, LLBC_CFG_COMM_POLLER_RECV_BLOCK_SIZE * 4);
+}
@@ -0,0 +1,35 @@
+/**
+ * @file    TestCase_Comm_RecvBlockPool.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The poller receive block pool testcase, check pool reuse/release and
+ *          packets(include empty payload packets) receive through pooled blocks chain.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_RECV_BLOCK_POOL_H__
+#define __LLBC_TEST_CASE_COMM_RECV_BLOCK_POOL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_RecvBlockPool : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_RecvBlockPool();
+    virtual ~TestCase_Comm_RecvBlockPool();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunPoolCheck();
+    int RunEmptyPacketCheck();
+    int RunSpanBlocksCheck();
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_RECV_BLOCK_POOL_H__
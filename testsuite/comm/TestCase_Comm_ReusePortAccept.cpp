@@ -0,0 +1,411 @@
+/**
+ * @file    TestCase_Comm_ReusePortAccept.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_ReusePortAccept.h"
+
+namespace
+{
+
+const int MAX_POLLER_COUNT = 32;
+
+const int OPCODE = 1;
+
+const int CHECK_POLLER_COUNT = 4;
+const int CHECK_SESSION_COUNT = 40;
+const int CHECK_PACKETS_PER_SESSION = 20;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 1024;
+
+/**
+ * Listen count facade, echo packets and count listen sessions.
+ */
+class ListenCountFacade : public CommTestHelper::EchoFacade
+{
+public:
+    ListenCountFacade()
+    : _listenCount(0)
+    {
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        if (sessionInfo.IsListenSession())
+            _listenCount += 1;
+
+        EchoFacade::OnSessionCreate(sessionInfo);
+    }
+
+public:
+    int GetListenCount() const
+    {
+        return _listenCount;
+    }
+
+private:
+    volatile int _listenCount;
+};
+
+class AcceptFacade : public LLBC_IFacade
+{
+public:
+    AcceptFacade(int pollerCount)
+    : _pollerCount(pollerCount)
+    , _acceptCount(0)
+    {
+        LLBC_MemSet(_pollerAcceptCounts, 0, sizeof(_pollerAcceptCounts));
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        if (sessionInfo.IsListenSession())
+            return;
+
+        // Session dispatch to poller by session Id, so session Id hash is the poller which own it.
+        _pollerAcceptCounts[sessionInfo.GetSessionId() % _pollerCount] += 1;
+        _acceptCount += 1;
+    }
+
+public:
+    int GetAcceptCount() const
+    {
+        return _acceptCount;
+    }
+
+    int GetPollerAcceptCount(int pollerId) const
+    {
+        return _pollerAcceptCounts[pollerId];
+    }
+
+private:
+    int _pollerCount;
+    volatile int _acceptCount;
+    int _pollerAcceptCounts[MAX_POLLER_COUNT];
+};
+
+/**
+ * \brief The connector task, simulate login storm, all threads connect and close as fast as possible.
+ */
+class ConnectorTask : public LLBC_BaseTask
+{
+public:
+    ConnectorTask(const LLBC_SockAddr_IN &peer, int connCount)
+    : _peer(peer)
+    , _connCount(connCount)
+
+    , _nextConn(0)
+    , _failedCount(0)
+    , _cleanuped(false)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        while (LLBC_AtomicFetchAndAdd(&_nextConn, 1) < _connCount)
+        {
+            LLBC_SocketHandle handle = LLBC_CreateTcpSocket();
+            if (handle == LLBC_INVALID_SOCKET_HANDLE ||
+                LLBC_ConnectToPeer(handle, _peer) != LLBC_RTN_OK)
+                LLBC_AtomicFetchAndAdd(&_failedCount, 1);
+
+            if (handle != LLBC_INVALID_SOCKET_HANDLE)
+                LLBC_CloseSocket(handle);
+        }
+    }
+
+    virtual void Cleanup()
+    {
+        _cleanuped = true;
+    }
+
+public:
+    /**
+     * Wait all connector threads stopped, Cleanup() called by the last stopped thread.
+     */
+    void WaitStopped()
+    {
+        this->Wait();
+        while (!_cleanuped)
+            LLBC_ThreadManager::Sleep(1);
+    }
+
+    int GetFailedCount() const
+    {
+        return _failedCount;
+    }
+
+private:
+    LLBC_SockAddr_IN _peer;
+    int _connCount;
+
+    volatile sint32 _nextConn;
+    volatile sint32 _failedCount;
+    volatile bool _cleanuped;
+};
+
+}
+
+TestCase_Comm_ReusePortAccept::TestCase_Comm_ReusePortAccept()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _pollerCount(4)
+, _connThreadNum(4)
+, _connCount(5000)
+{
+}
+
+TestCase_Comm_ReusePortAccept::~TestCase_Comm_ReusePortAccept()
+{
+}
+
+int TestCase_Comm_ReusePortAccept::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Reuse port multi-acceptor listen test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _pollerCount = MIN(MAX_POLLER_COUNT, MAX(1, LLBC_Str2Int32(argv[3])));
+    if (argc >= 5)
+        _connThreadNum = MAX(1, LLBC_Str2Int32(argv[4]));
+    if (argc >= 6)
+        _connCount = MAX(1, LLBC_Str2Int32(argv[5]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [pollerCount=4] [connThreadNum=4] [connCount=5000]");
+    LLBC_PrintLine("Run on %s:%d, pollers: %d, connect threads: %d, connections: %d",
+        _runIp.c_str(), _runPort, _pollerCount, _connThreadNum, _connCount);
+
+    if (this->RunPortZeroCheck() != LLBC_RTN_OK ||
+        this->RunAcceptCheck() != LLBC_RTN_OK ||
+        this->RunCloseListenCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (this->RunBenchmark(false, _runPort) != LLBC_RTN_OK ||
+        this->RunBenchmark(true, _runPort + 1) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_ReusePortAccept::RunPortZeroCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    server->SetReusePortListen(true);
+
+    // Kernel assigned port differs per socket, reuse port listen on port 0 must be rejected.
+    const bool rejected = server->Listen(_runIp.c_str(), 0) == 0 &&
+        LLBC_GetLastError() == LLBC_ERROR_INVALID;
+    const bool passed = CommTestHelper::Check(rejected, "Reuse port listen on port 0 rejected");
+
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_ReusePortAccept::RunAcceptCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+    server->SetReusePortListen(true);
+
+    ListenCountFacade *serverFacade = LLBC_New(ListenCountFacade);
+    server->RegisterFacade(serverFacade);
+    server->Subscribe(OPCODE, static_cast<CommTestHelper::EchoFacade *>(serverFacade), &CommTestHelper::EchoFacade::OnRecv);
+
+    CommTestHelper::RecvFacade *recvFacade = LLBC_New(CommTestHelper::RecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(OPCODE, recvFacade, &CommTestHelper::RecvFacade::OnRecv);
+
+    if (server->Listen(_runIp.c_str(), _runPort) == 0 ||
+        server->Start(CHECK_POLLER_COUNT) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start server on %s:%d failed, err: %s",
+            _runIp.c_str(), _runPort, LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Every poller owns one listen session.
+    CommTestHelper::WaitFor(serverFacade, &ListenCountFacade::GetListenCount, CHECK_POLLER_COUNT);
+    bool passed = CommTestHelper::Check(serverFacade->GetListenCount() == CHECK_POLLER_COUNT,
+        "Reuse port listen with %d pollers, listen sessions %d",
+        CHECK_POLLER_COUNT, serverFacade->GetListenCount());
+
+    // Sessions accepted by any poller, and packets echo through every session.
+    LLBC_SessionIdList sessionIds;
+    for (int i = 0; i < CHECK_SESSION_COUNT; i++)
+    {
+        const int sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort);
+        if (sessionId != 0)
+            sessionIds.push_back(sessionId);
+    }
+
+    CommTestHelper::WaitFor(serverFacade, &CommTestHelper::SessionFacade::GetCreatedCount, CHECK_SESSION_COUNT);
+    passed = CommTestHelper::Check(static_cast<int>(sessionIds.size()) == CHECK_SESSION_COUNT &&
+        serverFacade->GetCreatedCount() == CHECK_SESSION_COUNT,
+        "Connect %d sessions, connected %lu, accepted %d",
+        CHECK_SESSION_COUNT, static_cast<ulong>(sessionIds.size()), serverFacade->GetCreatedCount()) && passed;
+
+    for (size_t i = 0; i < sessionIds.size(); i++)
+        passed = (CommTestHelper::SendPayloads(client, sessionIds[i], OPCODE,
+            CHECK_PACKETS_PER_SESSION, CHECK_MAX_PAYLOAD_SIZE) == LLBC_RTN_OK) && passed;
+
+    const int expectCount = static_cast<int>(sessionIds.size()) * CHECK_PACKETS_PER_SESSION;
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::RecvFacade::GetRecvCount, expectCount);
+    passed = CommTestHelper::Check(recvFacade->GetMatchedCount() == expectCount,
+        "Echo %d packets through %lu sessions, recv %d, matched %d",
+        expectCount, static_cast<ulong>(sessionIds.size()),
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount()) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_ReusePortAccept::RunCloseListenCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    server->SetReusePortListen(true);
+
+    ListenCountFacade *serverFacade = LLBC_New(ListenCountFacade);
+    server->RegisterFacade(serverFacade);
+
+    int listenSessionId = 0;
+    if ((listenSessionId = server->Listen(_runIp.c_str(), _runPort)) == 0 ||
+        server->Start(CHECK_POLLER_COUNT) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start server on %s:%d failed, err: %s",
+            _runIp.c_str(), _runPort, LLBC_FormatLastError());
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::WaitFor(serverFacade, &ListenCountFacade::GetListenCount, CHECK_POLLER_COUNT);
+
+    // Remove the listen session returned by Listen(), all pollers' listen sessions destroyed.
+    server->RemoveSession(listenSessionId);
+    CommTestHelper::WaitFor(serverFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, CHECK_POLLER_COUNT);
+    LLBC_Sleep(50);
+
+    bool passed = CommTestHelper::Check(serverFacade->GetDestroyedCount() == CHECK_POLLER_COUNT,
+        "Remove listen session, listen sessions %d, destroyed %d",
+        serverFacade->GetListenCount(), serverFacade->GetDestroyedCount());
+
+    // No listen socket left, all connections refused.
+    LLBC_SockAddr_IN peer;
+    peer.SetIp(_runIp.c_str());
+    peer.SetPort(static_cast<uint16>(_runPort));
+
+    int connectedCount = 0;
+    for (int i = 0; i < CHECK_SESSION_COUNT; i++)
+    {
+        LLBC_SocketHandle handle = LLBC_CreateTcpSocket();
+        if (handle != LLBC_INVALID_SOCKET_HANDLE &&
+            LLBC_ConnectToPeer(handle, peer) == LLBC_RTN_OK)
+            connectedCount += 1;
+
+        if (handle != LLBC_INVALID_SOCKET_HANDLE)
+            LLBC_CloseSocket(handle);
+    }
+
+    passed = CommTestHelper::Check(connectedCount == 0,
+        "Connect %d times after listen session removed, connected %d",
+        CHECK_SESSION_COUNT, connectedCount) && passed;
+
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_ReusePortAccept::RunBenchmark(bool reusePort, int port)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    if (reusePort && server->SetReusePortListen(true) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Set reuse port listen failed, err: %s", LLBC_FormatLastError());
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    AcceptFacade *acceptFacade = LLBC_New1(AcceptFacade, _pollerCount);
+    server->RegisterFacade(acceptFacade);
+
+    if (server->Listen(_runIp.c_str(), port) == 0 ||
+        server->Start(_pollerCount) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Start server on %s:%d failed, err: %s",
+            _runIp.c_str(), port, LLBC_FormatLastError());
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Wait all pollers listen sockets ready.
+    LLBC_Sleep(200);
+
+    LLBC_SockAddr_IN peer;
+    peer.SetIp(_runIp.c_str());
+    peer.SetPort(static_cast<uint16>(port));
+
+    ConnectorTask connector(peer, _connCount);
+
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    if (connector.Activate(_connThreadNum) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Activate connector task failed, err: %s", LLBC_FormatLastError());
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    connector.WaitStopped();
+
+    const int expectAcceptCount = _connCount - connector.GetFailedCount();
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 30000;
+    while (acceptFacade->GetAcceptCount() < expectAcceptCount &&
+           LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+
+    LLBC_PrintLine("[%-11s] accepted %d/%d connections(failed: %d) used %5lld ms, %8.0f accepts/s",
+        reusePort ? "ReusePort" : "SingleListen",
+        acceptFacade->GetAcceptCount(),
+        _connCount,
+        connector.GetFailedCount(),
+        usedTime / 1000,
+        static_cast<double>(acceptFacade->GetAcceptCount()) * 1000000 / usedTime);
+
+    LLBC_String dist;
+    for (int i = 0; i < _pollerCount; i++)
+        dist.append_format(" poller[%d]: %d", i, acceptFacade->GetPollerAcceptCount(i));
+    LLBC_PrintLine("              sessions per poller:%s", dist.c_str());
+
+    const bool allAccepted = acceptFacade->GetAcceptCount() == expectAcceptCount;
+
+    LLBC_Delete(server);
+
+    return allAccepted ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
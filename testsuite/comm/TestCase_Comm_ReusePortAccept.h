@@ -0,0 +1,40 @@
+/**
+ * @file    TestCase_Comm_ReusePortAccept.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library reuse port multi-acceptor listen testcase, check port 0 rejected,
+ *          accepted sessions work and listen sessions close together, then benchmark accept rate.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_REUSE_PORT_ACCEPT_H__
+#define __LLBC_TEST_CASE_COMM_REUSE_PORT_ACCEPT_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_ReusePortAccept : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_ReusePortAccept();
+    virtual ~TestCase_Comm_ReusePortAccept();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunPortZeroCheck();
+    int RunAcceptCheck();
+    int RunCloseListenCheck();
+
+    int RunBenchmark(bool reusePort, int port);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _pollerCount;
+    int _connThreadNum;
+    int _connCount;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_REUSE_PORT_ACCEPT_H__
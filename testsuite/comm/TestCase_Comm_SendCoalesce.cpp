@@ -0,0 +1,257 @@
+/**
+ * @file    TestCase_Comm_SendCoalesce.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_SendCoalesce.h"
+
+namespace
+{
+
+const int OPCODE = 1;
+const size_t MAX_PAYLOAD_SIZE = 64;
+
+const int CHECK_PACKETS_PER_FRAME = 30;
+const int CHECK_TOTAL_PACKETS = 3000;
+const int CHECK_PING_TIMES = 100;
+
+/**
+ * Simulate game server frame update: every frame send a burst of small pattern payload packets to one client.
+ */
+class BurstFacade : public CommTestHelper::SessionFacade
+{
+public:
+    BurstFacade(int packetsPerFrame, int totalPackets)
+    : _packetsPerFrame(packetsPerFrame)
+    , _totalPackets(totalPackets)
+
+    , _sentCount(0)
+    {
+    }
+
+public:
+    virtual void OnUpdate()
+    {
+        const int sessionId = this->GetSessionId();
+        if (sessionId == 0 || _sentCount >= _totalPackets)
+            return;
+
+        const int count = MIN(_packetsPerFrame, _totalPackets - _sentCount);
+        CommTestHelper::SendPayloads(this->GetService(), sessionId, OPCODE, count, MAX_PAYLOAD_SIZE, _sentCount);
+        _sentCount += count;
+    }
+
+private:
+    int _packetsPerFrame;
+    int _totalPackets;
+
+    int _sentCount;
+};
+
+/**
+ * Run burst send, wait client received all packets.
+ * @return double - the packets per syscall, if any packet lost or broken, or sent packets count not equal to
+ *                  the received count(only count packets completely written to socket), return -1.0.
+ */
+double RunBurst(const LLBC_String &ip,
+                int port,
+                int packetsPerFrame,
+                int totalPackets,
+                bool coalescing,
+                size_t maxBytes,
+                sint64 *usedTime)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    BurstFacade *burstFacade = LLBC_New2(BurstFacade, packetsPerFrame, totalPackets);
+    server->RegisterFacade(burstFacade);
+
+    CommTestHelper::RecvFacade *recvFacade = LLBC_New(CommTestHelper::RecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(OPCODE, recvFacade, &CommTestHelper::RecvFacade::OnRecv);
+
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        svcs[i]->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    }
+
+    server->SetSendCoalescing(coalescing, LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_DELAY, maxBytes);
+
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    if (CommTestHelper::ListenAndStart(server, ip.c_str(), port) == 0 ||
+        CommTestHelper::ConnectAndStart(client, ip.c_str(), port) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return -1.0;
+    }
+
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::RecvFacade::GetRecvCount, totalPackets, 30000);
+    if (usedTime)
+        *usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+
+    uint64 sentPackets, sendSyscalls;
+    server->GetSendStats(sentPackets, sendSyscalls);
+
+    const bool allMatched = recvFacade->GetMatchedCount() == totalPackets &&
+        sentPackets == static_cast<uint64>(totalPackets);
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    if (!allMatched)
+        return -1.0;
+
+    return sendSyscalls > 0 ? static_cast<double>(sentPackets) / sendSyscalls : 0.0;
+}
+
+}
+
+TestCase_Comm_SendCoalesce::TestCase_Comm_SendCoalesce()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+, _packetsPerFrame(30)
+, _totalPackets(30000)
+{
+}
+
+TestCase_Comm_SendCoalesce::~TestCase_Comm_SendCoalesce()
+{
+}
+
+int TestCase_Comm_SendCoalesce::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Session send coalescing test:");
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _packetsPerFrame = MAX(1, LLBC_Str2Int32(argv[3]));
+    if (argc >= 5)
+        _totalPackets = MAX(1, LLBC_Str2Int32(argv[4]));
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788] [packetsPerFrame=30] [totalPackets=30000]");
+    LLBC_PrintLine("Run on %s:%d, packets per frame: %d, total packets: %d",
+        _runIp.c_str(), _runPort, _packetsPerFrame, _totalPackets);
+
+    if (this->RunCoalesceCheck() != LLBC_RTN_OK ||
+        this->RunLatencyCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (this->RunBenchmark(false, _runPort) != LLBC_RTN_OK ||
+        this->RunBenchmark(true, _runPort + 1) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_SendCoalesce::RunCoalesceCheck()
+{
+    // Immediate send as baseline.
+    const double immediateRatio = RunBurst(_runIp, _runPort,
+        CHECK_PACKETS_PER_FRAME, CHECK_TOTAL_PACKETS, false, LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES, NULL);
+    bool passed = CommTestHelper::Check(immediateRatio > 0.0,
+        "Immediate send %d packets, all matched, %.2f packets/syscall",
+        CHECK_TOTAL_PACKETS, immediateRatio);
+
+    // Coalescing, every frame burst packets coalesced to few syscalls.
+    const double coalescedRatio = RunBurst(_runIp, _runPort + 1,
+        CHECK_PACKETS_PER_FRAME, CHECK_TOTAL_PACKETS, true, LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES, NULL);
+    passed = CommTestHelper::Check(coalescedRatio > 0.0 && coalescedRatio >= immediateRatio * 2,
+        "Coalescing send %d packets, all matched, %.2f packets/syscall(immediate %.2f)",
+        CHECK_TOTAL_PACKETS, coalescedRatio, immediateRatio) && passed;
+
+    // Coalescing with small max bytes, reach max bytes flush immediately, packets intact.
+    const size_t maxBytes = MAX_PAYLOAD_SIZE * 4;
+    const double maxBytesRatio = RunBurst(_runIp, _runPort + 2,
+        CHECK_PACKETS_PER_FRAME, CHECK_TOTAL_PACKETS, true, maxBytes, NULL);
+    passed = CommTestHelper::Check(maxBytesRatio > 0.0 && maxBytesRatio < coalescedRatio,
+        "Coalescing send %d packets with max bytes %lu, all matched, %.2f packets/syscall",
+        CHECK_TOTAL_PACKETS, static_cast<ulong>(maxBytes), maxBytesRatio) && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_SendCoalesce::RunLatencyCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    CommTestHelper::EchoFacade *echoFacade = LLBC_New(CommTestHelper::EchoFacade);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(OPCODE, echoFacade, &CommTestHelper::EchoFacade::OnRecv);
+
+    CommTestHelper::PingFacade *pingFacade = LLBC_New2(CommTestHelper::PingFacade, OPCODE, CHECK_PING_TIMES);
+    client->RegisterFacade(pingFacade);
+    client->Subscribe(OPCODE, pingFacade, &CommTestHelper::PingFacade::OnRecv);
+
+    // Event-driven services, round trip time only depend on send path.
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        svcs[i]->SetEventDriven(true);
+        svcs[i]->SetSendCoalescing(true);
+    }
+
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    if (CommTestHelper::ListenAndStart(server, _runIp.c_str(), _runPort) == 0 ||
+        CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort) == 0)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Single packet must be flushed when queued events batch drained, not stuck in coalescing queue.
+    CommTestHelper::WaitFor(pingFacade, &CommTestHelper::PingFacade::IsFinished, 10000);
+    std::vector<sint64> &rtts = pingFacade->GetRTTs();
+    const sint64 usedTime = LLBC_GetMilliSeconds() - begTime;
+    CommTestHelper::PrintRTTs("Coalescing", rtts, usedTime);
+
+    std::sort(rtts.begin(), rtts.end());
+    const sint64 maxRtt = rtts.empty() ? -1 : rtts.back();
+    const bool passed = CommTestHelper::Check(pingFacade->IsFinished() && maxRtt < 50 * 1000,
+        "Coalescing ping-pong %d times, finished %d, max rtt %lld us",
+        CHECK_PING_TIMES, static_cast<int>(rtts.size()), maxRtt);
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_SendCoalesce::RunBenchmark(bool coalescing, int port)
+{
+    sint64 usedTime = 0;
+    const double ratio = RunBurst(_runIp, port,
+        _packetsPerFrame, _totalPackets, coalescing, LLBC_CFG_COMM_DFT_SEND_COALESCE_MAX_BYTES, &usedTime);
+    if (ratio < 0.0)
+    {
+        LLBC_FilePrintLine(stderr, "[%s] packets lost or broken", coalescing ? "Coalescing" : "Immediate");
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_PrintLine("[%-10s] %d packets used %6lld ms, %8.0f packets/s, %.2f packets/syscall",
+        coalescing ? "Coalescing" : "Immediate",
+        _totalPackets,
+        usedTime / 1000,
+        static_cast<double>(_totalPackets) * 1000000 / usedTime,
+        ratio);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file    TestCase_Comm_SendCoalesce.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library session send coalescing testcase, check coalesced packets integrity,
+ *          packets per syscall and latency, then benchmark packets per syscall/throughput.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_SEND_COALESCE_H__
+#define __LLBC_TEST_CASE_COMM_SEND_COALESCE_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_SendCoalesce : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_SendCoalesce();
+    virtual ~TestCase_Comm_SendCoalesce();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunCoalesceCheck();
+    int RunLatencyCheck();
+
+    int RunBenchmark(bool coalescing, int port);
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+    int _packetsPerFrame;
+    int _totalPackets;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_SEND_COALESCE_H__
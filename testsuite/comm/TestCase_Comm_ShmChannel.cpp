@@ -0,0 +1,705 @@
+/**
+ * @file    TestCase_Comm_ShmChannel.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_ShmChannel.h"
+
+#if LLBC_TARGET_PLATFORM_LINUX
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+namespace
+{
+
+const int PING_OPCODE = 1;
+const int STREAM_OPCODE = 2;
+const int DATA_OPCODE = 3;
+
+// Stream window size, client request next window after received whole window.
+const int STREAM_WINDOW = 1000;
+
+const int CHECK_PACKET_COUNT = 200;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 8192;
+const size_t CHECK_RING_SIZE = 4096;
+
+// Shared-memory segment layout, the corrupt peer write ring positions directly:
+// | seg head(64) | ring0 head(128) | ring1 head(128) | ring0 data | ring1 data |,
+// ring head: writePos at offset 0, readPos at offset 64, ring0 is connector->acceptor direction.
+const size_t SEG_HEAD_SIZE = 64;
+const size_t RING_HEAD_SIZE = 128;
+const size_t RING0_READ_POS_OFFSET = SEG_HEAD_SIZE + 64;
+const size_t RING1_WRITE_POS_OFFSET = SEG_HEAD_SIZE + RING_HEAD_SIZE;
+
+/**
+ * \brief The stream data coder.
+ */
+struct StreamData : public LLBC_ICoder
+{
+    sint32 seq;
+    LLBC_String payload;
+
+    virtual void Encode(LLBC_Packet &packet)
+    {
+        packet <<seq <<payload;
+    }
+
+    virtual void Decode(LLBC_Packet &packet)
+    {
+        packet >>seq >>payload;
+    }
+};
+
+class StreamDataFactory : public LLBC_ICoderFactory
+{
+public:
+    virtual LLBC_ICoder *Create() const
+    {
+        return LLBC_New(StreamData);
+    }
+};
+
+/**
+ * Server side(run in child process): echo ping packets, send a window of stream data when client request.
+ */
+class ServerFacade : public LLBC_IFacade
+{
+public:
+    ServerFacade(int totalPackets, size_t payloadSize)
+    : _totalPackets(totalPackets)
+    , _payload(payloadSize, 'a')
+    , _sentCount(0)
+    {
+    }
+
+public:
+    void OnPing(LLBC_Packet &packet)
+    {
+        LLBC_Packet *resPacket = LLBC_New(LLBC_Packet);
+        resPacket->SetHeader(packet, PING_OPCODE, 0);
+        resPacket->Write(packet.GetPayload(), packet.GetPayloadLength());
+
+        this->GetService()->Send(resPacket);
+    }
+
+    void OnRequestStream(LLBC_Packet &packet)
+    {
+        const int sessionId = packet.GetSessionId();
+        for (int i = 0; i < STREAM_WINDOW && _sentCount < _totalPackets; i++, _sentCount++)
+        {
+            StreamData *data = LLBC_New(StreamData);
+            data->seq = _sentCount;
+            data->payload = _payload;
+
+            // Cast to coder, otherwise will match the Send<T>() template method.
+            this->GetService()->Send(sessionId, DATA_OPCODE, static_cast<LLBC_ICoder *>(data), 0);
+        }
+    }
+
+private:
+    int _totalPackets;
+    LLBC_String _payload;
+    int _sentCount;
+};
+
+/**
+ * Client side: ping-pong first, after all pings finished, request server to stream data.
+ */
+class ClientFacade : public LLBC_IFacade
+{
+public:
+    ClientFacade(int pingTimes, int totalPackets)
+    : _pingTimes(pingTimes)
+    , _totalPackets(totalPackets)
+    , _sessionId(0)
+    , _pingFinished(false)
+    , _pingBegTime(0)
+
+    , _streamBegTime(0)
+    , _recvCount(0)
+    , _recvBytes(0)
+    , _badCount(0)
+    {
+        _rtts.reserve(pingTimes);
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        if (sessionInfo.IsListenSession())
+            return;
+
+        _sessionId = sessionInfo.GetSessionId();
+        _pingBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        this->Ping(_sessionId);
+    }
+
+    void OnPong(LLBC_Packet &packet)
+    {
+        sint64 sendTime;
+        packet.Read(sendTime);
+
+        _rtts.push_back(LLBC_CPUTime::Current().ToMicroSeconds() - sendTime);
+        if (static_cast<int>(_rtts.size()) < _pingTimes)
+        {
+            this->Ping(packet.GetSessionId());
+            return;
+        }
+
+        _streamBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        _pingFinished = true;
+
+        this->GetService()->Send(packet.GetSessionId(), STREAM_OPCODE, "", 0, 0);
+    }
+
+    void OnData(LLBC_Packet &packet)
+    {
+        StreamData *data = static_cast<StreamData *>(packet.GetDecoder());
+        if (!data || data->seq != _recvCount)
+            _badCount += 1;
+        else
+            _recvBytes += data->payload.size();
+
+        _recvCount += 1;
+        if (_recvCount % STREAM_WINDOW == 0 && _recvCount < _totalPackets)
+            this->GetService()->Send(packet.GetSessionId(), STREAM_OPCODE, "", 0, 0);
+    }
+
+public:
+    bool IsPingFinished() const
+    {
+        return _pingFinished;
+    }
+
+    std::vector<sint64> &GetRTTs()
+    {
+        return _rtts;
+    }
+
+    sint64 GetPingBeginTime() const
+    {
+        return _pingBegTime;
+    }
+
+    sint64 GetStreamBeginTime() const
+    {
+        return _streamBegTime;
+    }
+
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    sint64 GetRecvBytes() const
+    {
+        return _recvBytes;
+    }
+
+    int GetBadCount() const
+    {
+        return _badCount;
+    }
+
+private:
+    void Ping(int sessionId)
+    {
+        LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+        packet->SetHeader(sessionId, PING_OPCODE, 0);
+        packet->Write(static_cast<sint64>(LLBC_CPUTime::Current().ToMicroSeconds()));
+
+        this->GetService()->Send(packet);
+    }
+
+private:
+    int _pingTimes;
+    int _totalPackets;
+    volatile int _sessionId;
+    volatile bool _pingFinished;
+    sint64 _pingBegTime;
+    std::vector<sint64> _rtts;
+
+    sint64 _streamBegTime;
+    volatile int _recvCount;
+    sint64 _recvBytes;
+    int _badCount;
+};
+
+/**
+ * \brief The shm connect task, connect to shared-memory channel in task thread.
+ */
+class ShmConnectTask : public LLBC_BaseTask
+{
+public:
+    ShmConnectTask(LLBC_IService *svc, const LLBC_String &path)
+    : _svc(svc)
+    , _path(path)
+    , _sessionId(-1)
+    , _errNo(LLBC_ERROR_SUCCESS)
+    , _cleanuped(false)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        _sessionId = _svc->ConnectShm(_path.c_str(), CHECK_RING_SIZE);
+        if (_sessionId == 0)
+            _errNo = LLBC_GetLastError();
+    }
+
+    virtual void Cleanup()
+    {
+        _cleanuped = true;
+    }
+
+public:
+    void WaitStopped()
+    {
+        this->Wait();
+        while (!_cleanuped)
+            LLBC_ThreadManager::Sleep(1);
+    }
+
+    int GetSessionId() const
+    {
+        return _sessionId;
+    }
+
+    int GetErrNo() const
+    {
+        return _errNo;
+    }
+
+private:
+    LLBC_IService *_svc;
+    LLBC_String _path;
+
+    volatile int _sessionId;
+    volatile int _errNo;
+    volatile bool _cleanuped;
+};
+
+void PrepareService(LLBC_IService *svc, int id)
+{
+    svc->SetId(id);
+    svc->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+    // Don't let service frame interval hide the transport cost.
+    svc->SetEventDriven(true);
+    svc->SetPollerIntegratedLoop(true);
+}
+
+#if LLBC_TARGET_PLATFORM_LINUX
+/**
+ * Wait to be killed, if parent process exited, exit too.
+ */
+void WaitKilled(pid_t parentPid)
+{
+    while (::getppid() == parentPid)
+        LLBC_Sleep(100);
+}
+
+void KillProcess(pid_t pid)
+{
+    ::kill(pid, SIGKILL);
+    ::waitpid(pid, NULL, 0);
+}
+
+/**
+ * Corrupt peer(run in child process): accept shm channel handshake manually, then write out of range
+ * ring position to the segment.
+ */
+void RunCorruptPeer(const char *path, bool corruptRecv)
+{
+    const pid_t parentPid = ::getppid();
+
+    LLBC_SocketHandle listenHandle = LLBC_CreateUnixSocket();
+    if (listenHandle == LLBC_INVALID_SOCKET_HANDLE ||
+        LLBC_BindToUnixAddress(listenHandle, path) != LLBC_RTN_OK ||
+        LLBC_ListenForConnection(listenHandle, SOMAXCONN) != LLBC_RTN_OK)
+        return;
+
+    const LLBC_SocketHandle handle = ::accept(listenHandle, NULL, NULL);
+    if (handle == LLBC_INVALID_SOCKET_HANDLE)
+        return;
+
+    // Handshake message: magic, version, ringSize, reserved, carry segment fd and connector's doorbell.
+    uint32 handshake[4];
+    int fds[2] = {-1, -1};
+    int fdCount = 2;
+    if (LLBC_RecvWithFds(handle, handshake, sizeof(handshake), fds, fdCount) != static_cast<int>(sizeof(handshake)) ||
+        fdCount != 2)
+        return;
+
+    const size_t ringSize = handshake[2];
+    char *seg = reinterpret_cast<char *>(::mmap(NULL, SEG_HEAD_SIZE + RING_HEAD_SIZE * 2 + ringSize * 2,
+        PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0));
+    if (seg == MAP_FAILED)
+        return;
+
+    // Corrupt before handshake replied, connector will see it when first time reload the position.
+    if (corruptRecv)
+    {
+        // Connector's recv ring writePos far beyond ring size.
+        *reinterpret_cast<volatile sint64 *>(seg + RING1_WRITE_POS_OFFSET) = static_cast<sint64>(ringSize * 4);
+    }
+    else
+    {
+        // Connector's send ring readPos greater than writePos, connector will see it when ring full.
+        *reinterpret_cast<volatile sint64 *>(seg + RING0_READ_POS_OFFSET) = static_cast<sint64>(ringSize * 4);
+    }
+
+    LLBC_Handle doorbell = LLBC_CreateEventFd();
+    if (doorbell == LLBC_INVALID_HANDLE ||
+        LLBC_SendWithFds(handle, handshake, sizeof(handshake), &doorbell, 1) != static_cast<int>(sizeof(handshake)))
+        return;
+
+    // Ring connector's doorbell, let connector read the corrupted ring.
+    if (corruptRecv)
+        LLBC_SignalEventFd(fds[1]);
+
+    WaitKilled(parentPid);
+}
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+}
+
+TestCase_Comm_ShmChannel::TestCase_Comm_ShmChannel()
+: _tcpPort(7799)
+, _shmPath()
+, _pingTimes(10000)
+, _totalPackets(200000)
+, _payloadSize(512)
+{
+}
+
+TestCase_Comm_ShmChannel::~TestCase_Comm_ShmChannel()
+{
+}
+
+int TestCase_Comm_ShmChannel::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Shared-memory channel inter-process test:");
+#if LLBC_TARGET_PLATFORM_LINUX
+    if (argc >= 2)
+        _tcpPort = LLBC_Str2Int32(argv[1]);
+    if (argc >= 3)
+        _pingTimes = MAX(1, LLBC_Str2Int32(argv[2]));
+    if (argc >= 4)
+        _totalPackets = MAX(1, LLBC_Str2Int32(argv[3]));
+    if (argc >= 5)
+        _payloadSize = static_cast<size_t>(MAX(0, LLBC_Str2Int32(argv[4])));
+
+    // Use abstract namespace address, not need to cleanup socket file.
+    _shmPath.format("@llbc_shm_test_%d", static_cast<int>(::getpid()));
+
+    LLBC_PrintLine("Usage: ./a [tcpPort=7799] [pingTimes=10000] [totalPackets=200000] [payloadSize=512]");
+    LLBC_PrintLine("Tcp: 127.0.0.1:%d, shm: %s, ping times: %d, stream packets: %d, payload size: %lu",
+        _tcpPort, _shmPath.c_str(), _pingTimes, _totalPackets, static_cast<ulong>(_payloadSize));
+
+    if (this->RunEchoCheck() != LLBC_RTN_OK ||
+        this->RunCorruptCheck(false) != LLBC_RTN_OK ||
+        this->RunCorruptCheck(true) != LLBC_RTN_OK ||
+        this->RunHandshakeLockCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (this->RunBenchmark(false) != LLBC_RTN_OK ||
+        this->RunBenchmark(true) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+#else // Non-LINUX
+    LLBC_PrintLine("Shared-memory channel only supported in LINUX platform, skip");
+#endif // LLBC_TARGET_PLATFORM_LINUX
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_ShmChannel::RunEchoCheck()
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Echo server run in child process, fork before any service created in this process.
+    const pid_t serverPid = ::fork();
+    if (serverPid == -1)
+    {
+        LLBC_FilePrintLine(stderr, "Fork server process failed, errno: %d", errno);
+        return LLBC_RTN_FAILED;
+    }
+    else if (serverPid == 0)
+    {
+        const pid_t parentPid = ::getppid();
+
+        LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+        server->SetId(1);
+
+        CommTestHelper::EchoFacade *echoFacade = LLBC_New(CommTestHelper::EchoFacade);
+        server->RegisterFacade(echoFacade);
+        server->Subscribe(DATA_OPCODE, echoFacade, &CommTestHelper::EchoFacade::OnRecv);
+        if (server->ListenShm(_shmPath.c_str()) != 0)
+            server->Start();
+
+        WaitKilled(parentPid);
+        ::_exit(0);
+    }
+
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    client->SetId(2);
+
+    CommTestHelper::RecvFacade *recvFacade = LLBC_New(CommTestHelper::RecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(DATA_OPCODE, recvFacade, &CommTestHelper::RecvFacade::OnRecv);
+
+    // Server process maybe not listened yet, retry until connected, use small ring, payloads wrap around ring.
+    int sessionId = 0;
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 5000;
+    client->Start();
+    while ((sessionId = client->ConnectShm(_shmPath.c_str(), CHECK_RING_SIZE)) == 0 &&
+           LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(10);
+
+    bool passed = sessionId != 0 && CommTestHelper::SendPayloads(client, sessionId, DATA_OPCODE,
+        CHECK_PACKET_COUNT, CHECK_MAX_PAYLOAD_SIZE) == LLBC_RTN_OK;
+
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::RecvFacade::GetRecvCount, CHECK_PACKET_COUNT);
+    passed = CommTestHelper::Check(passed && recvFacade->GetMatchedCount() == CHECK_PACKET_COUNT,
+        "Shm channel(ring size %lu) echo %d packets, recv %d, matched %d",
+        static_cast<ulong>(CHECK_RING_SIZE), CHECK_PACKET_COUNT,
+        recvFacade->GetRecvCount(), recvFacade->GetMatchedCount());
+
+    // Kill server process, simulate peer crashed, client session must be destroyed.
+    KillProcess(serverPid);
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, 1);
+    passed = CommTestHelper::Check(recvFacade->GetDestroyedCount() == 1,
+        "Shm channel server process killed, client session destroyed %d", recvFacade->GetDestroyedCount()) && passed;
+
+    LLBC_Delete(client);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+#else // Non-LINUX
+    return LLBC_RTN_OK;
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+int TestCase_Comm_ShmChannel::RunCorruptCheck(bool corruptRecv)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    const pid_t peerPid = ::fork();
+    if (peerPid == -1)
+    {
+        LLBC_FilePrintLine(stderr, "Fork corrupt peer process failed, errno: %d", errno);
+        return LLBC_RTN_FAILED;
+    }
+    else if (peerPid == 0)
+    {
+        RunCorruptPeer(_shmPath.c_str(), corruptRecv);
+        ::_exit(0);
+    }
+
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    client->SetId(2);
+
+    CommTestHelper::SessionFacade *sessionFacade = LLBC_New(CommTestHelper::SessionFacade);
+    client->RegisterFacade(sessionFacade);
+
+    int sessionId = 0;
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 5000;
+    client->Start();
+    while ((sessionId = client->ConnectShm(_shmPath.c_str(), CHECK_RING_SIZE)) == 0 &&
+           LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(10);
+
+    // Send ring corrupted only be found when ring seems full, send more than one ring data.
+    if (sessionId != 0 && !corruptRecv)
+        CommTestHelper::SendPayloads(client, sessionId, DATA_OPCODE, 20, CHECK_RING_SIZE);
+
+    // Peer still alive, but session must be closed.
+    CommTestHelper::WaitFor(sessionFacade, &CommTestHelper::SessionFacade::GetDestroyedCount, 1);
+    const bool passed = CommTestHelper::Check(sessionId != 0 && sessionFacade->GetDestroyedCount() == 1,
+        "Shm channel peer corrupt %s ring position, session destroyed %d",
+        corruptRecv ? "recv" : "send", sessionFacade->GetDestroyedCount());
+
+    KillProcess(peerPid);
+    LLBC_Delete(client);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+#else // Non-LINUX
+    return LLBC_RTN_OK;
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+int TestCase_Comm_ShmChannel::RunHandshakeLockCheck()
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Listen but never accept, connector's handshake blocking until timeout.
+    LLBC_SocketHandle listenHandle = LLBC_CreateUnixSocket();
+    if (listenHandle == LLBC_INVALID_SOCKET_HANDLE ||
+        LLBC_BindToUnixAddress(listenHandle, _shmPath.c_str()) != LLBC_RTN_OK ||
+        LLBC_ListenForConnection(listenHandle, SOMAXCONN) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Listen on %s failed, err: %s", _shmPath.c_str(), LLBC_FormatLastError());
+        if (listenHandle != LLBC_INVALID_SOCKET_HANDLE)
+            LLBC_CloseSocket(listenHandle);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    client->SetId(2);
+    client->RegisterFacade(LLBC_New(CommTestHelper::SessionFacade));
+    client->Start();
+
+    ShmConnectTask connectTask(client, _shmPath);
+    connectTask.Activate(1);
+    LLBC_Sleep(200);
+
+    // Service locked calls not blocked by the handshake.
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    client->GetFPS();
+    const sint64 usedTime = LLBC_GetMilliSeconds() - begTime;
+
+    connectTask.WaitStopped();
+    bool passed = CommTestHelper::Check(usedTime < 100,
+        "Shm channel handshake blocking, service locked call used %lld ms", usedTime);
+    passed = CommTestHelper::Check(connectTask.GetSessionId() == 0 && connectTask.GetErrNo() == LLBC_ERROR_TIMEOUT,
+        "Shm channel handshake timeout, connect failed, err: %s", LLBC_StrError(connectTask.GetErrNo())) && passed;
+
+    LLBC_Delete(client);
+    LLBC_CloseSocket(listenHandle);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+#else // Non-LINUX
+    return LLBC_RTN_OK;
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+int TestCase_Comm_ShmChannel::RunBenchmark(bool shm)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    // Server run in child process, fork before any service created in this process.
+    const pid_t serverPid = ::fork();
+    if (serverPid == -1)
+    {
+        LLBC_FilePrintLine(stderr, "Fork server process failed, errno: %d", errno);
+        return LLBC_RTN_FAILED;
+    }
+    else if (serverPid == 0)
+    {
+        this->RunServer(shm);
+        ::_exit(0);
+    }
+
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    ClientFacade *clientFacade = LLBC_New2(ClientFacade, _pingTimes, _totalPackets);
+    client->RegisterFacade(clientFacade);
+    client->RegisterCoder(DATA_OPCODE, LLBC_New(StreamDataFactory));
+    client->Subscribe(PING_OPCODE, clientFacade, &ClientFacade::OnPong);
+    client->Subscribe(DATA_OPCODE, clientFacade, &ClientFacade::OnData);
+    PrepareService(client, 2);
+
+    const char *transport = shm ? "Shm" : "Tcp";
+
+    client->Start();
+    if (this->Connect(client, shm) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(client);
+        KillProcess(serverPid);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Ping-pong.
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 60000;
+    while (!clientFacade->IsPingFinished() && LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+
+    std::vector<sint64> &rtts = clientFacade->GetRTTs();
+    if (!clientFacade->IsPingFinished() || rtts.empty())
+    {
+        LLBC_FilePrintLine(stderr, "[%-3s] ping-pong timeout", transport);
+
+        LLBC_Delete(client);
+        KillProcess(serverPid);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::PrintRTTs(transport, rtts,
+        (clientFacade->GetStreamBeginTime() - clientFacade->GetPingBeginTime()) / 1000);
+
+    // Stream.
+    while (clientFacade->GetRecvCount() < _totalPackets && LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - clientFacade->GetStreamBeginTime());
+
+    LLBC_PrintLine("[%-3s] stream recv %d/%d coder packets used %6lld ms, %8.0f packets/s, %7.2f MB/s, bad: %d",
+        transport,
+        clientFacade->GetRecvCount(),
+        _totalPackets,
+        usedTime / 1000,
+        static_cast<double>(clientFacade->GetRecvCount()) * 1000000 / usedTime,
+        static_cast<double>(clientFacade->GetRecvBytes()) / usedTime,
+        clientFacade->GetBadCount());
+
+    const bool succeed = clientFacade->GetRecvCount() == _totalPackets && clientFacade->GetBadCount() == 0;
+
+    KillProcess(serverPid);
+    LLBC_Delete(client);
+
+    return succeed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+#else // Non-LINUX
+    return LLBC_RTN_OK;
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+void TestCase_Comm_ShmChannel::RunServer(bool shm)
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    const pid_t parentPid = ::getppid();
+
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+
+    ServerFacade *serverFacade = LLBC_New2(ServerFacade, _totalPackets, _payloadSize);
+    server->RegisterFacade(serverFacade);
+    server->RegisterCoder(DATA_OPCODE, LLBC_New(StreamDataFactory));
+    server->Subscribe(PING_OPCODE, serverFacade, &ServerFacade::OnPing);
+    server->Subscribe(STREAM_OPCODE, serverFacade, &ServerFacade::OnRequestStream);
+    PrepareService(server, 1);
+
+    if ((shm ? server->ListenShm(_shmPath.c_str()) : server->Listen("127.0.0.1", _tcpPort)) == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Server listen failed, err: %s", LLBC_FormatLastError());
+        return;
+    }
+
+    server->Start();
+
+    WaitKilled(parentPid);
+#endif // LLBC_TARGET_PLATFORM_LINUX
+}
+
+int TestCase_Comm_ShmChannel::Connect(LLBC_IService *client, bool shm)
+{
+    // Server process maybe not listened yet, retry until connected.
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 5000;
+    while ((shm ? client->ConnectShm(_shmPath.c_str()) : client->Connect("127.0.0.1", _tcpPort)) == 0)
+    {
+        if (LLBC_GetMilliSeconds() >= timeoutTime)
+        {
+            LLBC_FilePrintLine(stderr, "Connect to server failed, err: %s", LLBC_FormatLastError());
+            return LLBC_RTN_FAILED;
+        }
+
+        LLBC_Sleep(10);
+    }
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file    TestCase_Comm_ShmChannel.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library shared-memory channel inter-process test and benchmark(compare with tcp loopback),
+ *          LINUX platform specific.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_SHM_CHANNEL_H__
+#define __LLBC_TEST_CASE_COMM_SHM_CHANNEL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_ShmChannel : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_ShmChannel();
+    virtual ~TestCase_Comm_ShmChannel();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunEchoCheck();
+    int RunCorruptCheck(bool corruptRecv);
+    int RunHandshakeLockCheck();
+
+    int RunBenchmark(bool shm);
+
+    void RunServer(bool shm);
+    int Connect(LLBC_IService *client, bool shm);
+
+private:
+    int _tcpPort;
+    LLBC_String _shmPath;
+    int _pingTimes;
+    int _totalPackets;
+    size_t _payloadSize;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_SHM_CHANNEL_H__
@@ -0,0 +1,194 @@
+/**
+ * @file    TestCase_Comm_SvcMetrics.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_SvcMetrics.h"
+
+namespace
+{
+    const int OPCODE = 1;
+
+    const int POLLER_COUNT = 2;
+    const int PACKET_COUNT = 200;
+    const size_t MAX_PAYLOAD_SIZE = 256;
+}
+
+TestCase_Comm_SvcMetrics::TestCase_Comm_SvcMetrics()
+: _runIp("127.0.0.1")
+, _runPort(7788)
+{
+}
+
+TestCase_Comm_SvcMetrics::~TestCase_Comm_SvcMetrics()
+{
+}
+
+int TestCase_Comm_SvcMetrics::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Service metrics test:");
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    if (argc >= 2)
+        _runIp = argv[1];
+    if (argc >= 3)
+        _runPort = LLBC_Str2Int32(argv[2]);
+
+    LLBC_PrintLine("Usage: ./a [ip=127.0.0.1] [port=7788]");
+    LLBC_PrintLine("Run on %s:%d", _runIp.c_str(), _runPort);
+
+    if (this->RunSamplerCheck() != LLBC_RTN_OK ||
+        this->RunServiceMetricsCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+#else // !LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+    LLBC_PrintLine("Sampler support disabled(LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT), skip");
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+int TestCase_Comm_SvcMetrics::RunSamplerCheck()
+{
+    LLBC_SamplerGroup group;
+
+    // Add sampler return 0 if success, repeat add failed with LLBC_ERROR_EXIST.
+    const int addRet = group.AddSampler(LLBC_SamplerType::LimitSampler, "Limit");
+    bool passed = CommTestHelper::Check(addRet == LLBC_RTN_OK,
+        "Sampler group add sampler, return %d", addRet);
+
+    const bool repeatRejected = group.AddSampler(LLBC_SamplerType::LimitSampler, "Limit") != LLBC_RTN_OK &&
+        LLBC_GetLastError() == LLBC_ERROR_EXIST;
+    passed = CommTestHelper::Check(repeatRejected, "Sampler group repeat add sampler rejected") && passed;
+
+    // Limit sampler record min/max from first sampling, and hold count statistics.
+    LLBC_LimitSampler *limit = static_cast<LLBC_LimitSampler *>(group.GetSampler("Limit"));
+    limit->Sampling(5);
+    limit->Sampling(3);
+    limit->Sampling(9);
+
+    passed = CommTestHelper::Check(limit->GetMinValue() == 3 && limit->GetMaxValue() == 9,
+        "Limit sampler sampling 5, 3, 9, min %lld, max %lld",
+        limit->GetMinValue(), limit->GetMaxValue()) && passed;
+    passed = CommTestHelper::Check(limit->GetTotalSamplingTimes() == 3 && limit->GetTotalSamplingValue() == 17,
+        "Limit sampler sampling times %llu, total value %lld",
+        limit->GetTotalSamplingTimes(), limit->GetTotalSamplingValue()) && passed;
+
+    group.Reset();
+    limit->Sampling(7);
+    passed = CommTestHelper::Check(limit->GetMinValue() == 7 && limit->GetMaxValue() == 7 &&
+        limit->GetTotalSamplingTimes() == 1,
+        "Limit sampler after reset sampling 7, min %lld, max %lld, times %llu",
+        limit->GetMinValue(), limit->GetMaxValue(), limit->GetTotalSamplingTimes()) && passed;
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_SvcMetrics::RunServiceMetricsCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    client->SetId(2);
+
+    CommTestHelper::EchoFacade *echoFacade = LLBC_New(CommTestHelper::EchoFacade);
+    server->RegisterFacade(echoFacade);
+    server->Subscribe(OPCODE, echoFacade, &CommTestHelper::EchoFacade::OnRecv);
+
+    CommTestHelper::RecvFacade *recvFacade = LLBC_New(CommTestHelper::RecvFacade);
+    client->RegisterFacade(recvFacade);
+    client->Subscribe(OPCODE, recvFacade, &CommTestHelper::RecvFacade::OnRecv);
+
+    int sessionId = 0;
+    if (server->Listen(_runIp.c_str(), _runPort) == 0 ||
+        server->Start(POLLER_COUNT) != LLBC_RTN_OK ||
+        (sessionId = CommTestHelper::ConnectAndStart(client, _runIp.c_str(), _runPort)) == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Start services failed, err: %s", LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::SendPayloads(client, sessionId, OPCODE, PACKET_COUNT, MAX_PAYLOAD_SIZE);
+    CommTestHelper::WaitFor(recvFacade, &CommTestHelper::RecvFacade::GetRecvCount, PACKET_COUNT);
+
+    // Pollers report metrics per second, wait report, then stop server, metrics can access after stopped.
+    LLBC_Sleep(1500);
+    server->Stop();
+
+    const LLBC_SamplerGroup &metrics = server->GetMetrics();
+
+    // Service scope metrics.
+    const LLBC_ISampler *recvPackets =
+        metrics.GetSampler(LLBC_SvcMetrics::GetSamplerName(LLBC_SvcMetrics::RecvPackets));
+    const LLBC_ISampler *sentPackets =
+        metrics.GetSampler(LLBC_SvcMetrics::GetSamplerName(LLBC_SvcMetrics::SentPackets));
+    const LLBC_LimitSampler *frameTime = static_cast<const LLBC_LimitSampler *>(
+        metrics.GetSampler(LLBC_SvcMetrics::GetSamplerName(LLBC_SvcMetrics::FrameTime)));
+    bool passed = CommTestHelper::Check(
+        recvPackets && recvPackets->IsBeginSampling() &&
+        sentPackets && sentPackets->IsBeginSampling() &&
+        frameTime && frameTime->GetTotalSamplingTimes() > 0,
+        "Service scope metrics sampled, recv packets: %s, sent packets: %s, frames: %llu",
+        recvPackets && recvPackets->IsBeginSampling() ? "true" : "false",
+        sentPackets && sentPackets->IsBeginSampling() ? "true" : "false",
+        frameTime ? frameTime->GetTotalSamplingTimes() : 0);
+
+    // Poller scope metrics, every poller has its samplers, and pollers reported.
+    int pollerSamplerCount = 0, reportedPollerCount = 0;
+    for (int pollerId = 0; pollerId < POLLER_COUNT; pollerId++)
+    {
+        for (int metric = LLBC_SvcMetrics::Begin; metric != LLBC_SvcMetrics::End; metric++)
+        {
+            if (metric != LLBC_SvcMetrics::FrameTime && metric != LLBC_SvcMetrics::HandlerTime &&
+                metrics.GetSampler(LLBC_SvcMetrics::GetSamplerName(metric, pollerId)))
+                pollerSamplerCount += 1;
+        }
+
+        const LLBC_ISampler *queueSize =
+            metrics.GetSampler(LLBC_SvcMetrics::GetSamplerName(LLBC_SvcMetrics::QueueSize, pollerId));
+        if (queueSize && queueSize->IsBeginSampling())
+            reportedPollerCount += 1;
+    }
+
+    const int expectPollerSamplerCount = POLLER_COUNT * (LLBC_SvcMetrics::End - 2);
+    passed = CommTestHelper::Check(pollerSamplerCount == expectPollerSamplerCount &&
+        reportedPollerCount == POLLER_COUNT,
+        "Poller scope metrics, samplers %d(expect %d), reported pollers %d(expect %d)",
+        pollerSamplerCount, expectPollerSamplerCount, reportedPollerCount, POLLER_COUNT) && passed;
+
+    // Handler scope metrics, every dispatched packet sampled.
+    const LLBC_LimitSampler *handlerTime = static_cast<const LLBC_LimitSampler *>(
+        metrics.GetSampler(LLBC_SvcMetrics::GetHandlerSamplerName(OPCODE)));
+    passed = CommTestHelper::Check(handlerTime &&
+        handlerTime->GetTotalSamplingTimes() == static_cast<uint64>(PACKET_COUNT),
+        "Handler scope metrics, opcode %d handler sampling times %llu, expect %d",
+        OPCODE, handlerTime ? handlerTime->GetTotalSamplingTimes() : 0, PACKET_COUNT) && passed;
+
+    // Restart service, samplers reused and last running metrics cleared.
+    const bool restarted = server->Start(POLLER_COUNT) == LLBC_RTN_OK;
+    server->Stop();
+
+    const LLBC_LimitSampler *restartHandlerTime = static_cast<const LLBC_LimitSampler *>(
+        metrics.GetSampler(LLBC_SvcMetrics::GetHandlerSamplerName(OPCODE)));
+    passed = CommTestHelper::Check(restarted && restartHandlerTime == handlerTime &&
+        handlerTime->GetTotalSamplingTimes() == 0,
+        "Restart service, handler sampler reused and reset, sampling times %llu",
+        handlerTime ? handlerTime->GetTotalSamplingTimes() : 0) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
@@ -0,0 +1,36 @@
+/**
+ * @file    TestCase_Comm_SvcMetrics.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The service metrics testcase, check metric samplers(limit/count/group) and
+ *          service/poller/handler scope metrics sampling.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_SVC_METRICS_H__
+#define __LLBC_TEST_CASE_COMM_SVC_METRICS_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_SvcMetrics : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_SvcMetrics();
+    virtual ~TestCase_Comm_SvcMetrics();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+#if LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+private:
+    int RunSamplerCheck();
+    int RunServiceMetricsCheck();
+#endif // LLBC_CFG_COMM_ENABLE_SAMPLER_SUPPORT
+
+private:
+    LLBC_String _runIp;
+    int _runPort;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_SVC_METRICS_H__
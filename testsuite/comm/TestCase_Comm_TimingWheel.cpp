@@ -0,0 +1,203 @@
+/**
+ * @file    TestCase_Comm_TimingWheel.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/TestCase_Comm_TimingWheel.h"
+
+#if LLBC_TARGET_PLATFORM_LINUX
+ #include <malloc.h>
+#endif
+
+namespace
+{
+
+/**
+ * Every 4 timers, 1 is periodic timer, fire 3 times then stop.
+ */
+const int PERIODIC_RATIO = 4;
+const int PERIODIC_FIRE_TIMES = 3;
+
+/**
+ * Every 3 timers, 1 will be cancelled before timeout.
+ */
+const int CANCEL_RATIO = 3;
+
+class BenchTimer : public LLBC_BaseTimer
+{
+public:
+    BenchTimer(LLBC_TimerScheduler *scheduler, uint64 &fireTimes)
+    : LLBC_BaseTimer(scheduler)
+    , _fireTimes(fireTimes)
+    , _leftTimes(0)
+    {
+    }
+
+public:
+    void Reset(int leftTimes)
+    {
+        _leftTimes = leftTimes;
+    }
+
+    virtual bool OnTimeout()
+    {
+        ++ _fireTimes;
+        return -- _leftTimes > 0;
+    }
+
+    virtual void OnCancel()
+    {
+    }
+
+private:
+    uint64 &_fireTimes;
+    int _leftTimes;
+};
+
+/**
+ * Simple LCG, make sure all backends use the same timers sequence.
+ */
+uint32 NextRand(uint32 &seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8);
+}
+
+/**
+ * Get the heap in use memory size, in KB, only support linux(glibc).
+ */
+long GetHeapInUseKB()
+{
+#if LLBC_TARGET_PLATFORM_LINUX && defined(__GLIBC__)
+ #if __GLIBC_PREREQ(2, 33)
+    const struct mallinfo2 info = mallinfo2();
+    return static_cast<long>((info.uordblks + info.hblkhd) / 1024);
+ #else
+    const struct mallinfo info = mallinfo();
+    return static_cast<long>((info.uordblks + info.hblkhd) / 1024);
+ #endif
+#else
+    return 0;
+#endif
+}
+
+}
+
+TestCase_Comm_TimingWheel::TestCase_Comm_TimingWheel()
+: _timerCount(1000000)
+, _maxDueTime(1000)
+{
+}
+
+TestCase_Comm_TimingWheel::~TestCase_Comm_TimingWheel()
+{
+}
+
+int TestCase_Comm_TimingWheel::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Timer scheduler backends benchmark:");
+    if (argc >= 2)
+        _timerCount = MAX(1, LLBC_Str2Int32(argv[1]));
+    if (argc >= 3)
+        _maxDueTime = MAX(1, LLBC_Str2Int32(argv[2]));
+
+    LLBC_PrintLine("Usage: ./a [timerCount=1000000] [maxDueTime(ms)=1000]");
+    LLBC_PrintLine("Timers: %d, due time: [1, %d] ms, 1/%d periodic(fire %d times), 1/%d cancelled",
+        _timerCount, _maxDueTime, PERIODIC_RATIO, PERIODIC_FIRE_TIMES, CANCEL_RATIO);
+
+    if (this->RunBackend(LLBC_TimerScheduler::HeapBackend) != LLBC_RTN_OK ||
+        this->RunBackend(LLBC_TimerScheduler::TimingWheelBackend) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_TimingWheel::RunBackend(int backend)
+{
+    const char *backendName =
+        backend == LLBC_TimerScheduler::HeapBackend ? "binary heap" : "timing wheel";
+
+    LLBC_TimerScheduler *scheduler = LLBC_New(LLBC_TimerScheduler);
+    if (scheduler->SetBackend(backend) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Set timer scheduler backend failed, err: %s", LLBC_FormatLastError());
+        LLBC_Delete(scheduler);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    uint64 fireTimes = 0;
+    std::vector<BenchTimer *> timers(_timerCount);
+    for (int i = 0; i < _timerCount; i++)
+        timers[i] = LLBC_New2(BenchTimer, scheduler, fireTimes);
+
+    // Schedule.
+    uint32 seed = 1024;
+    uint64 expectFireTimes = 0;
+    const long memBeg = GetHeapInUseKB();
+    const sint64 schBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _timerCount; i++)
+    {
+        const uint64 dueTime = NextRand(seed) % _maxDueTime + 1;
+        if (i % PERIODIC_RATIO == 0)
+        {
+            timers[i]->Reset(PERIODIC_FIRE_TIMES);
+            timers[i]->Schedule(dueTime, NextRand(seed) % _maxDueTime + 1);
+        }
+        else
+        {
+            timers[i]->Reset(1);
+            timers[i]->Schedule(dueTime, 0);
+        }
+    }
+    const sint64 schUsedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - schBegTime);
+    const long memUsed = GetHeapInUseKB() - memBeg;
+
+    // Cancel.
+    const sint64 cancelBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < _timerCount; i++)
+    {
+        if (i % CANCEL_RATIO == 0)
+            timers[i]->Cancel();
+        else
+            expectFireTimes += (i % PERIODIC_RATIO == 0) ? PERIODIC_FIRE_TIMES : 1;
+    }
+    const sint64 cancelUsedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - cancelBegTime);
+
+    // Fire, only count update cost.
+    sint64 fireUsedTime = 0;
+    const sint64 begTime = LLBC_GetMilliSeconds();
+    while (fireTimes < expectFireTimes &&
+           LLBC_GetMilliSeconds() - begTime < _maxDueTime * (PERIODIC_FIRE_TIMES + 2))
+    {
+        const sint64 updateBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        scheduler->Update();
+        fireUsedTime += LLBC_CPUTime::Current().ToMicroSeconds() - updateBegTime;
+
+        LLBC_Sleep(1);
+    }
+    fireUsedTime = MAX(1, fireUsedTime);
+
+    const int cancelCount = (_timerCount + CANCEL_RATIO - 1) / CANCEL_RATIO;
+    LLBC_PrintLine("[%s] schedule %.1f ns/op, cancel %.1f ns/op, fire %.1f ns/op(%llu/%llu fired), memory %ld KB",
+        backendName,
+        schUsedTime * 1000.0 / _timerCount,
+        cancelUsedTime * 1000.0 / cancelCount,
+        fireUsedTime * 1000.0 / MAX(1, fireTimes),
+        fireTimes,
+        expectFireTimes,
+        memUsed);
+
+    for (int i = 0; i < _timerCount; i++)
+        LLBC_Delete(timers[i]);
+    LLBC_Delete(scheduler);
+
+    return fireTimes == expectFireTimes ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file    TestCase_Comm_TimingWheel.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library timer scheduler backends(binary heap/timing wheel) benchmark.
+ */
+#ifndef __LLBC_TEST_CASE_COMM_TIMING_WHEEL_H__
+#define __LLBC_TEST_CASE_COMM_TIMING_WHEEL_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_TimingWheel : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_TimingWheel();
+    virtual ~TestCase_Comm_TimingWheel();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBackend(int backend);
+
+private:
+    int _timerCount;
+    int _maxDueTime;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_TIMING_WHEEL_H__
@@ -0,0 +1,431 @@
+/**
+ * @file    TestCase_Comm_UnixSocket.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "comm/CommTestHelper.h"
+#include "comm/TestCase_Comm_UnixSocket.h"
+
+namespace
+{
+
+const int PING_OPCODE = 1;
+const int DATA_OPCODE = 2;
+
+// Stream window size, client request next window after received whole window.
+const int STREAM_WINDOW = 1000;
+
+const int CHECK_PACKET_COUNT = 200;
+const size_t CHECK_MAX_PAYLOAD_SIZE = 4096;
+
+/**
+ * Listen and connect unix path, the shared echo check connector.
+ */
+int ConnectUnix(LLBC_IService *server, LLBC_IService *client, const void *arg)
+{
+    const char *path = static_cast<const char *>(arg);
+    if (server->ListenUnix(path) == 0 ||
+        server->Start() != LLBC_RTN_OK ||
+        client->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Listen unix path %s failed, err: %s", path, LLBC_FormatLastError());
+        return 0;
+    }
+
+    const int sessionId = client->ConnectUnix(path);
+    if (sessionId == 0)
+        LLBC_FilePrintLine(stderr, "Connect unix path %s failed, err: %s", path, LLBC_FormatLastError());
+
+    return sessionId;
+}
+
+/**
+ * Server side: echo ping packets, send a window of data packets when client request.
+ */
+class ServerFacade : public LLBC_IFacade
+{
+public:
+    ServerFacade(int totalPackets, size_t payloadSize)
+    : _totalPackets(totalPackets)
+    , _payload(payloadSize + 1, 'a')
+    , _sentCount(0)
+    {
+    }
+
+public:
+    void OnPing(LLBC_Packet &packet)
+    {
+        LLBC_Packet *resPacket = LLBC_New(LLBC_Packet);
+        resPacket->SetHeader(packet, PING_OPCODE, 0);
+        resPacket->Write(packet.GetPayload(), packet.GetPayloadLength());
+
+        this->GetService()->Send(resPacket);
+    }
+
+    void OnRequestStream(LLBC_Packet &packet)
+    {
+        const int sessionId = packet.GetSessionId();
+        for (int i = 0; i < STREAM_WINDOW && _sentCount < _totalPackets; i++, _sentCount++)
+            this->GetService()->Send(sessionId, DATA_OPCODE, &_payload[0], _payload.size() - 1, 0);
+    }
+
+private:
+    int _totalPackets;
+    std::vector<char> _payload;
+
+    int _sentCount;
+};
+
+/**
+ * Client side: ping-pong first, after all pings finished, request server to stream data packets.
+ */
+class ClientFacade : public LLBC_IFacade
+{
+public:
+    ClientFacade(int pingTimes, int totalPackets)
+    : _pingTimes(pingTimes)
+    , _totalPackets(totalPackets)
+    , _pingFinished(false)
+    , _pingBegTime(0)
+
+    , _streamBegTime(0)
+    , _recvCount(0)
+    , _recvBytes(0)
+    {
+        _rtts.reserve(pingTimes);
+    }
+
+public:
+    virtual void OnSessionCreate(const LLBC_SessionInfo &sessionInfo)
+    {
+        if (sessionInfo.IsListenSession())
+            return;
+
+        _pingBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        this->Ping(sessionInfo.GetSessionId());
+    }
+
+    void OnPong(LLBC_Packet &packet)
+    {
+        sint64 sendTime;
+        packet.Read(sendTime);
+
+        _rtts.push_back(LLBC_CPUTime::Current().ToMicroSeconds() - sendTime);
+        if (static_cast<int>(_rtts.size()) < _pingTimes)
+        {
+            this->Ping(packet.GetSessionId());
+            return;
+        }
+
+        _streamBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        _pingFinished = true;
+
+        this->GetService()->Send(packet.GetSessionId(), DATA_OPCODE, "", 0, 0);
+    }
+
+    void OnData(LLBC_Packet &packet)
+    {
+        _recvCount += 1;
+        _recvBytes += packet.GetLength();
+
+        if (_recvCount % STREAM_WINDOW == 0 && _recvCount < _totalPackets)
+            this->GetService()->Send(packet.GetSessionId(), DATA_OPCODE, "", 0, 0);
+    }
+
+public:
+    bool IsPingFinished() const
+    {
+        return _pingFinished;
+    }
+
+    std::vector<sint64> &GetRTTs()
+    {
+        return _rtts;
+    }
+
+    sint64 GetPingBeginTime() const
+    {
+        return _pingBegTime;
+    }
+
+    sint64 GetStreamBeginTime() const
+    {
+        return _streamBegTime;
+    }
+
+    int GetRecvCount() const
+    {
+        return _recvCount;
+    }
+
+    sint64 GetRecvBytes() const
+    {
+        return _recvBytes;
+    }
+
+private:
+    void Ping(int sessionId)
+    {
+        LLBC_Packet *packet = LLBC_New(LLBC_Packet);
+        packet->SetHeader(sessionId, PING_OPCODE, 0);
+        packet->Write(static_cast<sint64>(LLBC_CPUTime::Current().ToMicroSeconds()));
+
+        this->GetService()->Send(packet);
+    }
+
+private:
+    int _pingTimes;
+    int _totalPackets;
+    volatile bool _pingFinished;
+    sint64 _pingBegTime;
+    std::vector<sint64> _rtts;
+
+    sint64 _streamBegTime;
+    volatile int _recvCount;
+    sint64 _recvBytes;
+};
+
+}
+
+TestCase_Comm_UnixSocket::TestCase_Comm_UnixSocket()
+: _unixPath("@llbc_unix_socket_test")
+, _filePath("/tmp/llbc_unix_socket_test.sock")
+, _tcpPort(7788)
+, _pingTimes(10000)
+, _totalPackets(200000)
+, _payloadSize(512)
+{
+}
+
+TestCase_Comm_UnixSocket::~TestCase_Comm_UnixSocket()
+{
+}
+
+int TestCase_Comm_UnixSocket::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Unix domain socket transport test:");
+    if (argc >= 2)
+        _unixPath = argv[1];
+    if (argc >= 3)
+        _tcpPort = LLBC_Str2Int32(argv[2]);
+    if (argc >= 4)
+        _pingTimes = MAX(1, LLBC_Str2Int32(argv[3]));
+    if (argc >= 5)
+        _totalPackets = MAX(1, LLBC_Str2Int32(argv[4]));
+    if (argc >= 6)
+        _payloadSize = static_cast<size_t>(MAX(0, LLBC_Str2Int32(argv[5])));
+
+    LLBC_PrintLine("Usage: ./a [unixPath=@llbc_unix_socket_test] [tcpPort=7788] [pingTimes=10000] [totalPackets=200000] [payloadSize=512]");
+    LLBC_PrintLine("Unix path: %s, tcp: 127.0.0.1:%d, ping times: %d, stream packets: %d, payload size: %lu",
+        _unixPath.c_str(), _tcpPort, _pingTimes, _totalPackets, static_cast<ulong>(_payloadSize));
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    if (this->RunEchoCheck(_unixPath.c_str()) != LLBC_RTN_OK ||
+        this->RunStaleFileCheck() != LLBC_RTN_OK ||
+        this->RunAddrInUseCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    if (this->RunBenchmark(false) != LLBC_RTN_OK ||
+        this->RunBenchmark(true) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+#else // LLBC_TARGET_PLATFORM_WIN32
+    LLBC_PrintLine("Unix domain socket not support in WIN32 platform");
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Comm_UnixSocket::RunEchoCheck(const char *path)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    return CommTestHelper::RunEchoCheck(path, server, client, &ConnectUnix, path,
+        DATA_OPCODE, CHECK_PACKET_COUNT, CHECK_MAX_PAYLOAD_SIZE);
+}
+
+int TestCase_Comm_UnixSocket::RunStaleFileCheck()
+{
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    // Bind and close without unlink, the socket file left as previous process crashed.
+    LLBC_SocketHandle handle = LLBC_CreateUnixSocket();
+    if (handle == LLBC_INVALID_SOCKET_HANDLE ||
+        LLBC_BindToUnixAddress(handle, _filePath.c_str()) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Bind unix path %s failed, err: %s", _filePath.c_str(), LLBC_FormatLastError());
+        if (handle != LLBC_INVALID_SOCKET_HANDLE)
+            LLBC_CloseSocket(handle);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_CloseSocket(handle);
+
+    struct stat st;
+    const bool staleLeft = ::stat(_filePath.c_str(), &st) == 0 && S_ISSOCK(st.st_mode);
+    if (!CommTestHelper::Check(staleLeft, "Stale socket file %s left", _filePath.c_str()))
+        return LLBC_RTN_FAILED;
+
+    // Nobody listening on stale file, listen remove it and work normally.
+    return this->RunEchoCheck(_filePath.c_str());
+#else // LLBC_TARGET_PLATFORM_WIN32
+    return LLBC_RTN_OK;
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+}
+
+int TestCase_Comm_UnixSocket::RunAddrInUseCheck()
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *another = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+    server->SetId(1);
+    another->SetId(2);
+    client->SetId(3);
+
+    CommTestHelper::SessionFacade *serverFacade = LLBC_New(CommTestHelper::SessionFacade);
+    server->RegisterFacade(serverFacade);
+
+    if (server->ListenUnix(_filePath.c_str()) == 0 ||
+        server->Start() != LLBC_RTN_OK ||
+        client->Start() != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Listen unix path %s failed, err: %s", _filePath.c_str(), LLBC_FormatLastError());
+
+        LLBC_Delete(client);
+        LLBC_Delete(another);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    // Path still listening, another listen must failed, not steal the address.
+    const bool rejected = another->ListenUnix(_filePath.c_str()) == 0 &&
+        LLBC_GetLastError() == LLBC_ERROR_CLIB && LLBC_GetSubErrorNo() == EADDRINUSE;
+    bool passed = CommTestHelper::Check(rejected,
+        "Listen on listening unix path %s rejected, err: %s", _filePath.c_str(), LLBC_FormatLastError());
+
+    // Original listener still accept connections(the first accepted session is the probe connection).
+    const bool connected = client->ConnectUnix(_filePath.c_str()) != 0;
+    CommTestHelper::WaitFor(serverFacade, &CommTestHelper::SessionFacade::GetCreatedCount, 2);
+    passed = CommTestHelper::Check(connected && serverFacade->GetCreatedCount() == 2,
+        "Connect to original listener, connected: %s, accepted %d",
+        connected ? "true" : "false", serverFacade->GetCreatedCount()) && passed;
+
+    LLBC_Delete(client);
+    LLBC_Delete(another);
+    LLBC_Delete(server);
+
+#if LLBC_TARGET_PLATFORM_NON_WIN32
+    ::unlink(_filePath.c_str());
+#endif // LLBC_TARGET_PLATFORM_NON_WIN32
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_UnixSocket::RunBenchmark(bool unixSocket)
+{
+    LLBC_IService *server = LLBC_IService::Create(LLBC_IService::Normal);
+    LLBC_IService *client = LLBC_IService::Create(LLBC_IService::Normal);
+
+    ServerFacade *serverFacade = LLBC_New2(ServerFacade, _totalPackets, _payloadSize);
+    server->RegisterFacade(serverFacade);
+    server->Subscribe(PING_OPCODE, serverFacade, &ServerFacade::OnPing);
+    server->Subscribe(DATA_OPCODE, serverFacade, &ServerFacade::OnRequestStream);
+
+    ClientFacade *clientFacade = LLBC_New2(ClientFacade, _pingTimes, _totalPackets);
+    client->RegisterFacade(clientFacade);
+    client->Subscribe(PING_OPCODE, clientFacade, &ClientFacade::OnPong);
+    client->Subscribe(DATA_OPCODE, clientFacade, &ClientFacade::OnData);
+
+    LLBC_IService *svcs[2] = {server, client};
+    for (int i = 0; i < 2; i++)
+    {
+        svcs[i]->SetId(i + 1);
+        svcs[i]->SetFPS(LLBC_CFG_COMM_MAX_SERVICE_FPS);
+        // Don't let service frame interval hide the transport cost.
+        svcs[i]->SetEventDriven(true);
+        svcs[i]->SetPollerIntegratedLoop(true);
+    }
+
+    if (this->ListenAndConnect(server, client, unixSocket) != LLBC_RTN_OK)
+    {
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    const char *transport = unixSocket ? "Unix" : "Tcp ";
+
+    // Ping-pong.
+    const sint64 timeoutTime = LLBC_GetMilliSeconds() + 60000;
+    while (!clientFacade->IsPingFinished() && LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+
+    std::vector<sint64> &rtts = clientFacade->GetRTTs();
+    if (!clientFacade->IsPingFinished() || rtts.empty())
+    {
+        LLBC_FilePrintLine(stderr, "[%-4s] ping-pong timeout", transport);
+
+        LLBC_Delete(client);
+        LLBC_Delete(server);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    CommTestHelper::PrintRTTs(transport, rtts,
+        (clientFacade->GetStreamBeginTime() - clientFacade->GetPingBeginTime()) / 1000);
+
+    // Stream.
+    while (clientFacade->GetRecvCount() < _totalPackets && LLBC_GetMilliSeconds() < timeoutTime)
+        LLBC_Sleep(1);
+    const sint64 usedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - clientFacade->GetStreamBeginTime());
+
+    LLBC_PrintLine("[%-4s] stream recv %d/%d packets used %6lld ms, %8.0f packets/s, %7.2f MB/s",
+        transport,
+        clientFacade->GetRecvCount(),
+        _totalPackets,
+        usedTime / 1000,
+        static_cast<double>(clientFacade->GetRecvCount()) * 1000000 / usedTime,
+        static_cast<double>(clientFacade->GetRecvBytes()) / usedTime);
+
+    const bool allRecved = clientFacade->GetRecvCount() == _totalPackets;
+
+    LLBC_Delete(client);
+    LLBC_Delete(server);
+
+    return allRecved ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Comm_UnixSocket::ListenAndConnect(LLBC_IService *server, LLBC_IService *client, bool unixSocket)
+{
+    const int listenSessionId = unixSocket ?
+        server->ListenUnix(_unixPath.c_str()) : server->Listen("127.0.0.1", _tcpPort);
+    if (listenSessionId == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Listen on %s failed, err: %s",
+            unixSocket ? _unixPath.c_str() : "127.0.0.1", LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+
+    server->Start();
+    client->Start();
+
+    const int sessionId = unixSocket ?
+        client->ConnectUnix(_unixPath.c_str()) : client->Connect("127.0.0.1", _tcpPort);
+    if (sessionId == 0)
+    {
+        LLBC_FilePrintLine(stderr, "Connect to %s failed, err: %s",
+            unixSocket ? _unixPath.c_str() : "127.0.0.1", LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file    TestCase_Comm_UnixSocket.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library unix domain socket transport test and benchmark(compare with tcp loopback).
+ */
+#ifndef __LLBC_TEST_CASE_COMM_UNIX_SOCKET_H__
+#define __LLBC_TEST_CASE_COMM_UNIX_SOCKET_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Comm_UnixSocket : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Comm_UnixSocket();
+    virtual ~TestCase_Comm_UnixSocket();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunEchoCheck(const char *path);
+    int RunStaleFileCheck();
+    int RunAddrInUseCheck();
+
+    int RunBenchmark(bool unixSocket);
+
+    int ListenAndConnect(LLBC_IService *server, LLBC_IService *client, bool unixSocket);
+
+private:
+    LLBC_String _unixPath;
+    LLBC_String _filePath;
+    int _tcpPort;
+    int _pingTimes;
+    int _totalPackets;
+    size_t _payloadSize;
+};
+
+#endif // !__LLBC_TEST_CASE_COMM_UNIX_SOCKET_H__
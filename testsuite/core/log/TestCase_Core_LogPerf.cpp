@@ -0,0 +1,261 @@
+/**
+ * @file    TestCase_Core_LogPerf.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/log/TestCase_Core_LogPerf.h"
+
+namespace
+{
+
+const int CHECK_THREAD_NUM = 8;
+const int CHECK_LOGS_PER_THREAD = 100;
+
+/**
+ * \brief The short-lived logging task, every thread log with too long tag and file name, then exit.
+ */
+class LogTask : public LLBC_BaseTask
+{
+public:
+    LogTask(LLBC_Logger *logger, const LLBC_String &tag, const LLBC_String &file)
+    : _logger(logger)
+    , _tag(tag)
+    , _file(file)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        for (int i = 0; i < CHECK_LOGS_PER_THREAD; i++)
+            _logger->Info(_tag.c_str(), _file.c_str(), __LINE__, "check msg %d", i);
+    }
+
+    virtual void Cleanup()
+    {
+    }
+
+private:
+    LLBC_Logger *_logger;
+    const LLBC_String &_tag;
+    const LLBC_String &_file;
+};
+
+/**
+ * Count log file lines, and the lines which start with the given prefix.
+ */
+void CountLines(const LLBC_String &logFile, const LLBC_String &prefix, int &lineCount, int &matchedCount)
+{
+    lineCount = matchedCount = 0;
+
+    LLBC_File file;
+    if (file.Open(logFile, "rb") != LLBC_RTN_OK)
+        return;
+
+    LLBC_String line;
+    while (file.ReadLine(line) == LLBC_RTN_OK && !line.empty())
+    {
+        ++ lineCount;
+        if (line.find(prefix) == 0)
+            ++ matchedCount;
+
+        line.clear();
+    }
+
+    file.Close();
+}
+
+/**
+ * Get current thread used cpu time, in micro-seconds, asynchronous log runnable
+ * used time not include, if platform not support, return wall clock time.
+ */
+sint64 GetThreadTime()
+{
+#if LLBC_TARGET_PLATFORM_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<sint64>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+#else
+    return LLBC_CPUTime::Current().ToMicroSeconds();
+#endif
+}
+
+}
+
+TestCase_Core_LogPerf::TestCase_Core_LogPerf()
+: _loopTimes(1000000)
+, _logFile("llbc_log_perf.log")
+, _filePattern("%T [%-5L][%f:%l]{tag:%g} - %m%n")
+{
+}
+
+TestCase_Core_LogPerf::~TestCase_Core_LogPerf()
+{
+}
+
+int TestCase_Core_LogPerf::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/log performance test:");
+    if (argc >= 2)
+        _loopTimes = MAX(1, LLBC_Str2Int32(argv[1]));
+    if (argc >= 3)
+        _logFile = argv[2];
+    if (argc >= 4)
+        _filePattern = argv[3];
+
+    LLBC_PrintLine("Usage: ./a [loopTimes=1000000] [logFile=llbc_log_perf.log] [filePattern=%s]",
+        _filePattern.c_str());
+    LLBC_PrintLine("Loop times: %d, log file: %s, file pattern: %s",
+        _loopTimes, _logFile.c_str(), _filePattern.c_str());
+
+    if (this->RunContentCheck() != LLBC_RTN_OK ||
+        this->RunIdleFlushCheck() != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    // Flush every log vs flush in default interval.
+    const int flushIntervals[] = {0, LLBC_CFG_LOG_DEFAULT_ASYNC_FILE_FLUSH_INTERVAL};
+    for (size_t i = 0; i < sizeof(flushIntervals) / sizeof(flushIntervals[0]); i++)
+    {
+        if (this->RunLogger(false, flushIntervals[i]) != LLBC_RTN_OK ||
+            this->RunLogger(true, flushIntervals[i]) != LLBC_RTN_OK)
+            return LLBC_RTN_FAILED;
+    }
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Core_LogPerf::RunContentCheck()
+{
+    // Remove last run's log file, ignore delete error.
+    LLBC_File::Delete(_logFile);
+
+    if (this->InitRootLogger(true, LLBC_CFG_LOG_DEFAULT_ASYNC_FILE_FLUSH_INTERVAL, "%g|%f|%m%n") != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    // Too long tag and file name(longer than log record buffer) must output completely,
+    // producer threads exit before log runnable drained their rings.
+    const LLBC_String tag(LLBC_CFG_LOG_RING_RECORD_SIZE, 't');
+    const LLBC_String file(LLBC_CFG_LOG_RING_RECORD_SIZE / 2, 'f');
+    LogTask task(LLBC_LoggerManagerSingleton->GetRootLogger(), tag, file);
+    task.Activate(CHECK_THREAD_NUM);
+    task.Wait();
+
+    LLBC_LoggerManagerSingleton->Finalize();
+
+    int lineCount, matchedCount;
+    CountLines(_logFile, tag + "|" + file + "|check msg ", lineCount, matchedCount);
+    LLBC_File::Delete(_logFile);
+
+    const int expectCount = CHECK_THREAD_NUM * CHECK_LOGS_PER_THREAD;
+    const bool passed = lineCount == expectCount && matchedCount == expectCount;
+    LLBC_PrintLine("[%s] %d short-lived threads log with %d bytes tag and %d bytes file name, lines %d, matched %d",
+        passed ? "PASS" : "FAIL", CHECK_THREAD_NUM, static_cast<int>(tag.size()), static_cast<int>(file.size()),
+        lineCount, matchedCount);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Core_LogPerf::RunIdleFlushCheck()
+{
+    // Remove last run's log file, ignore delete error.
+    LLBC_File::Delete(_logFile);
+
+    const int flushInterval = 100;
+    if (this->InitRootLogger(false, flushInterval, "%m%n") != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    // Synchronous logger burst logs then idle, the buffered logs must flush after flush interval.
+    LLBC_Logger *logger = LLBC_LoggerManagerSingleton->GetRootLogger();
+    for (int i = 0; i < CHECK_LOGS_PER_THREAD; i++)
+        logger->Info(NULL, __FILE__, __LINE__, "idle msg %d", i);
+
+    LLBC_Sleep(flushInterval * 3);
+
+    int lineCount, matchedCount;
+    CountLines(_logFile, "idle msg ", lineCount, matchedCount);
+
+    LLBC_LoggerManagerSingleton->Finalize();
+    LLBC_File::Delete(_logFile);
+
+    const bool passed = lineCount == CHECK_LOGS_PER_THREAD && matchedCount == CHECK_LOGS_PER_THREAD;
+    LLBC_PrintLine("[%s] Synchronous logger(flush interval %d ms) idle after %d logs, flushed lines %d, matched %d",
+        passed ? "PASS" : "FAIL", flushInterval, CHECK_LOGS_PER_THREAD, lineCount, matchedCount);
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+int TestCase_Core_LogPerf::RunLogger(bool asyncMode, int flushInterval)
+{
+    if (this->InitRootLogger(asyncMode, flushInterval, _filePattern) != LLBC_RTN_OK)
+        return LLBC_RTN_FAILED;
+
+    LLBC_Logger *logger = LLBC_LoggerManagerSingleton->GetRootLogger();
+
+    // Log, only count logging thread cost.
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    const sint64 threadBegTime = GetThreadTime();
+    for (int i = 0; i < _loopTimes; i++)
+        logger->Info("perf", __FILE__, __LINE__, "performance test msg, seq: %d, value: %.3f", i, i * 0.5);
+    const sint64 usedTime = MAX(1, GetThreadTime() - threadBegTime);
+
+    // Finalize, wait all logs output.
+    logger->Finalize();
+    const sint64 drainedTime = MAX(1, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+
+    LLBC_PrintLine("[%s, flush interval %3d ms] logging thread %.1f ns/call, "
+        "all logs output used %.1f ms(%.0f logs/s)",
+        asyncMode ? "async" : " sync",
+        flushInterval,
+        usedTime * 1000.0 / _loopTimes,
+        drainedTime / 1000.0,
+        _loopTimes * 1000000.0 / drainedTime);
+
+    LLBC_LoggerManagerSingleton->Finalize();
+    LLBC_File::Delete(_logFile);
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Core_LogPerf::InitRootLogger(bool asyncMode, int flushInterval, const LLBC_String &filePattern)
+{
+    // Use root logger, write logger config file, then initialize logger manager.
+    LLBC_String cfgContent;
+    cfgContent.append_format("root.level=DEBUG\n");
+    cfgContent.append_format("root.asynchronous=%s\n", asyncMode ? "true" : "false");
+    cfgContent.append_format("root.logToConsole=false\n");
+    cfgContent.append_format("root.logToFile=true\n");
+    cfgContent.append_format("root.logFile=%s\n", _logFile.c_str());
+    cfgContent.append_format("root.dailyRollingMode=false\n");
+    cfgContent.append("root.filePattern=").append(filePattern).append("\n");
+    cfgContent.append_format("root.maxFileSize=%d\n", INT_MAX);
+    cfgContent.append_format("root.fileFlushInterval=%d\n", flushInterval);
+
+    const LLBC_String cfgFile = _logFile + ".cfg";
+    LLBC_File file;
+    if (file.Open(cfgFile, "wb") != LLBC_RTN_OK ||
+        file.Write(cfgContent.data(), cfgContent.size()) != cfgContent.size())
+    {
+        LLBC_FilePrintLine(stderr, "Write logger config file failed, err: %s", LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+    file.Close();
+
+    if (LLBC_LoggerManagerSingleton->Initialize(cfgFile) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Initialize logger manager failed, err: %s", LLBC_FormatLastError());
+        LLBC_File::Delete(cfgFile);
+
+        return LLBC_RTN_FAILED;
+    }
+
+    LLBC_File::Delete(cfgFile);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file    TestCase_Core_LogPerf.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The llbc library logger hot path(ns/call, allocations/call) and file logging throughput benchmark.
+ */
+#ifndef __LLBC_TEST_CASE_CORE_LOG_PERF_H__
+#define __LLBC_TEST_CASE_CORE_LOG_PERF_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_LogPerf : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_LogPerf();
+    virtual ~TestCase_Core_LogPerf();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunContentCheck();
+    int RunIdleFlushCheck();
+    int RunLogger(bool asyncMode, int flushInterval);
+
+    int InitRootLogger(bool asyncMode, int flushInterval, const LLBC_String &filePattern);
+
+private:
+    int _loopTimes;
+    LLBC_String _logFile;
+    LLBC_String _filePattern;
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_LOG_PERF_H__
@@ -0,0 +1,193 @@
+/**
+ * @file    TestCase_Core_Thread_MsgBuffer.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/thread/TestCase_Core_Thread_MsgBuffer.h"
+
+namespace
+{
+    const char *const DATA = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    /**
+     * Build block contain DATA[from, from + len).
+     */
+    LLBC_MessageBlock *BuildBlock(size_t from, size_t len)
+    {
+        LLBC_MessageBlock *block = new LLBC_MessageBlock(len);
+        block->Write(DATA + from, len);
+
+        return block;
+    }
+
+    /**
+     * Append blocks contain DATA[0, 30), block sizes: 1, 2, 3, 4, 5, 6, 9.
+     */
+    void AppendBlocks(LLBC_MessageBuffer &buffer)
+    {
+        const size_t lens[] = {1, 2, 3, 4, 5, 6, 9};
+        for (size_t i = 0, from = 0; i < sizeof(lens) / sizeof(lens[0]); from += lens[i++])
+            buffer.Append(BuildBlock(from, lens[i]));
+    }
+}
+
+TestCase_Core_Thread_MsgBuffer::TestCase_Core_Thread_MsgBuffer()
+{
+}
+
+TestCase_Core_Thread_MsgBuffer::~TestCase_Core_Thread_MsgBuffer()
+{
+}
+
+int TestCase_Core_Thread_MsgBuffer::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("Message buffer test:");
+
+    bool passed = this->AppendTest();
+    passed = this->RemoveTest() && passed;
+    passed = this->ReadTest() && passed;
+    passed = this->MergeTest() && passed;
+
+    LLBC_PrintLine("Message buffer test %s", passed ? "passed" : "failed");
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return passed ? LLBC_RTN_OK : LLBC_RTN_FAILED;
+}
+
+bool TestCase_Core_Thread_MsgBuffer::AppendTest()
+{
+    LLBC_MessageBuffer buffer;
+    bool passed = CheckBuffer(buffer, 0, 0, "Empty");
+
+    AppendBlocks(buffer);
+    passed = CheckBuffer(buffer, 30, 7, "Append 7 blocks") && passed;
+
+    // Empty block can't append.
+    LLBC_MessageBlock *emptyBlock = new LLBC_MessageBlock(8);
+    passed = (buffer.Append(emptyBlock) != LLBC_RTN_OK) && passed;
+    delete emptyBlock;
+    passed = CheckBuffer(buffer, 30, 7, "Append empty block") && passed;
+
+    passed = (buffer.Write(DATA + 30, 6) == LLBC_RTN_OK) && passed;
+    passed = CheckBuffer(buffer, 36, 8, "Write 6 bytes") && passed;
+
+    buffer.Cleanup();
+    passed = CheckBuffer(buffer, 0, 0, "Cleanup") && passed;
+
+    AppendBlocks(buffer);
+    passed = CheckBuffer(buffer, 30, 7, "Append after cleanup") && passed;
+
+    return passed;
+}
+
+bool TestCase_Core_Thread_MsgBuffer::RemoveTest()
+{
+    LLBC_MessageBuffer buffer;
+    AppendBlocks(buffer);
+
+    bool passed = (buffer.Remove(0) == 0);
+    passed = CheckBuffer(buffer, 30, 7, "Remove 0 bytes") && passed;
+
+    // Remove exact blocks: 1 + 2.
+    passed = (buffer.Remove(3) == 3) && passed;
+    passed = CheckBuffer(buffer, 27, 5, "Remove 3 bytes(exact 2 blocks)") && passed;
+
+    // Remove across blocks: 3 + 2 of 4.
+    passed = (buffer.Remove(5) == 5) && passed;
+    passed = CheckBuffer(buffer, 22, 4, "Remove 5 bytes(across blocks)") && passed;
+    passed = (buffer.FirstBlock() && buffer.FirstBlock()->GetReadableSize() == 2 &&
+        ::memcmp(buffer.FirstBlock()->GetDataStartWithReadPos(), DATA + 8, 2) == 0) && passed;
+
+    passed = (buffer.Write(DATA + 30, 6) == LLBC_RTN_OK) && passed;
+    passed = CheckBuffer(buffer, 28, 5, "Write 6 bytes after remove") && passed;
+
+    // Remove more than size, stop at buffer end.
+    passed = (buffer.Remove(100) == 28) && passed;
+    passed = CheckBuffer(buffer, 0, 0, "Remove overflow") && passed;
+
+    // Tail reset after buffer drained.
+    AppendBlocks(buffer);
+    passed = CheckBuffer(buffer, 30, 7, "Append after drained") && passed;
+
+    return passed;
+}
+
+bool TestCase_Core_Thread_MsgBuffer::ReadTest()
+{
+    LLBC_MessageBuffer buffer;
+    AppendBlocks(buffer);
+
+    char buf[64];
+
+    // Exact block read.
+    bool passed = (buffer.Read(buf, 1) == 1 && buf[0] == DATA[0]);
+    passed = CheckBuffer(buffer, 29, 6, "Read 1 byte(exact block)") && passed;
+
+    // Across blocks read.
+    passed = (buffer.Read(buf, 4) == 4 && ::memcmp(buf, DATA + 1, 4) == 0) && passed;
+    passed = CheckBuffer(buffer, 25, 5, "Read 4 bytes(across blocks)") && passed;
+
+    // Read overflow, stop at buffer end.
+    passed = (buffer.Read(buf, sizeof(buf)) == 25 && ::memcmp(buf, DATA + 5, 25) == 0) && passed;
+    passed = CheckBuffer(buffer, 0, 0, "Read overflow") && passed;
+
+    AppendBlocks(buffer);
+    passed = CheckBuffer(buffer, 30, 7, "Append after read all") && passed;
+
+    return passed;
+}
+
+bool TestCase_Core_Thread_MsgBuffer::MergeTest()
+{
+    LLBC_MessageBuffer buffer;
+    AppendBlocks(buffer);
+    buffer.Remove(2);
+
+    LLBC_MessageBlock *merged = buffer.MergeBuffersAndDetach();
+    bool passed = (merged && merged->GetNext() == NULL &&
+        merged->GetReadableSize() == 28 &&
+        ::memcmp(merged->GetDataStartWithReadPos(), DATA + 2, 28) == 0);
+    LLBC_PrintLine("    Merged block: size %lu, %s",
+        static_cast<ulong>(merged ? merged->GetReadableSize() : 0), passed ? "ok" : "mismatch");
+    delete merged;
+
+    passed = CheckBuffer(buffer, 0, 0, "Merge and detach") && passed;
+    passed = (buffer.MergeBuffersAndDetach() == NULL) && passed;
+
+    AppendBlocks(buffer);
+    passed = CheckBuffer(buffer, 30, 7, "Append after merge") && passed;
+
+    return passed;
+}
+
+bool TestCase_Core_Thread_MsgBuffer::CheckBuffer(const LLBC_MessageBuffer &buffer, size_t size, size_t blockCount, const char *step)
+{
+    // Walk the blocks list, if tail not maintained, appended blocks will lost from the list.
+    size_t walkSize = 0, walkBlockCount = 0;
+    for (LLBC_MessageBlock *block = buffer.FirstBlock(); block; block = block->GetNext())
+    {
+        walkSize += block->GetReadableSize();
+        walkBlockCount += 1;
+    }
+
+    const bool passed = buffer.GetSize() == size && walkSize == size &&
+        buffer.GetBlockCount() == blockCount && walkBlockCount == blockCount;
+
+    LLBC_PrintLine("    %s: size %lu(walk %lu, expect %lu), blocks %lu(walk %lu, expect %lu), %s",
+        step,
+        static_cast<ulong>(buffer.GetSize()),
+        static_cast<ulong>(walkSize),
+        static_cast<ulong>(size),
+        static_cast<ulong>(buffer.GetBlockCount()),
+        static_cast<ulong>(walkBlockCount),
+        static_cast<ulong>(blockCount),
+        passed ? "ok" : "mismatch");
+
+    return passed;
+}
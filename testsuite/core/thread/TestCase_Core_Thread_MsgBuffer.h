@@ -0,0 +1,37 @@
+/**
+ * @file    TestCase_Core_Thread_MsgBuffer.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The message buffer testcase, check tail, size and block count bookkeeping.
+ */
+#ifndef __LLBC_TEST_CASE_CORE_THREAD_MSG_BUFFER_H__
+#define __LLBC_TEST_CASE_CORE_THREAD_MSG_BUFFER_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Thread_MsgBuffer : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Thread_MsgBuffer();
+    virtual ~TestCase_Core_Thread_MsgBuffer();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    bool AppendTest();
+    bool RemoveTest();
+    bool ReadTest();
+    bool MergeTest();
+
+private:
+    /**
+     * Check buffer size and block count, compare with the blocks list walk result.
+     */
+    static bool CheckBuffer(const LLBC_MessageBuffer &buffer, size_t size, size_t blockCount, const char *step);
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_THREAD_MSG_BUFFER_H__
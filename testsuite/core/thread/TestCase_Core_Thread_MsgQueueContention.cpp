@@ -0,0 +1,174 @@
+/**
+ * @file    TestCase_Core_Thread_MsgQueueContention.cpp
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief
+ */
+
+#include "core/thread/TestCase_Core_Thread_MsgQueueContention.h"
+
+namespace
+{
+
+/**
+ * \brief The consumer task, pop all messages and record finish time.
+ */
+class ConsumerTask : public LLBC_BaseTask
+{
+public:
+    explicit ConsumerTask(int totalMsgs)
+    : _totalMsgs(totalMsgs)
+    , _finishTime(0)
+    {
+    }
+
+public:
+    virtual void Svc()
+    {
+        LLBC_MessageBlock *block;
+        for (int i = 0; i < _totalMsgs; i++)
+            this->Pop(block);
+
+        _finishTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    }
+
+    virtual void Cleanup()
+    {
+    }
+
+public:
+    sint64 GetFinishTime() const
+    {
+        return _finishTime;
+    }
+
+private:
+    int _totalMsgs;
+    sint64 _finishTime;
+};
+
+/**
+ * \brief The producer task, all threads wait start flag, then push pre-allocated blocks to consumer.
+ */
+class ProducerTask : public LLBC_BaseTask
+{
+public:
+    ProducerTask(LLBC_BaseTask *consumer, int producerNum, int msgsPerProducer)
+    : _consumer(consumer)
+    , _msgsPerProducer(msgsPerProducer)
+    , _nextProducer(0)
+    , _started(false)
+    , _blocks(producerNum * msgsPerProducer)
+    {
+        for (size_t i = 0; i < _blocks.size(); i++)
+            _blocks[i] = LLBC_New1(LLBC_MessageBlock, 0);
+    }
+
+    virtual ~ProducerTask()
+    {
+        LLBC_STLHelper::DeleteContainer(_blocks);
+    }
+
+public:
+    virtual void Svc()
+    {
+        const int producerIdx = LLBC_AtomicFetchAndAdd(&_nextProducer, 1);
+        LLBC_MessageBlock **blocks = &_blocks[producerIdx * _msgsPerProducer];
+
+        while (!_started)
+            LLBC_ThreadManager::CPURelax();
+
+        for (int i = 0; i < _msgsPerProducer; i++)
+            _consumer->Push(blocks[i]);
+    }
+
+    virtual void Cleanup()
+    {
+    }
+
+public:
+    void Start()
+    {
+        _started = true;
+    }
+
+private:
+    LLBC_BaseTask *_consumer;
+    int _msgsPerProducer;
+
+    volatile sint32 _nextProducer;
+    volatile bool _started;
+
+    std::vector<LLBC_MessageBlock *> _blocks;
+};
+
+}
+
+TestCase_Core_Thread_MsgQueueContention::TestCase_Core_Thread_MsgQueueContention()
+: _msgsPerProducer(200000)
+{
+}
+
+TestCase_Core_Thread_MsgQueueContention::~TestCase_Core_Thread_MsgQueueContention()
+{
+}
+
+int TestCase_Core_Thread_MsgQueueContention::Run(int argc, char *argv[])
+{
+    LLBC_PrintLine("core/thread/message queue contention benchmark:");
+    if (argc >= 2)
+        _msgsPerProducer = MAX(1, LLBC_Str2Int32(argv[1]));
+
+    LLBC_PrintLine("Usage: ./a [msgsPerProducer=200000]");
+
+    const int producerNums[] = {1, 2, 4, 8, 16};
+    for (size_t i = 0; i < sizeof(producerNums) / sizeof(producerNums[0]); i++)
+    {
+        if (this->RunBenchmark(false, producerNums[i]) != LLBC_RTN_OK ||
+            this->RunBenchmark(true, producerNums[i]) != LLBC_RTN_OK)
+            return LLBC_RTN_FAILED;
+    }
+
+    LLBC_PrintLine("Press any key to continue...");
+    getchar();
+
+    return LLBC_RTN_OK;
+}
+
+int TestCase_Core_Thread_MsgQueueContention::RunBenchmark(bool lockFree, int producerNum)
+{
+    const int totalMsgs = producerNum * _msgsPerProducer;
+
+    ConsumerTask consumer(totalMsgs);
+    consumer.SetMsgQueueLockFree(lockFree);
+    if (consumer.Activate(1) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Activate consumer task failed, err: %s", LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+
+    ProducerTask producer(&consumer, producerNum, _msgsPerProducer);
+    if (producer.Activate(producerNum) != LLBC_RTN_OK)
+    {
+        LLBC_FilePrintLine(stderr, "Activate producer task failed, err: %s", LLBC_FormatLastError());
+        return LLBC_RTN_FAILED;
+    }
+
+    const sint64 begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    producer.Start();
+
+    producer.Wait();
+    consumer.Wait();
+
+    const sint64 usedTime = MAX(1, consumer.GetFinishTime() - begTime);
+    LLBC_PrintLine("[%-9s] producers: %2d, messages: %8d, used: %8lld us, %.2f Mmsgs/s",
+        lockFree ? "lock-free" : "locked",
+        producerNum,
+        totalMsgs,
+        usedTime,
+        static_cast<double>(totalMsgs) / usedTime);
+
+    return LLBC_RTN_OK;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file    TestCase_Core_Thread_MsgQueueContention.h
+ * @author  agent<agent@local>
+ * @date    2026/10/18
+ * @version 1.0
+ *
+ * @brief   The task message queue(locked/lock-free) multi producers contention benchmark.
+ */
+#ifndef __LLBC_TEST_CASE_CORE_THREAD_MSG_QUEUE_CONTENTION_H__
+#define __LLBC_TEST_CASE_CORE_THREAD_MSG_QUEUE_CONTENTION_H__
+
+#include "llbc.h"
+using namespace llbc;
+
+class TestCase_Core_Thread_MsgQueueContention : public LLBC_BaseTestCase
+{
+public:
+    TestCase_Core_Thread_MsgQueueContention();
+    virtual ~TestCase_Core_Thread_MsgQueueContention();
+
+public:
+    virtual int Run(int argc, char *argv[]);
+
+private:
+    int RunBenchmark(bool lockFree, int producerNum);
+
+private:
+    int _msgsPerProducer;
+};
+
+#endif // !__LLBC_TEST_CASE_CORE_THREAD_MSG_QUEUE_CONTENTION_H__
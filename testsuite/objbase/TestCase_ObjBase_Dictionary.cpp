@@ -196,8 +196,66 @@ int TestCase_ObjBase_Dictionary::Run(int argc, char *argv[])
     }
     std::cout <<std::endl;
 
+    // Large dictionary test, check load factor, incremental rehash and insertion order.
+    this->LargeDictTest(300000);
+
     std::cout <<"Press any key to continue ..." <<std::endl;
     getchar();
 
     return 0;
 }
+
+void TestCase_ObjBase_Dictionary::LargeDictTest(int elemCount)
+{
+    std::cout <<"Large dictionary test, elements count: " <<elemCount <<std::endl;
+
+    LLBC_Dictionary dict;
+    LLBC_Object *obj = new TestObj;
+
+    // Insert, record the max single insert time.
+    LLBC_CPUTime::CPUTimeCount maxInsertTime = 0;
+    const LLBC_CPUTime::CPUTimeCount insertBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < elemCount; i++)
+    {
+        const LLBC_CPUTime::CPUTimeCount begTime = LLBC_CPUTime::Current().ToMicroSeconds();
+        dict.Insert(i, obj);
+        maxInsertTime = MAX(maxInsertTime, LLBC_CPUTime::Current().ToMicroSeconds() - begTime);
+    }
+    const LLBC_CPUTime::CPUTimeCount insertUsedTime = LLBC_CPUTime::Current().ToMicroSeconds() - insertBegTime;
+
+    std::cout <<"Insert done, used time(us): " <<insertUsedTime
+              <<", max single insert time(us): " <<maxInsertTime
+              <<", rehashing: " <<(dict.IsRehashing() ? "true" : "false") <<std::endl;
+
+    // Find all.
+    int foundCount = 0;
+    const LLBC_CPUTime::CPUTimeCount findBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < elemCount; i++)
+    {
+        if (dict.Find(i) != dict.End())
+            foundCount += 1;
+    }
+    const LLBC_CPUTime::CPUTimeCount findUsedTime = LLBC_CPUTime::Current().ToMicroSeconds() - findBegTime;
+    std::cout <<"Find done, found: " <<foundCount <<", used time(us): " <<findUsedTime <<std::endl;
+    ASSERT(foundCount == elemCount && "Dictionary internal error, check it!");
+
+    // Check insertion order.
+    int expectKey = 0;
+    LLBC_Dictionary::ConstIter it = dict.Begin();
+    for (; it != dict.End(); it++, expectKey++)
+    {
+        if (it.IntKey() != expectKey)
+            break;
+    }
+    std::cout <<"Insertion order check: " <<(expectKey == elemCount ? "ok" : "failed") <<std::endl;
+    ASSERT(expectKey == elemCount && "Dictionary internal error, check it!");
+
+    // Erase all.
+    const LLBC_CPUTime::CPUTimeCount eraseBegTime = LLBC_CPUTime::Current().ToMicroSeconds();
+    for (int i = 0; i < elemCount; i++)
+        dict.Erase(i);
+    const LLBC_CPUTime::CPUTimeCount eraseUsedTime = LLBC_CPUTime::Current().ToMicroSeconds() - eraseBegTime;
+    std::cout <<"Erase done, size: " <<dict.GetSize() <<", used time(us): " <<eraseUsedTime <<std::endl;
+
+    obj->Release();
+}
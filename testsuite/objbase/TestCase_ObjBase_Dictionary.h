@@ -20,6 +20,9 @@ public:
 
 public:
     virtual int Run(int argc, char *argv[]);
+
+private:
+    void LargeDictTest(int elemCount);
 };
 
 #endif // !__LLBC_TEST_CASE_OBJBASE_DICTIONARY_H__